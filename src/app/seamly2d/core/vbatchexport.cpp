@@ -0,0 +1,345 @@
+/***************************************************************************
+ **  @file   vbatchexport.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vbatchexport.h"
+
+#include "../ifc/exception/vexception.h"
+#include "../vmisc/commandoptions.h"
+#include "../vmisc/vsysexits.h"
+
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QProcess>
+#include <QTemporaryDir>
+#include <QtDebug>
+#include <algorithm>
+#include <memory>
+
+namespace
+{
+const QString jobPattern   = QStringLiteral("pattern");
+const QString jobArguments = QStringLiteral("arguments");
+const QString jobDefaults  = QStringLiteral("defaults");
+const QString jobList      = QStringLiteral("jobs");
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList OptionToArguments(const QString &key, const QJsonValue &value)
+{
+    const QString option = QStringLiteral("--") + key;
+    switch (value.type())
+    {
+        case QJsonValue::Bool:
+            return value.toBool() ? QStringList() << option : QStringList();
+        case QJsonValue::Double:
+            return QStringList() << option << QString::number(value.toDouble());
+        case QJsonValue::String:
+            return QStringList() << option << value.toString();
+        default:
+            throw VException(VBatchExport::tr("Unsupported value of option '%1'.").arg(key));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VExportJob ParseJob(const QJsonObject &defaults, const QJsonObject &object)
+{
+    QJsonObject options = defaults;
+    for (auto i = object.constBegin(); i != object.constEnd(); ++i)
+    {
+        options.insert(i.key(), i.value());
+    }
+
+    VExportJob job;
+    for (auto i = options.constBegin(); i != options.constEnd(); ++i)
+    {
+        if (i.key() == jobPattern)
+        {
+            job.pattern = i.value().toString();
+        }
+        else if (i.key() == jobArguments)
+        {
+            const QJsonArray arguments = i.value().toArray();
+            for (int n = 0; n < arguments.size(); ++n)
+            {
+                job.arguments.append(arguments.at(n).toString());
+            }
+        }
+        else
+        {
+            job.arguments.append(OptionToArguments(i.key(), i.value()));
+        }
+    }
+
+    if (job.pattern.isEmpty())
+    {
+        throw VException(VBatchExport::tr("Export job without pattern file."));
+    }
+
+    return job;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief JobKey jobs with the same key are exported from the same loaded pattern.
+ */
+QString JobKey(const VExportJob &job)
+{
+    const int index = job.arguments.indexOf(QStringLiteral("--") + LONG_OPTION_MEASUREFILE);
+    const QString measurements = index >= 0 && index + 1 < job.arguments.size() ? job.arguments.at(index + 1)
+                                                                                : QString();
+    return job.pattern + QChar('\n') + measurements;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool HasOption(const QStringList &arguments, const QString &longName, const QString &shortName)
+{
+    const QString longOption = QStringLiteral("--") + longName;
+    const QString shortOption = QStringLiteral("-") + shortName;
+    for (int i = 0; i < arguments.size(); ++i)
+    {
+        const QString &argument = arguments.at(i);
+        if (argument == longOption || argument.startsWith(longOption + QChar('='))
+                || argument == shortOption)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReadJobs read job list of batch export.
+ * @param fileName path to job list.
+ * @return jobs in order of the list.
+ */
+QVector<VExportJob> VBatchExport::ReadJobs(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        throw VException(tr("Can't open file %1:\n%2.").arg(fileName, file.errorString()));
+    }
+
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (document.isNull())
+    {
+        VException e(error.errorString());
+        e.AddMoreInformation(tr("Parsing error file %1 at offset %2").arg(fileName).arg(error.offset));
+        throw e;
+    }
+
+    QJsonObject defaults;
+    QJsonArray list;
+    if (document.isArray())
+    {
+        list = document.array();
+    }
+    else
+    {
+        defaults = document.object().value(jobDefaults).toObject();
+        list = document.object().value(jobList).toArray();
+    }
+
+    QVector<VExportJob> jobs;
+    jobs.reserve(list.size());
+    for (int i = 0; i < list.size(); ++i)
+    {
+        if (not list.at(i).isObject())
+        {
+            throw VException(tr("Export job %1 is not an object.").arg(i + 1));
+        }
+        jobs.append(ParseJob(defaults, list.at(i).toObject()));
+    }
+
+    return jobs;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WriteJobs write jobs in form that ReadJobs can read back.
+ */
+void VBatchExport::WriteJobs(const QString &fileName, const QVector<VExportJob> &jobs)
+{
+    QJsonArray list;
+    for (auto &job : jobs)
+    {
+        QJsonObject object;
+        object.insert(jobPattern, job.pattern);
+        object.insert(jobArguments, QJsonArray::fromStringList(job.arguments));
+        list.append(object);
+    }
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate)
+            || file.write(QJsonDocument(list).toJson()) < 0)
+    {
+        throw VException(tr("Can't write file %1:\n%2.").arg(fileName, file.errorString()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SplitJobs split jobs between count workers.
+ *
+ * Jobs of the same pattern and measurements stay together where possible, so a worker loads a pattern once. Too
+ * long runs of the same pattern are cut into equal chunks to keep all workers busy.
+ */
+QVector<QVector<VExportJob>> VBatchExport::SplitJobs(const QVector<VExportJob> &jobs, int count)
+{
+    count = qMax(1, qMin(count, jobs.size()));
+    QVector<QVector<VExportJob>> shards(count);
+    if (jobs.isEmpty())
+    {
+        return shards;
+    }
+
+    const int chunkSize = (jobs.size() + count - 1) / count;
+
+    // Runs of jobs that share a pattern, cut by chunk size
+    QVector<QVector<VExportJob>> chunks;
+    QString lastKey;
+    for (auto &job : jobs)
+    {
+        const QString key = JobKey(job);
+        if (chunks.isEmpty() || key != lastKey || chunks.last().size() >= chunkSize)
+        {
+            chunks.append(QVector<VExportJob>());
+        }
+        chunks.last().append(job);
+        lastKey = key;
+    }
+
+    // Longest chunks first, each one to the least loaded worker
+    std::stable_sort(chunks.begin(), chunks.end(), [](const QVector<VExportJob> &a, const QVector<VExportJob> &b)
+    {
+        return a.size() > b.size();
+    });
+
+    for (auto &chunk : chunks)
+    {
+        auto shard = std::min_element(shards.begin(), shards.end(),
+                                      [](const QVector<VExportJob> &a, const QVector<VExportJob> &b)
+        {
+            return a.size() < b.size();
+        });
+        *shard += chunk;
+    }
+
+    return shards;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief WithGradation arguments of a job that is exported from an already loaded pattern. A job that does not set
+ * size or height gets the values the pattern was loaded with, so it does not inherit the gradation of the previous
+ * job and exports the same as when it runs alone.
+ * @param arguments export options of the job.
+ * @param size size the pattern was loaded with, empty if the pattern has no gradation.
+ * @param height height the pattern was loaded with, empty if the pattern has no gradation.
+ */
+QStringList VBatchExport::WithGradation(const QStringList &arguments, const QString &size, const QString &height)
+{
+    QStringList result = arguments;
+    if (not size.isEmpty() && not HasOption(arguments, LONG_OPTION_GRADATIONSIZE, SINGLE_OPTION_GRADATIONSIZE))
+    {
+        result << QStringLiteral("--") + LONG_OPTION_GRADATIONSIZE << size;
+    }
+
+    if (not height.isEmpty() && not HasOption(arguments, LONG_OPTION_GRADATIONHEIGHT, SINGLE_OPTION_GRADATIONHEIGHT))
+    {
+        result << QStringLiteral("--") + LONG_OPTION_GRADATIONHEIGHT << height;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RunWorkers run jobs in several processes of the application at once.
+ * @return V_EX_OK if all jobs were exported, otherwise exit code of the first failed worker.
+ */
+int VBatchExport::RunWorkers(const QVector<VExportJob> &jobs, int workers)
+{
+    QTemporaryDir dir;
+    if (not dir.isValid())
+    {
+        qCritical() << tr("Can't create a temporary directory for job lists.");
+        return V_EX_CANTCREAT;
+    }
+
+    const QVector<QVector<VExportJob>> shards = SplitJobs(jobs, workers);
+
+    std::vector<std::unique_ptr<QProcess>> processes;
+    for (int i = 0; i < shards.size(); ++i)
+    {
+        if (shards.at(i).isEmpty())
+        {
+            continue;
+        }
+
+        const QString shardFile = dir.filePath(QStringLiteral("jobs%1.json").arg(i));
+        try
+        {
+            WriteJobs(shardFile, shards.at(i));
+        }
+        catch (const VException &e)
+        {
+            qCritical() << e.ErrorMessage();
+            return V_EX_CANTCREAT;
+        }
+
+        std::unique_ptr<QProcess> process(new QProcess());
+        process->setProcessChannelMode(QProcess::ForwardedChannels);
+        process->start(QCoreApplication::applicationFilePath(), QStringList()
+                       << QStringLiteral("--") + LONG_OPTION_BATCH << shardFile
+                       << QStringLiteral("--") + LONG_OPTION_JOBS << QStringLiteral("1"));
+        processes.push_back(std::move(process));
+    }
+
+    int result = V_EX_OK;
+    for (auto &process : processes)
+    {
+        process->waitForFinished(-1);
+
+        int code = V_EX_OK;
+        if (process->exitStatus() != QProcess::NormalExit || process->error() == QProcess::FailedToStart)
+        {
+            code = V_EX_SOFTWARE;
+        }
+        else
+        {
+            code = process->exitCode();
+        }
+
+        if (result == V_EX_OK)
+        {
+            result = code;
+        }
+    }
+
+    return result;
+}
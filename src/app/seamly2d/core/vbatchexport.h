@@ -0,0 +1,81 @@
+/***************************************************************************
+ **  @file   vbatchexport.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VBATCHEXPORT_H
+#define VBATCHEXPORT_H
+
+#include <QCoreApplication>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/** @brief The VExportJob struct one export of a batch. */
+struct VExportJob
+{
+    VExportJob()
+        : pattern(),
+          arguments()
+    {}
+
+    /** @brief pattern path to pattern file. */
+    QString     pattern;
+
+    /** @brief arguments export options in command line form. */
+    QStringList arguments;
+};
+
+/**
+ * @brief The VBatchExport class reads job lists of headless batch export and splits them between worker processes.
+ *
+ * A job list is a JSON document. It is either an array of jobs or an object with array "jobs" and optional object
+ * "defaults". Each job is an object with key "pattern", other keys are long names of command line options. Array
+ * "arguments" is passed to the command line as is.
+ *
+ * @code
+ * {
+ *     "defaults": {"format": 1, "destination": "out"},
+ *     "jobs": [
+ *         {"pattern": "shirt.val", "mfile": "standard.vst", "gsize": 40, "gheight": 170, "basename": "shirt_40_170"},
+ *         {"pattern": "shirt.val", "mfile": "standard.vst", "gsize": 42, "gheight": 170, "basename": "shirt_42_170"}
+ *     ]
+ * }
+ * @endcode
+ */
+class VBatchExport
+{
+    Q_DECLARE_TR_FUNCTIONS(VBatchExport)
+public:
+    static QVector<VExportJob> ReadJobs(const QString &fileName);
+    static void                WriteJobs(const QString &fileName, const QVector<VExportJob> &jobs);
+
+    static QVector<QVector<VExportJob>> SplitJobs(const QVector<VExportJob> &jobs, int count);
+
+    static QStringList WithGradation(const QStringList &arguments, const QString &size, const QString &height);
+
+    static int RunWorkers(const QVector<VExportJob> &jobs, int workers);
+
+private:
+    Q_DISABLE_COPY(VBatchExport)
+};
+
+#endif // VBATCHEXPORT_H
@@ -41,7 +41,7 @@ VCommandLinePtr VCommandLine::instance = nullptr;
 #define translate(context, source) QCoreApplication::translate((context), (source))
 
 //---------------------------------------------------------------------------------------------------------------------
-VCommandLine::VCommandLine() : parser(), optionsUsed(), optionsIndex(), isGuiEnabled(false)
+VCommandLine::VCommandLine() : parser(), optionsUsed(), optionsIndex(), isGuiEnabled(false), isJob(false), jobError()
 {
     parser.setApplicationDescription(translate("VCommandLine", "Pattern making program."));
     parser.addHelpOption();
@@ -258,6 +258,28 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                           .arg(DialogLayoutSettings::MakeGroupsHelp()),
                                           translate("VCommandLine", "Grouping type"), "2"));
 
+    optionsIndex.insert(LONG_OPTION_ATTEMPTS, index++);
+    options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_ATTEMPTS << LONG_OPTION_ATTEMPTS,
+                                          translate("VCommandLine", "Number of layout attempts that run in parallel "
+                                                    "(export mode). Each attempt uses other grouping, shift length and "
+                                                    "order of details. The shortest layout wins. Default value is 1."),
+                                          translate("VCommandLine", "Attempts count"), "1"));
+
+    optionsIndex.insert(LONG_OPTION_TIMELIMIT, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_TIMELIMIT,
+                                          translate("VCommandLine", "Time limit in seconds for layout attempts (export "
+                                                    "mode). When time is over the best finished layout is used. 0 "
+                                                    "means no limit. Makes sense only with key \"%1\".")
+                                          .arg(LONG_OPTION_ATTEMPTS),
+                                          translate("VCommandLine", "Seconds"), "0"));
+
+    optionsIndex.insert(LONG_OPTION_ENGINE, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_ENGINE,
+                                          translate("VCommandLine", "Layout placement engine (export mode): "
+                                                    "\"edge\" aligns details edge to edge, \"nfp\" places details "
+                                                    "bottom-left by no-fit polygons. Default value is \"edge\"."),
+                                          translate("VCommandLine", "Engine"), "edge"));
+
     optionsIndex.insert(LONG_OPTION_TEST, index++);
     options.append(new QCommandLineOption(QStringList() << SINGLE_OPTION_TEST << LONG_OPTION_TEST,
                                           translate("VCommandLine", "Run the program in a test mode. The program in "
@@ -265,6 +287,22 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
                                                     "showing the main window. The key have priority before key '%1'.")
                                                     .arg(LONG_OPTION_BASENAME)));
 
+    optionsIndex.insert(LONG_OPTION_BATCH, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_BATCH,
+                                          translate("VCommandLine", "Run export jobs from a JSON job list without "
+                                                    "showing the main window. Each job is an object with key "
+                                                    "\"pattern\" and the long names of export options as keys. "
+                                                    "Object \"defaults\" holds options for all jobs. A pattern is "
+                                                    "loaded once for all its jobs in a row."),
+                                          translate("VCommandLine", "The job list file")));
+
+    optionsIndex.insert(LONG_OPTION_JOBS, index++);
+    options.append(new QCommandLineOption(QStringList() << LONG_OPTION_JOBS,
+                                          translate("VCommandLine", "Number of processes that run export jobs in "
+                                                    "parallel. Makes sense only with key \"%1\". Default value is 1.")
+                                          .arg(LONG_OPTION_BATCH),
+                                          translate("VCommandLine", "Processes count"), "1"));
+
     optionsIndex.insert(LONG_OPTION_NO_HDPI_SCALING, index++);
     options.append(new QCommandLineOption(QStringList() << LONG_OPTION_NO_HDPI_SCALING,
                                           translate("VCommandLine", "Disable high dpi scaling. Call this option if has "
@@ -275,6 +313,53 @@ void VCommandLine::InitOptions(VCommandLineOptions &options, QMap<QString, int>
 }
 
 //------------------------------------------------------------------------------------------------------
+/**
+ * @brief InvalidOption report invalid option value. Shows help and exits, but a batch export job only remembers the
+ * first error (see JobError()), so other jobs of the list still run.
+ */
+void VCommandLine::InvalidOption(const QString &message) const
+{
+    if (isJob)
+    {
+        if (jobError.isEmpty())
+        {
+            jobError = message;
+        }
+        return;
+    }
+
+    qCritical() << message << "\n";
+    const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+}
+
+//------------------------------------------------------------------------------------------------------
+/**
+ * @brief CheckJobOptions check values of a batch export job that can be checked without the layout dialog.
+ */
+void VCommandLine::CheckJobOptions() const
+{
+    IsExportEnabled();
+    OptAttempts();
+    OptTimeLimit();
+    OptEngine();
+    OptExportType();
+
+    if (IsSetGradationSize())
+    {
+        OptGradationSize();
+    }
+
+    if (IsSetGradationHeight())
+    {
+        OptGradationHeight();
+    }
+}
+
+//------------------------------------------------------------------------------------------------------
+/**
+ * @brief DefaultGenerator creates layout generator with options of the command line.
+ * @return generator or null if options of a batch export job are invalid.
+ */
 VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 {
     //this functions covers all options found into layout setup dialog, nothing to add here, unless dialog extended
@@ -292,15 +377,12 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b || c) && x)
         {
-            qCritical() << translate("VCommandLine", "Cannot use pageformat and page explicit size/units together.")
-                        << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Cannot use pageformat and page explicit size/units together."));
         }
 
         if ((a || b || c) && !(a && b && c))
         {
-            qCritical() << translate("VCommandLine", "Page height, width, units must be used all 3 at once.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Page height, width, units must be used all 3 at once."));
         }
 
     }
@@ -312,9 +394,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Shift/Offset length must be used together with shift units.")
-                        << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Shift/Offset length must be used together with shift units."));
         }
     }
 
@@ -325,8 +405,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Gap width must be used together with shift units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Gap width must be used together with shift units."));
         }
     }
 
@@ -337,8 +416,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Left margin must be used together with page units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Left margin must be used together with page units."));
         }
     }
 
@@ -349,8 +427,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Right margin must be used together with page units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Right margin must be used together with page units."));
         }
     }
 
@@ -361,8 +438,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Top margin must be used together with page units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Top margin must be used together with page units."));
         }
     }
 
@@ -373,8 +449,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if ((a || b) && !(a && b))
         {
-            qCritical() << translate("VCommandLine", "Bottom margin must be used together with page units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Bottom margin must be used together with page units."));
         }
     }
 
@@ -385,17 +460,14 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
     {
         if (not diag.SetIncrease(rotateDegree))
         {
-            qCritical() << translate("VCommandLine", "Invalid rotation value. That must be one of predefined values.")
-                        << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Invalid rotation value. That must be one of predefined values."));
         }
     }
 
     // if present units MUST be set before any other to keep conversions correct
     if (!diag.SelectTemplate(OptPaperSize()))
     {
-        qCritical() << translate("VCommandLine", "Unknown page templated selected.") << "\n";
-        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        InvalidOption(translate("VCommandLine", "Unknown page templated selected."));
     }
 
     if (parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_PAGEH))))
@@ -403,8 +475,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
 
         if (!diag.SelectPaperUnit(parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_PAGEUNITS)))))
         {
-            qCritical() << translate("VCommandLine", "Unsupported paper units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Unsupported paper units."));
         }
 
         diag.SetPaperHeight (Pg2Px(parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_PAGEH))), diag));
@@ -415,8 +486,7 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
     {
         if (!diag.SelectLayoutUnit(parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_SHIFTUNITS)))))
         {
-            qCritical() << translate("VCommandLine", "Unsupported layout units.") << "\n";
-            const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+            InvalidOption(translate("VCommandLine", "Unsupported layout units."));
         }
     }
 
@@ -478,8 +548,17 @@ VLayoutGeneratorPtr VCommandLine::DefaultGenerator() const
         diag.SetFields(margins);
     }
 
+    if (not jobError.isEmpty())
+    {
+        return VLayoutGeneratorPtr();// invalid options of a batch export job
+    }
+
     diag.DialogAccepted(); // filling VLayoutGenerator
 
+    res->SetAttempts(OptAttempts());
+    res->SetTimeBudget(OptTimeLimit() * 1000);
+    res->SetEngine(OptEngine());
+
     return res;
 }
 
@@ -493,11 +572,58 @@ VCommandLinePtr VCommandLine::Get(const QCoreApplication& app)
     instance->parser.process(app);
 
     //fixme: in case of additional options/modes which will need to disable GUI - add it here too
-    instance->isGuiEnabled = not (instance->IsExportEnabled() || instance->IsTestModeEnabled());
+    instance->isGuiEnabled = not (instance->IsExportEnabled() || instance->IsTestModeEnabled()
+                                  || instance->IsBatchModeEnabled());
 
     return instance;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ForJob parse and check options of one batch export job. Invalid options never exit the process, the job
+ * fails alone.
+ * @param pattern path to pattern file.
+ * @param arguments export options of the job.
+ * @param error if not null, gets the message about invalid options.
+ * @return command line of the job or null if options are not valid.
+ */
+VCommandLinePtr VCommandLine::ForJob(const QString &pattern, const QStringList &arguments, QString *error)
+{
+    VCommandLinePtr job(new VCommandLine());
+
+    const QStringList jobArguments = QStringList() << QCoreApplication::applicationFilePath() << arguments << pattern;
+    if (not job->parser.parse(jobArguments))
+    {
+        if (error != nullptr)
+        {
+            *error = job->parser.errorText();
+        }
+        return VCommandLinePtr();
+    }
+
+    job->isGuiEnabled = false;
+    job->isJob = true;
+    job->CheckJobOptions();
+    if (not job->jobError.isEmpty())
+    {
+        if (error != nullptr)
+        {
+            *error = job->jobError;
+        }
+        return VCommandLinePtr();
+    }
+    return job;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief JobError returns the first invalid option of a batch export job, empty if all options are valid.
+ */
+QString VCommandLine::JobError() const
+{
+    return jobError;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VCommandLine::~VCommandLine()
 {
@@ -517,8 +643,7 @@ bool VCommandLine::IsTestModeEnabled() const
     const bool r = parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TEST)));
     if (r && parser.positionalArguments().size() != 1)
     {
-        qCritical() << translate("VCommandLine", "Test option can be used with single input file only.") << "/n";
-        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        InvalidOption(translate("VCommandLine", "Test option can be used with single input file only."));
     }
     return r;
 }
@@ -535,12 +660,35 @@ bool VCommandLine::IsExportEnabled() const
     const bool r = parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_BASENAME)));
     if (r && parser.positionalArguments().size() != 1)
     {
-        qCritical() << translate("VCommandLine", "Export options can be used with single input file only.") << "/n";
-        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        InvalidOption(translate("VCommandLine", "Export options can be used with single input file only."));
     }
     return r;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VCommandLine::IsBatchModeEnabled() const
+{
+    return parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_BATCH)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VCommandLine::OptBatchFile() const
+{
+    return parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_BATCH)));
+}
+
+//------------------------------------------------------------------------------------------------------
+int VCommandLine::OptJobs() const
+{
+    bool ok = false;
+    const int jobs = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_JOBS))).toInt(&ok);
+    if (not ok || jobs < 1)
+    {
+        InvalidOption(translate("VCommandLine", "Invalid number of processes."));
+    }
+    return jobs;
+}
+
 //------------------------------------------------------------------------------------------------------
 DialogLayoutSettings::PaperSizeTemplate VCommandLine::OptPaperSize() const
 {
@@ -581,6 +729,46 @@ Cases VCommandLine::OptGroup() const
     return static_cast<Cases>(r);
 }
 
+//------------------------------------------------------------------------------------------------------
+int VCommandLine::OptAttempts() const
+{
+    bool ok = false;
+    const int attempts = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_ATTEMPTS))).toInt(&ok);
+    if (not ok || attempts < 1)
+    {
+        InvalidOption(translate("VCommandLine", "Invalid number of layout attempts."));
+    }
+    return attempts;
+}
+
+//------------------------------------------------------------------------------------------------------
+int VCommandLine::OptTimeLimit() const
+{
+    bool ok = false;
+    const int seconds = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_TIMELIMIT))).toInt(&ok);
+    if (not ok || seconds < 0)
+    {
+        InvalidOption(translate("VCommandLine", "Invalid layout time limit."));
+    }
+    return seconds;
+}
+
+//------------------------------------------------------------------------------------------------------
+LayoutEngine VCommandLine::OptEngine() const
+{
+    const QString engine = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_ENGINE)));
+    if (engine == QLatin1String("nfp"))
+    {
+        return LayoutEngine::NoFitPolygon;
+    }
+
+    if (engine != QLatin1String("edge"))
+    {
+        InvalidOption(translate("VCommandLine", "Unknown layout engine."));
+    }
+    return LayoutEngine::EdgeToEdge;
+}
+
 //------------------------------------------------------------------------------------------------------
 QString VCommandLine::OptMeasurePath() const
 {
@@ -626,7 +814,13 @@ int VCommandLine::OptExportType() const
     int r = 0;
     if (parser.isSet(*optionsUsed.value(optionsIndex.value(LONG_OPTION_EXP2FORMAT))))
     {
-        r = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_EXP2FORMAT))).toInt();
+        bool ok = false;
+        r = parser.value(*optionsUsed.value(optionsIndex.value(LONG_OPTION_EXP2FORMAT))).toInt(&ok);
+        if (not ok || r < 0 || r >= static_cast<int>(LayoutExportFormat::COUNT))
+        {
+            InvalidOption(translate("VCommandLine", "Unknown export format."));
+            r = 0;
+        }
     }
     return r;
 }
@@ -683,8 +877,8 @@ QString VCommandLine::OptGradationSize() const
     }
     else
     {
-        qCritical() << translate("VCommandLine", "Invalid gradation size value.") << "\n";
-        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        InvalidOption(translate("VCommandLine", "Invalid gradation size value."));
+        return QString();
     }
 }
 
@@ -698,8 +892,8 @@ QString VCommandLine::OptGradationHeight() const
     }
     else
     {
-        qCritical() << translate("VCommandLine", "Invalid gradation height value.") << "\n";
-        const_cast<VCommandLine*>(this)->parser.showHelp(V_EX_USAGE);
+        InvalidOption(translate("VCommandLine", "Invalid gradation height value."));
+        return QString();
     }
 }
 
@@ -36,6 +36,7 @@
 #include <QCommandLineParser>
 
 #include "../dialogs/dialoglayoutsettings.h"
+#include "../vlayout/vlayoutdef.h"
 #include "../vmisc/vsysexits.h"
 
 class VCommandLine;
@@ -62,6 +63,15 @@ class VCommandLine
     //export enabled
     bool IsExportEnabled() const;
 
+    //@brief tests if user enabled batch export from cmd
+    bool IsBatchModeEnabled() const;
+
+    //@brief returns path to the job list of batch export
+    QString OptBatchFile() const;
+
+    //@brief returns number of processes for batch export, 1 if not set
+    int OptJobs() const;
+
     //@brief returns path to custom measure file or empty string
     QString OptMeasurePath() const;
 
@@ -94,6 +104,12 @@ class VCommandLine
     QString OptGradationSize() const;
     QString OptGradationHeight() const;
 
+    //@brief creates separate object with options of one batch export job, error gets the parser message on failure
+    static VCommandLinePtr ForJob(const QString &pattern, const QStringList &arguments, QString *error = nullptr);
+
+    //@brief returns the first invalid option of a batch export job or empty string
+    QString JobError() const;
+
 protected:
 
     VCommandLine();
@@ -105,6 +121,13 @@ class VCommandLine
 
     Cases OptGroup() const;
 
+    //@brief returns number of parallel layout attempts, 1 if not set
+    int OptAttempts() const;
+    //@brief returns layout time limit in seconds or 0 if not set
+    int OptTimeLimit() const;
+    //@brief returns layout placement engine, edge to edge if not set
+    LayoutEngine OptEngine() const;
+
     //@brief: called in destructor of application, so instance destroyed and new maybe created (never happen scenario though)
     static void Reset();
 
@@ -118,12 +141,17 @@ class VCommandLine
     VCommandLineOptions optionsUsed;
     QMap<QString, int> optionsIndex;
     bool isGuiEnabled;
+    bool isJob;
+    mutable QString jobError;
     friend class VApplication;
 
     static qreal Lo2Px(const QString& src, const DialogLayoutSettings& converter);
     static qreal Pg2Px(const QString& src, const DialogLayoutSettings& converter);
 
     static void InitOptions(VCommandLineOptions &options, QMap<QString, int> &optionsIndex);
+
+    void InvalidOption(const QString &message) const;
+    void CheckJobOptions() const;
 };
 
 #endif // VCMDEXPORT_H
@@ -67,6 +67,7 @@
 #include "../vmisc/dialogs/dialogexporttocsv.h"
 #include "undocommands/rename_draftblock.h"
 #include "core/vtooloptionspropertybrowser.h"
+#include "core/vbatchexport.h"
 #include "options.h"
 #include "../ifc/xml/vpatternconverter.h"
 #include "../vmisc/logging.h"
@@ -2471,8 +2472,9 @@ void MainWindow::showZoomToPointDialog()
  */
 void MainWindow::zoomToPoint(const QString& pointName)
 {
-    for (QHash<quint32, QSharedPointer<VGObject>>::const_iterator item = pattern->DataGObjects()->begin();
-         item != pattern->DataGObjects()->end();
+    const QHash<quint32, QSharedPointer<VGObject>> objects = pattern->DataGObjects();
+    for (QHash<quint32, QSharedPointer<VGObject>>::const_iterator item = objects.constBegin();
+         item != objects.constEnd();
          ++item)
     {
         if (item.value()->name() == pointName)
@@ -6686,7 +6688,11 @@ void MainWindow::zoomFirstShow()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-void MainWindow::DoExport(const VCommandLinePtr &expParams)
+/**
+ * @brief DoExport export loaded pattern with options of the command line.
+ * @return exit code of console export.
+ */
+int MainWindow::DoExport(const VCommandLinePtr &expParams)
 {
     const QHash<quint32, VPiece> *pieces = pattern->DataPieces();
     if(not qApp->getOpeningPattern())
@@ -6694,8 +6700,7 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         if (pieces->count() == 0)
         {
             qCCritical(vMainWindow, "%s", qUtf8Printable(tr("You can't export empty scene.")));
-            qApp->exit(V_EX_DATAERR);
-            return;
+            return V_EX_DATAERR;
         }
     }
     pieceList = preparePiecesForLayout(*pieces);
@@ -6716,13 +6721,17 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
         catch (const VException &e)
         {
             qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export error.")), qUtf8Printable(e.ErrorMessage()));
-            qApp->exit(V_EX_DATAERR);
-            return;
+            return V_EX_DATAERR;
         }
     }
     else
     {
         auto settings = expParams->DefaultGenerator();
+        if (settings == nullptr)
+        {
+            qCCritical(vMainWindow, "%s", qUtf8Printable(tr("Invalid layout options: %1").arg(expParams->JobError())));
+            return V_EX_USAGE;
+        }
         settings->SetTestAsPaths(expParams->isTextAsPaths());
 
         if (LayoutSettings(*settings.get()))
@@ -6739,17 +6748,16 @@ void MainWindow::DoExport(const VCommandLinePtr &expParams)
             catch (const VException &e)
             {
                 qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Export error.")), qUtf8Printable(e.ErrorMessage()));
-                qApp->exit(V_EX_DATAERR);
-                return;
+                return V_EX_DATAERR;
             }
         }
         else
         {
-            return;
+            return V_EX_DATAERR;
         }
     }
 
-    qApp->exit(V_EX_OK);
+    return V_EX_OK;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -6846,6 +6854,12 @@ void MainWindow::ProcessCMD()
 
     isNoScaling = cmd->IsNoScalingEnabled();
 
+    if (cmd->IsBatchModeEnabled())
+    {
+        ProcessBatch(cmd);
+        return;
+    }
+
     if (VApplication::IsGUIMode())
     {
         ReopenFilesAfterCrash(args);
@@ -6890,7 +6904,7 @@ void MainWindow::ProcessCMD()
             {
                 if (loaded && hSetted && sSetted)
                 {
-                    DoExport(cmd);
+                    qApp->exit(DoExport(cmd));
                     return; // process only one input file
                 }
                 else
@@ -6909,6 +6923,125 @@ void MainWindow::ProcessCMD()
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ProcessBatch run export jobs of a job list in one process.
+ *
+ * Jobs for the same pattern and measurements that follow each other use the loaded pattern, only the gradation is
+ * changed. A job without size or height gets the gradation the pattern was loaded with. With more than one process
+ * the list is split between copies of the program.
+ */
+void MainWindow::ProcessBatch(const VCommandLinePtr &cmd)
+{
+    QVector<VExportJob> jobs;
+    try
+    {
+        jobs = VBatchExport::ReadJobs(cmd->OptBatchFile());
+    }
+    catch (const VException &e)
+    {
+        qCCritical(vMainWindow, "%s\n\n%s", qUtf8Printable(tr("Job list error.")), qUtf8Printable(e.ErrorMessage()));
+        qApp->exit(V_EX_DATAERR);
+        return;
+    }
+
+    const int processes = cmd->OptJobs();
+    if (processes > 1 && jobs.size() > 1)
+    {
+        qApp->exit(VBatchExport::RunWorkers(jobs, processes));
+        return;
+    }
+
+    int result = V_EX_OK;
+    QString loadedPattern;
+    QString loadedMeasurements;
+    QString loadedSize;
+    QString loadedHeight;
+    for (int i = 0; i < jobs.size(); ++i)
+    {
+        const VExportJob &job = jobs.at(i);
+        qCDebug(vMainWindow, "Export job %d of %d: %s.", i + 1, jobs.size(), qUtf8Printable(job.pattern));
+
+        QString error;
+        VCommandLinePtr jobCmd = VCommandLine::ForJob(job.pattern, job.arguments, &error);
+        if (jobCmd == nullptr)
+        {
+            qCCritical(vMainWindow, "%s", qUtf8Printable(tr("Export job %1 has invalid options: %2").arg(i + 1)
+                                                         .arg(error)));
+            result = V_EX_USAGE;
+            continue;
+        }
+
+        if (not jobCmd->IsExportEnabled())
+        {
+            qCCritical(vMainWindow, "%s", qUtf8Printable(tr("Export job %1 has no base name.").arg(i + 1)));
+            result = V_EX_USAGE;
+            continue;
+        }
+
+        if (job.pattern != loadedPattern || jobCmd->OptMeasurePath() != loadedMeasurements)
+        {
+            if (not loadedPattern.isEmpty())
+            {
+                Clear();
+                loadedPattern.clear();
+            }
+
+            if (not LoadPattern(job.pattern, jobCmd->OptMeasurePath()))
+            {
+                Clear();
+                result = V_EX_NOINPUT;
+                continue;
+            }
+            loadedPattern = job.pattern;
+            loadedMeasurements = jobCmd->OptMeasurePath();
+            loadedSize.clear();
+            loadedHeight.clear();
+            if (qApp->patternType() == MeasurementsType::Multisize)
+            {
+                // The command line takes gradation in cm
+                loadedSize = QString().setNum(static_cast<int>(UnitConvertor(VContainer::size(), doc->MUnit(),
+                                                                             Unit::Cm)));
+                loadedHeight = QString().setNum(static_cast<int>(UnitConvertor(VContainer::height(), doc->MUnit(),
+                                                                               Unit::Cm)));
+            }
+        }
+
+        if (not loadedSize.isEmpty() || not loadedHeight.isEmpty())
+        {
+            const QStringList arguments = VBatchExport::WithGradation(job.arguments, loadedSize, loadedHeight);
+            jobCmd = VCommandLine::ForJob(job.pattern, arguments, &error);
+            if (jobCmd == nullptr)
+            {
+                qCCritical(vMainWindow, "%s", qUtf8Printable(tr("Export job %1 has invalid options: %2").arg(i + 1)
+                                                             .arg(error)));
+                result = V_EX_USAGE;
+                continue;
+            }
+        }
+
+        bool hSetted = true;
+        bool sSetted = true;
+        if (jobCmd->IsSetGradationSize())
+        {
+            sSetted = SetSize(jobCmd->OptGradationSize());
+        }
+
+        if (jobCmd->IsSetGradationHeight())
+        {
+            hSetted = SetHeight(jobCmd->OptGradationHeight());
+        }
+
+        const int code = hSetted && sSetted ? DoExport(jobCmd) : V_EX_DATAERR;
+        if (code != V_EX_OK)
+        {
+            result = code;
+        }
+    }
+
+    qApp->exit(result);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString MainWindow::GetPatternFileName()
 {
@@ -7103,8 +7236,9 @@ bool MainWindow::IgnoreLocking(int error, const QString &path)
 QStringList MainWindow::draftPointNamesList()
 {
     QStringList pointNames;
-    for (QHash<quint32, QSharedPointer<VGObject>>::const_iterator item = pattern->DataGObjects()->begin();
-         item != pattern->DataGObjects()->end();
+    const QHash<quint32, QSharedPointer<VGObject>> objects = pattern->DataGObjects();
+    for (QHash<quint32, QSharedPointer<VGObject>>::const_iterator item = objects.constBegin();
+         item != objects.constEnd();
          ++item)
     {
         if (item.value()->getType() == GOType::Point && !pointNames.contains(item.value()->name()))
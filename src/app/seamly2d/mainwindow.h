@@ -422,7 +422,8 @@ private slots:
     void               CheckRequiredMeasurements(const VMeasurements *m);
 
     void               ReopenFilesAfterCrash(QStringList &args);
-    void               DoExport(const VCommandLinePtr& expParams);
+    int                DoExport(const VCommandLinePtr& expParams);
+    void               ProcessBatch(const VCommandLinePtr &cmd);
 
     bool               SetSize(const QString &text);
     bool               SetHeight(const QString & text);
@@ -53,6 +53,7 @@
 #include "mainwindowsnogui.h"
 #include "core/vapplication.h"
 #include "../vpatterndb/vcontainer.h"
+#include "../vmisc/vfunctiontask.h"
 #include "../vobj/vobjpaintdevice.h"
 #include "../vdxf/vdxfpaintdevice.h"
 #include "dialogs/dialoglayoutsettings.h"
@@ -61,6 +62,8 @@
 #include "dialogs/dialoglayoutprogress.h"
 #include "dialogs/export_layout_dialog.h"
 #include "../vlayout/vposter.h"
+#include "../vlayout/vtiledraster.h"
+#include "../vlayout/vlayoutsheet.h"
 #include "../vpatterndb/floatItemData/vpiecelabeldata.h"
 #include "../vpatterndb/floatItemData/vpatternlabeldata.h"
 #include "../vpatterndb/floatItemData/vgrainlinedata.h"
@@ -78,7 +81,14 @@
 #include <QPrintPreviewDialog>
 #include <QPrintDialog>
 #include <QPrinterInfo>
-#include <QImageWriter>
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+#include <QThreadPool>
+#include <atomic>
+#include <exception>
 
 #ifdef Q_OS_WIN
 #   define PDFTOPS "pdftops.exe"
@@ -86,8 +96,11 @@
 #   define PDFTOPS "pdftops"
 #endif
 
+Q_LOGGING_CATEGORY(vMainNoGUIWindow, "v.mainnoguiwindow")
+
 namespace
 {
+//---------------------------------------------------------------------------------------------------------------------
 bool CreateLayoutPath(const QString &path)
 {
     bool usedNotExistedDir = true;
@@ -108,6 +121,32 @@ void RemoveLayoutPath(const QString &path, bool usedNotExistedDir)
         dir.rmpath(".");
     }
 }
+
+/** @brief Memory for whole sheet images that are encoded at the same time. */
+const qint64 maxSheetImagesMemory = 1024 * 1024 * 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RasterFormat returns the image format name of a raster export format, or an empty array for other formats.
+ */
+QByteArray RasterFormat(LayoutExportFormat format)
+{
+    switch (format)
+    {
+        case LayoutExportFormat::PNG:
+            return QByteArrayLiteral("PNG");
+        case LayoutExportFormat::JPG:
+            return QByteArrayLiteral("JPG");
+        case LayoutExportFormat::BMP:
+            return QByteArrayLiteral("BMP");
+        case LayoutExportFormat::TIF:
+            return QByteArrayLiteral("TIF");
+        case LayoutExportFormat::PPM:
+            return QByteArrayLiteral("PPM");
+        default:
+            return QByteArray();
+    }
+}
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -771,20 +810,95 @@ void MainWindowsNoGUI::refreshSeamAllowances()
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief preparePiecesForLayout converts pattern pieces to layout pieces.
+ *
+ * Pieces are independent, so they are created on a thread pool. Tools are looked up before the workers start, workers
+ * only read the piece and its data. The result keeps the order of the hash. If several pieces fail, the exception of
+ * the first one in this order is rethrown.
+ */
 QVector<VLayoutPiece> MainWindowsNoGUI::preparePiecesForLayout(const QHash<quint32, VPiece> &pieces)
 {
     QVector<VLayoutPiece> pieceList;
-    if (not pieces.isEmpty())
+    if (pieces.isEmpty())
+    {
+        return pieceList;
+    }
+
+    QVector<const VPiece *> piecesData;
+    QVector<const VContainer *> containers;
+    piecesData.reserve(pieces.size());
+    containers.reserve(pieces.size());
+
+    QHash<quint32, VPiece>::const_iterator i = pieces.constBegin();
+    while (i != pieces.constEnd())
+    {
+        VAbstractTool *tool = qobject_cast<VAbstractTool*>(VAbstractPattern::getTool(i.key()));
+        SCASSERT(tool != nullptr)
+        piecesData.append(&i.value());
+        containers.append(tool->getData());
+        ++i;
+    }
+
+    const int count = piecesData.size();
+    pieceList.resize(count);
+    QVector<qint64> elapsed(count, 0);
+
+    // Detach once here, workers write only to own items
+    VLayoutPiece *results = pieceList.data();
+    qint64 *times = elapsed.data();
+
+    std::atomic_int nextPiece(0);
+    QMutex errorMutex;
+    int errorIndex = count;
+    std::exception_ptr error;
+
+    QElapsedTimer total;
+    total.start();
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMin(count, qMax(1, QThread::idealThreadCount())));
+    for (int t = 0; t < pool.maxThreadCount(); ++t)
     {
-        QHash<quint32, VPiece>::const_iterator i = pieces.constBegin();
-        while (i != pieces.constEnd())
+        pool.start(new VFunctionTask([&]()
         {
-            VAbstractTool *tool = qobject_cast<VAbstractTool*>(VAbstractPattern::getTool(i.key()));
-            SCASSERT(tool != nullptr)
-            pieceList.append(VLayoutPiece::Create(i.value(), tool->getData()));
-            ++i;
-        }
+            for (int index = nextPiece++; index < count; index = nextPiece++)
+            {
+                QElapsedTimer timer;
+                timer.start();
+                try
+                {
+                    results[index] = VLayoutPiece::Create(*piecesData.at(index), containers.at(index));
+                }
+                catch (...)
+                {
+                    // Keep the original object, clone() would slice VException subclasses. Nothing may leave the
+                    // runnable, an exception there terminates the application.
+                    QMutexLocker locker(&errorMutex);
+                    if (index < errorIndex)
+                    {
+                        errorIndex = index;
+                        error = std::current_exception();
+                    }
+                }
+                times[index] = timer.elapsed();
+            }
+        }));
+    }
+    pool.waitForDone();
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    for (int index = 0; index < count; ++index)
+    {
+        qCDebug(vMainNoGUIWindow, "Piece '%s' prepared in %lld ms.", qUtf8Printable(piecesData.at(index)->GetName()),
+                elapsed.at(index));
     }
+    qCDebug(vMainNoGUIWindow, "%d pieces prepared in %lld ms on %d threads.", count, total.elapsed(),
+            pool.maxThreadCount());
 
     return pieceList;
 }
@@ -912,14 +1026,7 @@ void MainWindowsNoGUI::exportSVG(const QString &name, QGraphicsRectItem *paper,
  */
 void MainWindowsNoGUI::exportPNG(const QString &fileName,  QGraphicsScene *scene) const
 {
-    QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::transparent);                                              // Start all pixels transparent
-    QPainter painter(&image);
-    painter.setFont(qApp->Seamly2DSettings()->getLabelFont());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setBrush ( QBrush ( Qt::NoBrush ) );
-    scene->render(&painter);
-    image.save(fileName, "PNG", qApp->Seamly2DSettings()->getExportQuality());
+    exportRaster(fileName, scene, "PNG", Qt::transparent);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -929,19 +1036,7 @@ void MainWindowsNoGUI::exportPNG(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportTIF(const QString &fileName,  QGraphicsScene *scene) const
 {
-    QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::transparent);                                              // Start all pixels transparent
-    QPainter painter(&image);
-    painter.setFont(qApp->Seamly2DSettings()->getLabelFont());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setBrush ( QBrush ( Qt::NoBrush ) );
-    scene->render(&painter);
-
-    QImageWriter writer;
-    writer.setFormat("TIF");
-    writer.setCompression(1);
-    writer.setFileName(fileName);
-    writer.write(image);
+    exportRaster(fileName, scene, "TIF", Qt::transparent);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -951,14 +1046,7 @@ void MainWindowsNoGUI::exportTIF(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportJPG(const QString &fileName,  QGraphicsScene *scene) const
 {
-    QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::white);                                              // Start all pixels transparent
-    QPainter painter(&image);
-    painter.setFont(qApp->Seamly2DSettings()->getLabelFont());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setBrush ( QBrush ( Qt::NoBrush ) );
-    scene->render(&painter);
-    image.save(fileName, "JPG", qApp->Seamly2DSettings()->getExportQuality());
+    exportRaster(fileName, scene, "JPG", Qt::white);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -968,31 +1056,35 @@ void MainWindowsNoGUI::exportJPG(const QString &fileName,  QGraphicsScene *scene
  */
 void MainWindowsNoGUI::exportBMP(const QString &fileName,  QGraphicsScene *scene) const
 {
-    QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::white);                                              // Start all pixels transparent
-    QPainter painter(&image);
-    painter.setFont(qApp->Seamly2DSettings()->getLabelFont());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setBrush ( QBrush ( Qt::NoBrush ) );
-    scene->render(&painter);
-    image.save(fileName, "BMP", qApp->Seamly2DSettings()->getExportQuality());
+    exportRaster(fileName, scene, "BMP", Qt::white);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief exportPPM save layout to gif file.
+ * @brief exportPPM save layout to ppm file.
  * @param fileName name layout file.
  */
 void MainWindowsNoGUI::exportPPM(const QString &fileName,  QGraphicsScene *scene) const
 {
-    QImage image(scene->sceneRect().size().toSize(), QImage::Format_ARGB32);
-    image.fill(Qt::transparent);                                              // Start all pixels transparent
-    QPainter painter(&image);
-    painter.setFont(qApp->Seamly2DSettings()->getLabelFont());
-    painter.setRenderHint(QPainter::Antialiasing, true);
-    painter.setBrush ( QBrush ( Qt::NoBrush ) );
-    scene->render(&painter);
-    image.save(fileName, "PPM", qApp->Seamly2DSettings()->getExportQuality());
+    exportRaster(fileName, scene, "PPM", Qt::transparent);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief exportRaster renders the layout in strips on worker threads and writes it to a raster file.
+ * @param fileName name layout file.
+ * @param format image format.
+ * @param background color the image starts with.
+ */
+void MainWindowsNoGUI::exportRaster(const QString &fileName, QGraphicsScene *scene, const QByteArray &format,
+                                    const QColor &background) const
+{
+    VTiledRaster raster(scene, background, qApp->Seamly2DSettings()->getLabelFont());
+    raster.SetQuality(qApp->Seamly2DSettings()->getExportQuality());
+    if (not raster.Write(fileName, format))
+    {
+        qCritical() << tr("Can't export layout to %1: %2").arg(fileName, raster.ErrorString());
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1163,7 +1255,7 @@ QT_WARNING_DISABLE_GCC("-Wswitch-default")
 void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary, QGraphicsRectItem *paper,
                                QGraphicsScene *scene, const QList<QList<QGraphicsItem *> > &pieces) const
 {
-    PrepareTextForDXF(endStringPlaceholder, pieces);
+    const QList<QFont> fonts = PrepareTextForDXF(endStringPlaceholder, pieces);
     VDxfPaintDevice generator;
     generator.setFileName(name);
     generator.setSize(paper->rect().size().toSize());
@@ -1171,6 +1263,11 @@ void MainWindowsNoGUI::FlatDxfFile(const QString &name, int version, bool binary
     generator.SetVersion(static_cast<DRW::Version>(version));
     generator.SetBinaryFormat(binary);
     generator.setInsunits(VarInsunits::Millimeters);// Decided to always use mm. See issue #745
+    generator.SetStreaming(true);
+    for (int i = 0; i < fonts.size(); ++i)
+    {
+        generator.AddFont(fonts.at(i));
+    }
 
     QPainter painter;
     if (painter.begin(&generator))
@@ -1192,6 +1289,7 @@ void MainWindowsNoGUI::AAMADxfFile(const QString &name, int version, bool binary
     generator.SetVersion(static_cast<DRW::Version>(version));
     generator.SetBinaryFormat(binary);
     generator.setInsunits(VarInsunits::Millimeters);// Decided to always use mm. See issue #745
+    generator.SetStreaming(true);
     generator.ExportToAAMA(pieces);
 }
 
@@ -1233,10 +1331,12 @@ void MainWindowsNoGUI::RestorePaper(int index) const
  * placeholder. This method append it.
  *
  * @param placeholder placeholder that will be appended to each QGraphicsSimpleTextItem item's text string.
+ * @return fonts used by the text items.
  */
-void MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
-                                         const QList<QList<QGraphicsItem *> > &pieces) const
+QList<QFont> MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
+                                                 const QList<QList<QGraphicsItem *> > &pieces) const
 {
+    QList<QFont> fonts;
     for (int i = 0; i < pieces.size(); ++i)
     {
         const QList<QGraphicsItem *> &paperItems = pieces.at(i);
@@ -1251,11 +1351,16 @@ void MainWindowsNoGUI::PrepareTextForDXF(const QString &placeholder,
                     if(QGraphicsSimpleTextItem *textItem = qgraphicsitem_cast<QGraphicsSimpleTextItem *>(item))
                     {
                         textItem->setText(textItem->text() + placeholder);
+                        if (not fonts.contains(textItem->font()))
+                        {
+                            fonts.append(textItem->font());
+                        }
                     }
                 }
             }
         }
     }
+    return fonts;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1605,6 +1710,13 @@ void MainWindowsNoGUI::ExportScene(const ExportLayoutDialog &dialog, const QList
                                    const QList<QList<QGraphicsItem *> > &pieces, bool ignoreMargins,
                                    const QMarginsF &margins) const
 {
+    if (dialog.mode() == Draw::Layout && piecesOnLayout.size() == papers.size()
+            && (dialog.format() == LayoutExportFormat::SVG || not RasterFormat(dialog.format()).isEmpty()))
+    {
+        ExportSheets(dialog, papers);
+        return;
+    }
+
     for (int i=0; i < scenes.size(); ++i)
     {
         QString increment  = QStringLiteral("");
@@ -1723,6 +1835,132 @@ void MainWindowsNoGUI::ExportScene(const ExportLayoutDialog &dialog, const QList
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ExportSheets exports layout sheets to SVG or raster files, one sheet per worker thread. The sheets are
+ * painted from the layout pieces, the layout scenes are not used.
+ */
+void MainWindowsNoGUI::ExportSheets(const ExportLayoutDialog &dialog, const QList<QGraphicsItem *> &papers) const
+{
+    QVector<QSharedPointer<VLayoutSheet>> sheets;
+    QStringList names;
+    for (int i = 0; i < papers.size(); ++i)
+    {
+        const QGraphicsRectItem *paper = qgraphicsitem_cast<QGraphicsRectItem *>(papers.at(i));
+        SCASSERT(paper != nullptr)
+
+        names.append(QString("%1/%2_0%3%4")
+                     .arg(dialog.path())                                             //1
+                     .arg(dialog.fileName())                                         //2
+                     .arg(QString::number(i+1))                                      //3
+                     .arg(ExportLayoutDialog::exportFormatSuffix(dialog.format()))); //4
+
+        // Piece items read the settings, so they are built here in the GUI thread
+        sheets.append(QSharedPointer<VLayoutSheet>(new VLayoutSheet(paper->rect(), piecesOnLayout.at(i),
+                                                                    dialog.isTextAsPaths())));
+    }
+
+    const LayoutExportFormat format = dialog.format();
+    const QByteArray rasterFormat = RasterFormat(format);
+    const QColor background = (format == LayoutExportFormat::JPG || format == LayoutExportFormat::BMP)
+            ? QColor(Qt::white) : QColor(Qt::transparent);
+    const QFont labelFont = qApp->Seamly2DSettings()->getLabelFont();
+    const int quality = qApp->Seamly2DSettings()->getExportQuality();
+    const QString description = doc->GetDescription();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QMutex errorMutex;
+    QStringList errors;
+    std::atomic<int> nextSheet(0);
+    const int count = sheets.size();
+
+    const int idealThreads = qMax(1, QThread::idealThreadCount());
+    int threads = qMin(count, idealThreads);
+    if (not rasterFormat.isEmpty() && not VTiledRaster::IsStreamed(rasterFormat))
+    {
+        // PNG and JPG keep a whole image of the sheet for the encoder, limit how many exist at once
+        qint64 imageSize = 1;
+        for (int i = 0; i < count; ++i)
+        {
+            const QSize size = sheets.at(i)->PaperRect().size().toSize();
+            imageSize = qMax(imageSize, static_cast<qint64>(size.width()) * size.height() * 4);
+        }
+        threads = static_cast<int>(qBound(qint64(1), maxSheetImagesMemory / imageSize, qint64(threads)));
+    }
+    // Cores the sheets leave free render strips
+    const int stripThreads = qMax(1, idealThreads / qMax(1, threads));
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(threads);
+    for (int t = 0; t < pool.maxThreadCount(); ++t)
+    {
+        pool.start(new VFunctionTask([&]()
+        {
+            for (int index = nextSheet++; index < count; index = nextSheet++)
+            {
+                const QSharedPointer<VLayoutSheet> &sheet = sheets.at(index);
+                const QRectF rect = sheet->PaperRect();
+                QString error;
+
+                if (format == LayoutExportFormat::SVG)
+                {
+                    QSvgGenerator generator;
+                    generator.setFileName(names.at(index));
+                    generator.setSize(rect.size().toSize());
+                    generator.setViewBox(rect);
+                    generator.setTitle(tr("Pattern"));
+                    generator.setDescription(description);
+                    generator.setResolution(static_cast<int>(PrintDPI));
+
+                    QPainter painter;
+                    if (painter.begin(&generator))
+                    {
+                        painter.setFont(QFont("Arial", 8, QFont::Normal));
+                        painter.setRenderHint(QPainter::Antialiasing, true);
+                        painter.setBrush(QBrush(Qt::NoBrush));
+                        sheet->Paint(&painter, rect, false); // The scene path hid the paper for SVG
+                        painter.end();
+                    }
+                    else
+                    {
+                        error = tr("Can't open file %1").arg(names.at(index));
+                    }
+                }
+                else
+                {
+                    const QSize size = rect.size().toSize();
+                    VTiledRaster raster(size, [&sheet, size](QPainter *painter)
+                    {
+                        sheet->Paint(painter, QRectF(QPointF(), QSizeF(size)), true);
+                    }, background, labelFont);
+                    raster.SetQuality(quality);
+                    raster.SetThreadCount(stripThreads);
+                    if (not raster.Write(names.at(index), rasterFormat))
+                    {
+                        error = raster.ErrorString();
+                    }
+                }
+
+                if (not error.isEmpty())
+                {
+                    QMutexLocker locker(&errorMutex);
+                    errors.append(tr("Can't export layout to %1: %2").arg(names.at(index), error));
+                }
+            }
+        }));
+    }
+    pool.waitForDone();
+
+    qCDebug(vMainNoGUIWindow, "Exported %d sheets in %lld ms.", count, timer.elapsed());
+
+    for (int i = 0; i < errors.size(); ++i)
+    {
+        qCritical() << errors.at(i);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString MainWindowsNoGUI::FileName() const
 {
@@ -1734,20 +1972,20 @@ QString MainWindowsNoGUI::FileName() const
 //---------------------------------------------------------------------------------------------------------------------
 void MainWindowsNoGUI::SetSizeHeightForIndividualM() const
 {
-    const QHash<QString, QSharedPointer<VInternalVariable> > * vars = pattern->DataVariables();
+    const QHash<QString, QSharedPointer<VInternalVariable> > vars = pattern->DataVariables();
 
-    if (vars->contains(size_M))
+    if (vars.contains(size_M))
     {
-        VContainer::SetSize(*vars->value(size_M)->GetValue());
+        VContainer::SetSize(*vars.value(size_M)->GetValue());
     }
     else
     {
         VContainer::SetSize(0);
     }
 
-    if (vars->contains(height_M))
+    if (vars.contains(height_M))
     {
-        VContainer::SetHeight(*vars->value(height_M)->GetValue());
+        VContainer::SetHeight(*vars.value(height_M)->GetValue());
     }
     else
     {
@@ -53,6 +53,8 @@
 #ifndef MAINWINDOWSNOGUI_H
 #define MAINWINDOWSNOGUI_H
 
+#include <QColor>
+#include <QFont>
 #include <QMainWindow>
 #include <QPrinter>
 #include <QToolButton>
@@ -89,6 +91,8 @@ public slots:
     void exportJPG(const QString &name, QGraphicsScene *scene)const;
     void exportBMP(const QString &name, QGraphicsScene *scene)const;
     void exportPPM(const QString &name, QGraphicsScene *scene)const;
+    void exportRaster(const QString &name, QGraphicsScene *scene, const QByteArray &format,
+                      const QColor &background)const;
     void exportPDF(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene, bool ignoreMargins,
                    const QMarginsF &margins)const;
     void exportEPS(const QString &name, QGraphicsRectItem *paper, QGraphicsScene *scene, bool ignoreMargins,
@@ -168,7 +172,7 @@ private slots:
     void PreparePaper(int index) const;
     void RestorePaper(int index) const;
 
-    void PrepareTextForDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
+    QList<QFont> PrepareTextForDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
     void RestoreTextAfterDXF(const QString &placeholder, const QList<QList<QGraphicsItem *> > &pieces) const;
 
     void PrintPreview();
@@ -190,6 +194,8 @@ private slots:
                      const QList<QList<QGraphicsItem *> > &pieces,
                      bool ignoreMargins, const QMarginsF &margins) const;
 
+    void ExportSheets(const ExportLayoutDialog &dialog, const QList<QGraphicsItem *> &papers) const;
+
     void ExportApparelLayout(const ExportLayoutDialog &dialog, const QVector<VLayoutPiece> &pieces, const QString &name,
                              const QSize &size) const;
 
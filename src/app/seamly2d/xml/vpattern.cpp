@@ -182,6 +182,7 @@ void VPattern::Parse(const Document &parse)
                                      << TagPatternName << TagPatternNum << TagCompanyName << TagCustomerName
                                      << TagPatternLabel;
     PrepareForParse(parse);
+    dependencies.BeginPass();
     QDomNode domNode = documentElement().firstChild();
     while (domNode.isNull() == false)
     {
@@ -741,14 +742,6 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
     {
         scene = pieceScene;
     }
-    const QStringList tags = QStringList() << TagPoint
-                                           << TagLine
-                                           << TagSpline
-                                           << TagArc
-                                           << TagTools
-                                           << TagOperation
-                                           << TagElArc
-                                           << TagPath;
     const QDomNodeList nodeList = node.childNodes();
     const qint32 num = nodeList.size();
     for (qint32 i = 0; i < num; ++i)
@@ -756,48 +749,78 @@ void VPattern::ParseDrawMode(const QDomNode &node, const Document &parse, const
         QDomElement domElement = nodeList.at(i).toElement();
         if (domElement.isNull() == false)
         {
-            switch (tags.indexOf(domElement.tagName()))
+            if (mode == Draw::Calculation)
             {
-                case 0: // TagPoint
-                    qCDebug(vXML, "Tag point.");
-                    ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 1: // TagLine
-                    qCDebug(vXML, "Tag line.");
-                    ParseLineElement(scene, domElement, parse);
-                    break;
-                case 2: // TagSpline
-                    qCDebug(vXML, "Tag spline.");
-                    ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 3: // TagArc
-                    qCDebug(vXML, "Tag arc.");
-                    ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 4: // TagTools
-                    qCDebug(vXML, "Tag tools.");
-                    ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 5: // TagOperation
-                    qCDebug(vXML, "Tag operation.");
-                    ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 6: // TagElArc
-                    qCDebug(vXML, "Tag elliptical arc.");
-                    ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
-                    break;
-                case 7: // TagPath
-                    qCDebug(vXML, "Tag path.");
-                    ParsePathElement(scene, domElement, parse);
-                    break;
-                default:
-                    VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
-                    throw e;
+                ParseCalculationTool(domElement, parse, data, [this, scene, &domElement, &parse]()
+                {
+                    ParseToolElement(scene, domElement, parse);
+                });
+            }
+            else
+            {
+                ParseToolElement(scene, domElement, parse);
             }
         }
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseToolElement parse tool tag of a draw block.
+ * @param scene scene.
+ * @param domElement tag in xml tree.
+ * @param parse parser file mode.
+ */
+void VPattern::ParseToolElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse)
+{
+    const QStringList tags = QStringList() << TagPoint
+                                           << TagLine
+                                           << TagSpline
+                                           << TagArc
+                                           << TagTools
+                                           << TagOperation
+                                           << TagElArc
+                                           << TagPath;
+    switch (tags.indexOf(domElement.tagName()))
+    {
+        case 0: // TagPoint
+            qCDebug(vXML, "Tag point.");
+            ParsePointElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 1: // TagLine
+            qCDebug(vXML, "Tag line.");
+            ParseLineElement(scene, domElement, parse);
+            break;
+        case 2: // TagSpline
+            qCDebug(vXML, "Tag spline.");
+            ParseSplineElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 3: // TagArc
+            qCDebug(vXML, "Tag arc.");
+            ParseArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 4: // TagTools
+            qCDebug(vXML, "Tag tools.");
+            ParseToolsElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 5: // TagOperation
+            qCDebug(vXML, "Tag operation.");
+            ParseOperationElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 6: // TagElArc
+            qCDebug(vXML, "Tag elliptical arc.");
+            ParseEllipticalArcElement(scene, domElement, parse, domElement.attribute(AttrType, ""));
+            break;
+        case 7: // TagPath
+            qCDebug(vXML, "Tag path.");
+            ParsePathElement(scene, domElement, parse);
+            break;
+        default:
+            VException e(tr("Wrong tag name '%1'.").arg(domElement.tagName()));
+            throw e;
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief parsePieceElement parse piece tag.
@@ -1192,6 +1215,7 @@ void VPattern::parseCurrentDraftBlock()
     QDomElement domElement;
     if (getActiveDraftElement(domElement))
     {
+        dependencies.BeginPass();
         parseDraftBlockElement(domElement, Document::LiteParse);
     }
     emit CheckLayout();
@@ -3061,8 +3085,7 @@ qreal VPattern::EvalFormula(VContainer *data, const QString &formula, bool *ok)
             // Replace line return character with spaces for calc if exist
             QString f = formula;
             f.replace("\n", " ");
-            QScopedPointer<Calculator> cal(new Calculator());
-            const qreal result = cal->EvalFormula(data->DataVariables(), f);
+            const qreal result = Calculator::EvalCachedFormula(data->FormulaVariables(), f);
 
             (qIsInf(result) || qIsNaN(result)) ? *ok = false : *ok = true;
             return result;
@@ -3132,6 +3155,7 @@ void VPattern::GarbageCollector()
                     else
                     { // Parent was deleted. We do not need this object anymore
                         modElement.removeChild(modNode);
+                        UnregisterElement(modNode);
                     }
                 }
                 else
@@ -3908,6 +3932,7 @@ void VPattern::PrepareForParse(const Document &parse)
         toolsOnRemove.clear();
 
         tools.clear();
+        dependencies.Clear();
         cursor = 0;
         history.clear();
     }
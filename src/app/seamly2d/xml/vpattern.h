@@ -139,6 +139,7 @@ public slots:
 
     void           parseDraftBlockElement(const QDomNode &node, const Document &parse);
     void           ParseDrawMode(const QDomNode &node, const Document &parse, const Draw &mode);
+    void           ParseToolElement(VMainGraphicsScene *scene, QDomElement &domElement, const Document &parse);
     void           parsePieceElement(QDomElement &domElement, const Document &parse);
     void           parsePieceNodes(const QDomElement &domElement, VPiece &piece, qreal width, bool closed) const;
     void           ParsePieceDataTag(const QDomElement &domElement, VPiece &piece) const;
@@ -1518,7 +1518,7 @@ void TMainWindow::ShowNewMData(bool fresh)
 			ui->doubleSpinBoxInHeights->blockSignals(true);
 
 			const QString postfix = UnitsToStr(pUnit);//Show unit in dialog label (cm, mm or inch)
-			const qreal value = UnitConvertor(*data->DataVariables()->value(meash->GetName())->GetValue(), mUnit,
+			const qreal value = UnitConvertor(*data->DataVariables().value(meash->GetName())->GetValue(), mUnit,
 											  pUnit);
 			ui->labelCalculatedValue->setText(qApp->LocaleToString(value) + " " +postfix);
 
@@ -2481,7 +2481,7 @@ void TMainWindow::RefreshTable(bool freshCall)
 				AddCell(qApp->TrVars()->GuiText(meash->GetName()), currentRow, ColumnFullName, Qt::AlignVCenter);
 			}
 
-			const qreal value = UnitConvertor(*data->DataVariables()->value(meash->GetName())->GetValue(), mUnit,
+			const qreal value = UnitConvertor(*data->DataVariables().value(meash->GetName())->GetValue(), mUnit,
 											  pUnit);
 			AddCell(locale().toString(value), currentRow, ColumnCalcValue,
 					Qt::AlignHCenter | Qt::AlignVCenter, meash->IsFormulaOk()); // calculated value
@@ -71,6 +71,8 @@
 #include "../exception/vexceptionwrongid.h"
 #include "vdomdocument.h"
 
+bool VAbstractConverter::strictValidation = false;
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractConverter::VAbstractConverter(const QString &fileName)
     : VDomDocument(),
@@ -112,6 +114,9 @@ QString VAbstractConverter::Convert()
 
     m_ver < MaxVer() ? ApplyPatches() : DowngradeToCurrentMaxVersion();
 
+    // All steps worked on the document in memory, write the result only once.
+    WriteConvertedFile();
+
     return m_convertedFileName;
 }
 
@@ -180,6 +185,21 @@ int VAbstractConverter::GetVersion(const QString &version)
     return (major<<16)|(minor<<8)|(patch);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+bool VAbstractConverter::IsStrictValidation()
+{
+    return strictValidation;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStrictValidation validate the document after each conversion step, not only the result.
+ */
+void VAbstractConverter::SetStrictValidation(bool strict)
+{
+    strictValidation = strict;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QString VAbstractConverter::removeVersionNumber(const QString& fileName)
 {
@@ -396,6 +416,9 @@ void VAbstractConverter::ValidateInputFile(const QString &currentSchema) const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Save finish a conversion step. The document stays in memory until the conversion is done.
+ */
 void VAbstractConverter::Save()
 {
     try
@@ -408,7 +431,11 @@ void VAbstractConverter::Save()
         VException ex(tr("Error no unique id."));
         throw ex;
     }
+}
 
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractConverter::WriteConvertedFile()
+{
     m_tmpFile.resize(0);//clear previous content
     const int indent = 4;
     QTextStream out(&m_tmpFile);
@@ -422,6 +449,20 @@ void VAbstractConverter::Save()
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidateConvertedVersion validate the document after converting to version ver.
+ *
+ * Intermediate versions are checked only in strict mode. The last version is always checked.
+ */
+void VAbstractConverter::ValidateConvertedVersion(int ver) const
+{
+    if (strictValidation or ver == MaxVer())
+    {
+        ValidateDocument(XSDSchema(ver), m_convertedFileName);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractConverter::SetVersion(const QString &version)
 {
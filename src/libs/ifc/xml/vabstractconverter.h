@@ -84,6 +84,9 @@ class VAbstractConverter :public VDomDocument
 
     static int      GetVersion(const QString &version);
 
+    static bool     IsStrictValidation();
+    static void     SetStrictValidation(bool strict);
+
 protected:
     int             m_ver;
     QString         m_convertedFileName;
@@ -92,6 +95,7 @@ class VAbstractConverter :public VDomDocument
     Q_NORETURN void InvalidVersion(int ver) const;
     void            Save();
     void            SetVersion(const QString &version);
+    void            ValidateConvertedVersion(int ver) const;
 
     virtual int     MinVer() const =0;
     virtual int     MaxVer() const =0;
@@ -115,8 +119,12 @@ class VAbstractConverter :public VDomDocument
 
     QTemporaryFile  m_tmpFile;
 
+    static bool     strictValidation;
+
     static void     ValidateVersion(const QString &version);
 
+    void            WriteConvertedFile();
+
     void            ReserveFile() const;
 
     /**
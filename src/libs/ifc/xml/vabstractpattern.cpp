@@ -52,6 +52,7 @@
 
 #include "vabstractpattern.h"
 
+#include <QDomNamedNodeMap>
 #include <QDomNode>
 #include <QDomNodeList>
 #include <QLatin1String>
@@ -259,6 +260,7 @@ VAbstractPattern::VAbstractPattern(QObject *parent)
     ,  history(QVector<VToolRecord>())
     ,  patternPieces(QStringList())
      , modified(false)
+     , dependencies()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -793,6 +795,86 @@ VPieceNode VAbstractPattern::ParseSANode(const QDomElement &domElement)
     return node;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ElementSignature hash of a tool element with all its attributes and children.
+ *
+ * Any change of tool options through the file changes the signature. Attributes are combined regardless of their
+ * order.
+ */
+quint64 VAbstractPattern::ElementSignature(const QDomElement &domElement)
+{
+    quint64 attributesHash = 0;
+    const QDomNamedNodeMap attributes = domElement.attributes();
+    for (int i = 0; i < attributes.count(); ++i)
+    {
+        const QDomNode attribute = attributes.item(i);
+        const uint valueHash = qHash(attribute.nodeValue());
+        const quint64 hash = (static_cast<quint64>(qHash(attribute.nodeName(), valueHash)) << 32)
+                             | qHash(attribute.nodeValue(), qHash(attribute.nodeName()));
+        attributesHash += hash;
+    }
+
+    quint64 signature = (static_cast<quint64>(qHash(domElement.tagName())) << 32) ^ attributesHash;
+
+    QDomElement child = domElement.firstChildElement();
+    while (not child.isNull())
+    {
+        signature = signature * 1099511628211ULL + ElementSignature(child);
+        child = child.nextSiblingElement();
+    }
+
+    return signature;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ParseCalculationTool parse one tool of a calculation block and record it in the dependency graph.
+ *
+ * During lite parse a tool that nothing upstream has changed gets its last result back instead of being calculated
+ * again.
+ * @param domElement tool tag.
+ * @param parse parser file mode.
+ * @param data container with variables.
+ * @param parseTool creates or updates the tool.
+ */
+void VAbstractPattern::ParseCalculationTool(const QDomElement &domElement, const Document &parse, VContainer *data,
+                                            const std::function<void()> &parseTool)
+{
+    SCASSERT(data != nullptr)
+
+    const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+    if (id == NULL_ID)
+    {
+        parseTool();
+        return;
+    }
+
+    const quint64 signature = ElementSignature(domElement);
+    if (parse != Document::FullParse and dependencies.IsUpToDate(id, signature, data))
+    {
+        dependencies.Replay(id, data);
+        VContainer::UpdateId(id);
+        if (tools.contains(id))
+        {
+            UpdateToolData(id, data);
+        }
+        return;
+    }
+
+    dependencies.BeginTool(id, signature);
+    try
+    {
+        parseTool();
+    }
+    catch (...)
+    {
+        dependencies.AbortTool();
+        throw;
+    }
+    dependencies.EndTool();
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VAbstractPattern::AddToolOnRemove(VDataTool *tool)
 {
@@ -63,8 +63,10 @@
 #include <QStringList>
 #include <QVector>
 #include <QtGlobal>
+#include <functional>
 
 #include "../vmisc/def.h"
+#include "../vpatterndb/vdependencygraph.h"
 #include "vdomdocument.h"
 #include "vtoolrecord.h"
 
@@ -424,6 +426,9 @@ public slots:
     /** @brief modified keep state of the document for cases that do not cover QUndoStack*/
     mutable bool   modified;
 
+    /** @brief dependencies inputs and outputs of calculation tools. */
+    VDependencyGraph dependencies;
+
     /** @brief tools list with pointer on tools. */
     static QHash<quint32, VDataTool*> tools;
     /** @brief patternLabelLines list to speed up reading a template by many pieces. */
@@ -433,6 +438,10 @@ public slots:
     static void       ToolExists(const quint32 &id);
     static VPiecePath ParsePathNodes(const QDomElement &domElement);
     static VPieceNode ParseSANode(const QDomElement &domElement);
+    static quint64    ElementSignature(const QDomElement &domElement);
+
+    void              ParseCalculationTool(const QDomElement &domElement, const Document &parse, VContainer *data,
+                                           const std::function<void()> &parseTool);
 
     void              setActiveDraftBlock(const QString &name);
 
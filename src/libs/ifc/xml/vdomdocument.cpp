@@ -68,6 +68,7 @@
 #include <QDomNodeList>
 #include <QDomText>
 #include <QFile>
+#include <QHash>
 #include <QIODevice>
 #include <QMessageLogger>
 #include <QObject>
@@ -215,7 +216,9 @@ const QString VDomDocument::TagLine    = QStringLiteral("line");
 //---------------------------------------------------------------------------------------------------------------------
 VDomDocument::VDomDocument()
     : QDomDocument(),
-      map()
+      map(),
+      mapIsBuilt(false),
+      indexStatistics()
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -226,91 +229,169 @@ QDomElement VDomDocument::elementById(quint32 id, const QString &tagName)
         return QDomElement();
     }
 
-    if (map.contains(id))
+    if (not mapIsBuilt)
     {
-       const QDomElement e = map[id];
-       if (e.parentNode().nodeType() != QDomNode::BaseNode)
-       {
-           return e;
-       }
-       map.remove(id);
+        RefreshElementIdCache();
     }
 
-    if (tagName.isEmpty())
+    // The mutation API keeps the index up to date, a miss means there is no such element. A removed element may
+    // stay in the index until it is unregistered, it doesn't belong to the document anymore.
+    const auto i = map.constFind(id);
+    if (i == map.constEnd() or not IsAttached(i.value()))
     {
-        if (this->find(this->documentElement(), id))
-        {
-           return map[id];
-        }
+        ++indexStatistics.misses;
+        return QDomElement();
     }
-    else
+
+    if (not tagName.isEmpty() and i.value().tagName() != tagName)
+    {
+        ++indexStatistics.misses;
+        return QDomElement();
+    }
+
+    ++indexStatistics.hits;
+    return i.value();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RefreshElementIdCache build the index id->element for the whole document.
+ */
+void VDomDocument::RefreshElementIdCache()
+{
+    map.clear();
+    ++indexStatistics.rebuilds;
+    mapIsBuilt = true;
+
+    const QDomElement root = documentElement();
+    if (not root.isNull())
+    {
+        IndexElements(root);
+    }
+    qCDebug(vXML, "Id index contains %d elements.", map.size());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RegisterElement add an element and all its children to the id index. Call after inserting the element in
+ * the document.
+ */
+void VDomDocument::RegisterElement(const QDomElement &domElement)
+{
+    if (mapIsBuilt && not domElement.isNull())
     {
-        const QDomNodeList list = elementsByTagName(tagName);
-        for (int i=0; i < list.size(); ++i)
+        IndexElements(domElement);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief UnregisterElement remove an element and all its children from the id index. Call after removing the
+ * element from the document.
+ */
+void VDomDocument::UnregisterElement(const QDomElement &domElement)
+{
+    if (not mapIsBuilt || domElement.isNull())
+    {
+        return;
+    }
+
+    QDomElement element = domElement;
+    while (not element.isNull())
+    {
+        const quint32 id = ElementId(element);
+        if (id != NULL_ID)
         {
-            const QDomElement domElement = list.at(i).toElement();
-            if (not domElement.isNull() && domElement.hasAttribute(AttrId))
+            auto i = map.find(id);
+            if (i != map.end() && i.value() == element)
             {
-                try
-                {
-                    const quint32 elementId = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
-
-                    this->map[elementId] = domElement;
-                    if (elementId == id)
-                    {
-                        return domElement;
-                    }
-                }
-                catch (const VExceptionConversionError &)
-                {
-                    // do nothing
-                }
+                map.erase(i);
             }
         }
+        element = NextElement(domElement, element);
     }
+}
 
-    return QDomElement();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IdIndexStatistics return usage statistics of the id index. For debugging.
+ */
+VDomIndexStatistics VDomDocument::IdIndexStatistics() const
+{
+    VDomIndexStatistics statistics = indexStatistics;
+    statistics.elements = map.size();
+    return statistics;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDomDocument::IndexElements(const QDomElement &domElement)
+{
+    QDomElement element = domElement;
+    while (not element.isNull())
+    {
+        const quint32 id = ElementId(element);
+        if (id != NULL_ID)
+        {
+            map.insert(id, element);
+        }
+        element = NextElement(domElement, element);
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief Find element by id.
- * @param node node
- * @param id id value
- * @return true if found
+ * @brief IsAttached check if the element still belongs to the document tree.
  */
-bool VDomDocument::find(const QDomElement &node, quint32 id)
+bool VDomDocument::IsAttached(const QDomElement &domElement) const
+{
+    QDomNode node = domElement;
+    while (not node.parentNode().isNull())
+    {
+        node = node.parentNode();
+    }
+    return node == *this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+quint32 VDomDocument::ElementId(const QDomElement &domElement)
 {
-    if (node.hasAttribute(AttrId))
+    if (domElement.hasAttribute(AttrId))
     {
         try
         {
-            const quint32 elementId = GetParametrUInt(node, AttrId, NULL_ID_STR);
-
-            this->map[elementId] = node;
-            if (elementId == id)
-            {
-                return true;
-            }
+            return GetParametrUInt(domElement, AttrId, NULL_ID_STR);
         }
         catch (const VExceptionConversionError &)
         {
             // do nothing
         }
     }
+    return NULL_ID;
+}
 
-    for (qint32 i=0; i<node.childNodes().length(); ++i)
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief NextElement return next element of subtree root in document order.
+ */
+QDomElement VDomDocument::NextElement(const QDomElement &root, const QDomElement &current)
+{
+    const QDomElement child = current.firstChildElement();
+    if (not child.isNull())
     {
-        const QDomNode n = node.childNodes().at(i);
-        if (n.isElement())
+        return child;
+    }
+
+    QDomElement element = current;
+    while (not element.isNull() && element != root)
+    {
+        const QDomElement sibling = element.nextSiblingElement();
+        if (not sibling.isNull())
         {
-            if (this->find(n.toElement(), id))
-            {
-                return true;
-            }
+            return sibling;
         }
+        element = element.parentNode().toElement();
     }
-    return false;
+    return QDomElement();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -649,11 +730,68 @@ void VDomDocument::ValidateXML(const QString &schema, const QString &fileName)
         throw VException(errorMsg);
     }
 
+    const QXmlSchema sch = LoadSchema(schema);
+
+    MessageHandler messageHandler;
+    QXmlSchemaValidator validator(sch);
+    validator.setMessageHandler(&messageHandler);
+    if (validator.validate(&pattern, QUrl::fromLocalFile(pattern.fileName())) == false)
+    {
+        pattern.close();
+        VException e(messageHandler.statusMessage());
+        e.AddMoreInformation(tr("Validation error file %3 in line %1 column %2").arg(messageHandler.line())
+                             .arg(messageHandler.column()).arg(fileName));
+        throw e;
+    }
+    pattern.close();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ValidateDocument validate the document in memory by xsd schema. Nothing is read from disk.
+ * @param schema path to schema file.
+ * @param fileName name of xml file for error messages.
+ */
+void VDomDocument::ValidateDocument(const QString &schema, const QString &fileName) const
+{
+    qCDebug(vXML, "Validation xml document %s.", qUtf8Printable(fileName));
+
+    const QXmlSchema sch = LoadSchema(schema);
+
+    MessageHandler messageHandler;
+    QXmlSchemaValidator validator(sch);
+    validator.setMessageHandler(&messageHandler);
+    const int indent = 4;
+    if (validator.validate(toByteArray(indent), QUrl::fromLocalFile(fileName)) == false)
+    {
+        VException e(messageHandler.statusMessage());
+        e.AddMoreInformation(tr("Validation error file %3 in line %1 column %2").arg(messageHandler.line())
+                             .arg(messageHandler.column()).arg(fileName));
+        throw e;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadSchema return compiled xsd schema.
+ *
+ * Compilation of a schema is expensive, every schema is compiled only once per thread.
+ * @param schema path to schema file.
+ */
+QXmlSchema VDomDocument::LoadSchema(const QString &schema)
+{
+    thread_local QHash<QString, QXmlSchema> schemas;
+
+    auto cached = schemas.constFind(schema);
+    if (cached != schemas.constEnd())
+    {
+        return cached.value();
+    }
+
     QFile fileSchema(schema);
     // cppcheck-suppress ConfigurationNotChecked
     if (fileSchema.open(QIODevice::ReadOnly) == false)
     {
-        pattern.close();
         const QString errorMsg(tr("Can't open schema file %1:\n%2.").arg(schema).arg(fileSchema.errorString()));
         throw VException(errorMsg);
     }
@@ -663,39 +801,24 @@ void VDomDocument::ValidateXML(const QString &schema, const QString &fileName)
     sch.setMessageHandler(&messageHandler);
     if (sch.load(&fileSchema, QUrl::fromLocalFile(fileSchema.fileName()))==false)
     {
-        pattern.close();
         fileSchema.close();
         VException e(messageHandler.statusMessage());
         e.AddMoreInformation(tr("Could not load schema file '%1'.").arg(fileSchema.fileName()));
         throw e;
     }
+    fileSchema.close();
     qCDebug(vXML, "Schema loaded.");
 
-    bool errorOccurred = false;
     if (sch.isValid() == false)
     {
-        errorOccurred = true;
-    }
-    else
-    {
-        QXmlSchemaValidator validator(sch);
-        if (validator.validate(&pattern, QUrl::fromLocalFile(pattern.fileName())) == false)
-        {
-            errorOccurred = true;
-        }
-    }
-
-    if (errorOccurred)
-    {
-        pattern.close();
-        fileSchema.close();
         VException e(messageHandler.statusMessage());
-        e.AddMoreInformation(tr("Validation error file %3 in line %1 column %2").arg(messageHandler.line())
-                             .arg(messageHandler.column()).arg(fileName));
+        e.AddMoreInformation(tr("Could not load schema file '%1'.").arg(schema));
         throw e;
     }
-    pattern.close();
-    fileSchema.close();
+
+    sch.setMessageHandler(nullptr); // Validators use own handlers
+    schemas.insert(schema, sch);
+    return sch;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -720,6 +843,7 @@ void VDomDocument::setXMLContent(const QString &fileName)
                              .arg(fileName));
         throw e;
     }
+    RefreshElementIdCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -72,10 +72,27 @@
 
 class QDomElement;
 class QDomNode;
+class QXmlSchema;
 template <typename T> class QVector;
 
 Q_DECLARE_LOGGING_CATEGORY(vXML)
 
+/** @brief The VDomIndexStatistics struct usage of the id index of a document. */
+struct VDomIndexStatistics
+{
+    VDomIndexStatistics()
+        : elements(0),
+          hits(0),
+          misses(0),
+          rebuilds(0)
+    {}
+
+    int     elements;
+    quint64 hits;
+    quint64 misses;
+    quint64 rebuilds;
+};
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
@@ -120,6 +137,11 @@ class VDomDocument : public QDomDocument
     virtual ~VDomDocument() Q_DECL_EQ_DEFAULT;
     QDomElement elementById(quint32 id, const QString &tagName = QString());
 
+    void                RefreshElementIdCache();
+    void                RegisterElement(const QDomElement &domElement);
+    void                UnregisterElement(const QDomElement &domElement);
+    VDomIndexStatistics IdIndexStatistics() const;
+
     template <typename T>
     void SetAttribute(QDomElement &domElement, const QString &name, const T &value) const;
 
@@ -138,6 +160,7 @@ class VDomDocument : public QDomDocument
     Unit           MUnit() const;
 
     static void    ValidateXML(const QString &schema, const QString &fileName);
+    void           ValidateDocument(const QString &schema, const QString &fileName) const;
     virtual void   setXMLContent(const QString &fileName);
     static QString UnitsHelpString();
 
@@ -168,8 +191,16 @@ class VDomDocument : public QDomDocument
     Q_DISABLE_COPY(VDomDocument)
     /** @brief Map used for finding element by id. */
     QHash<quint32, QDomElement> map;
+    bool                        mapIsBuilt;
+    VDomIndexStatistics         indexStatistics;
+
+    void           IndexElements(const QDomElement &domElement);
+    bool           IsAttached(const QDomElement &domElement) const;
+
+    static quint32     ElementId(const QDomElement &domElement);
+    static QDomElement NextElement(const QDomElement &root, const QDomElement &current);
 
-    bool           find(const QDomElement &node, quint32 id);
+    static QXmlSchema LoadSchema(const QString &schema);
 
     bool SaveCanonicalXML(QIODevice *file, int indent, QString &error) const;
 };
@@ -122,23 +122,23 @@ void VVSTConverter::ApplyPatches()
     {
         case (0x000300):
             ToV0_4_0();
-            ValidateXML(XSDSchema(0x000400), m_convertedFileName);
+            ValidateConvertedVersion(0x000400);
             V_FALLTHROUGH
         case (0x000400):
             ToV0_4_1();
-            ValidateXML(XSDSchema(0x000401), m_convertedFileName);
+            ValidateConvertedVersion(0x000401);
             V_FALLTHROUGH
         case (0x000401):
             ToV0_4_2();
-            ValidateXML(XSDSchema(0x000402), m_convertedFileName);
+            ValidateConvertedVersion(0x000402);
             V_FALLTHROUGH
         case (0x000402):
             ToV0_4_3();
-            ValidateXML(XSDSchema(0x000403), m_convertedFileName);
+            ValidateConvertedVersion(0x000403);
             V_FALLTHROUGH
         case (0x000403):
             ToV0_4_4();
-            ValidateXML(XSDSchema(0x000404), m_convertedFileName);
+            ValidateConvertedVersion(0x000404);
             V_FALLTHROUGH
         case (0x000404):
             break;
@@ -22,7 +22,9 @@
 dx_iface::dx_iface(const std::string &file, DRW::Version v, VarMeasurement varMeasurement, VarInsunits varInsunits)
     : dxfW(new dxfRW(file.c_str())),
       cData(),
-      version(v)
+      version(v),
+      streaming(false),
+      blockContents()
 {
     InitHeader(varMeasurement, varInsunits);
     InitTextstyles();
@@ -40,6 +42,31 @@ bool dx_iface::fileExport(bool binary)
     return success;
 }
 
+bool dx_iface::StartStream(bool binary, const BlockContents &contents)
+{
+    streaming = true;
+    blockContents = contents;
+    const bool success = dxfW->writeBegin(this, version, binary);
+    blockContents = BlockContents();
+    streaming = success;
+    return success;
+}
+
+bool dx_iface::FinishStream()
+{
+    if (!streaming)
+    {
+        return false;
+    }
+    streaming = false;
+    return dxfW->writeEnd();
+}
+
+bool dx_iface::IsStreaming() const
+{
+    return streaming;
+}
+
 void dx_iface::writeEntity(DRW_Entity* e){
     switch (e->eType) {
         case DRW::POINT:
@@ -116,12 +143,17 @@ void dx_iface::writeHeader(DRW_Header &data){
 
 void dx_iface::writeBlocks(){
     //write each block
+    int index = 0;
     for (std::list<dx_ifaceBlock*>::iterator it=cData.blocks.begin(); it != cData.blocks.end(); ++it){
         dx_ifaceBlock* bk = *it;
         dxfW->writeBlock(bk);
         //and write each entity in block
         for (std::list<DRW_Entity*>::const_iterator it=bk->ent.begin(); it!=bk->ent.end(); ++it)
             writeEntity(*it);
+        //streamed entities are written by the callback
+        if (blockContents)
+            blockContents(index, bk);
+        ++index;
     }
 }
 
@@ -310,26 +342,29 @@ void dx_iface::InitAppId()
 
 void dx_iface::AddEntity(DRW_Entity *e)
 {
+    if (streaming)
+    {
+        writeEntity(e);
+        delete e;
+        return;
+    }
     cData.mBlock->ent.push_back(e);
 }
 
-UTF8STRING dx_iface::AddFont(const QFont &f)
+void dx_iface::AddBlockEntity(dx_ifaceBlock *block, DRW_Entity *e)
 {
-    DRW_Textstyle ts;
-    ts.name = f.family().toUpper().toStdString();
-
-    // Idea source https://stackoverflow.com/questions/20111522/writing-text-styles-into-dxf-from-a-delphi-application
-    if (f.bold())
+    if (streaming)
     {
-        ts.name += "_BOLD";
-        ts.fontFamily += 0x2000000;
+        writeEntity(e);
+        delete e;
+        return;
     }
+    block->ent.push_back(e);
+}
 
-    if (f.italic())
-    {
-        ts.name += "_ITALIC";
-        ts.fontFamily += 0x1000000;
-    }
+UTF8STRING dx_iface::AddFont(const QFont &f)
+{
+    DRW_Textstyle ts = FontStyle(f);
 
     for (auto it = cData.textStyles.begin() ; it !=cData.textStyles.end() ; ++it)
     {
@@ -339,6 +374,12 @@ UTF8STRING dx_iface::AddFont(const QFont &f)
         }
     }
 
+    if (streaming)
+    {
+        //the STYLE table is already written, an entity must not reference a new style
+        return "Standard";
+    }
+
     ts.font = f.family().toStdString();
 
     cData.textStyles.push_back(ts);
@@ -346,6 +387,27 @@ UTF8STRING dx_iface::AddFont(const QFont &f)
     return ts.name;
 }
 
+DRW_Textstyle dx_iface::FontStyle(const QFont &f)
+{
+    DRW_Textstyle ts;
+    ts.name = f.family().toUpper().toStdString();
+
+    // Idea source https://stackoverflow.com/questions/20111522/writing-text-styles-into-dxf-from-a-delphi-application
+    if (f.bold())
+    {
+        ts.name += "_BOLD";
+        ts.fontFamily += 0x2000000;
+    }
+
+    if (f.italic())
+    {
+        ts.name += "_ITALIC";
+        ts.fontFamily += 0x1000000;
+    }
+
+    return ts;
+}
+
 void dx_iface::AddBlock(dx_ifaceBlock *block)
 {
     cData.blocks.push_back(block);
@@ -12,6 +12,8 @@
 #ifndef DX_IFACE_H
 #define DX_IFACE_H
 
+#include <functional>
+
 #include "libdxfrw/drw_interface.h"
 #include "libdxfrw/libdxfrw.h"
 #include "dxfdef.h"
@@ -96,9 +98,18 @@ class dx_data {
 class dx_iface : public DRW_Interface
 {
 public:
+    //called for each block of the BLOCKS section while streaming, fills the block with AddBlockEntity()
+    typedef std::function<void(int index, dx_ifaceBlock *block)> BlockContents;
+
     dx_iface(const std::string& file, DRW::Version v, VarMeasurement varMeasurement, VarInsunits varInsunits);
     virtual ~dx_iface();
     bool fileExport(bool binary);
+
+    //streaming export: tables and blocks are written at start, after that every added entity goes straight
+    //to the file and is deleted. Text styles and layers must be known before StartStream().
+    bool StartStream(bool binary, const BlockContents &contents = BlockContents());
+    bool FinishStream();
+    bool IsStreaming() const;
     void writeEntity(DRW_Entity* e);
 
 //reimplement virtual DRW_Interface functions
@@ -117,6 +128,8 @@ class dx_iface : public DRW_Interface
     virtual void writeAppId();
 
     void AddEntity(DRW_Entity* e);
+    void AddBlockEntity(dx_ifaceBlock* block, DRW_Entity* e);
+    //returns the text style of the font, while streaming a font that is not registered gets the Standard style
     UTF8STRING AddFont(const QFont &f);
     void AddBlock(dx_ifaceBlock* block);
 
@@ -130,10 +143,13 @@ class dx_iface : public DRW_Interface
     dxfRW* dxfW; //pointer to writer, needed to send data
     dx_data cData; // class to store or read data
     DRW::Version version;
+    bool streaming;
+    BlockContents blockContents;
 
     void InitHeader(VarMeasurement varMeasurement, VarInsunits varInsunits);
     void InitTextstyles();
     void InitAppId();
+    static DRW_Textstyle FontStyle(const QFont &f);
 
     static std::string LocaleToISO();
 };
@@ -41,6 +41,7 @@ dxfRW::dxfRW(const char* name)
       binFile(),
       reader(nullptr),
       writer(nullptr),
+      fileOut(),
       iface(),
       header(),
       nextentity(),
@@ -121,20 +122,25 @@ bool dxfRW::read(DRW_Interface *interface_, bool ext){
 }
 
 bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
-    bool isOk = false;
-    std::ofstream filestr;
+    if (!writeBegin(interface_, ver, bin))
+        return false;
+    iface->writeEntities();
+    return writeEnd();
+}
+
+bool dxfRW::writeBegin(DRW_Interface *interface_, DRW::Version ver, bool bin){
     version = ver;
     binFile = bin;
     iface = interface_;
     if (binFile) {
-        filestr.open (fileName.c_str(), std::ios_base::out | std::ios::binary | std::ios::trunc);
+        fileOut.open (fileName.c_str(), std::ios_base::out | std::ios::binary | std::ios::trunc);
         //write sentinel
-        filestr << "AutoCAD Binary DXF\r\n" << static_cast<char>(26) << '\0';
-        writer = new dxfWriterBinary(&filestr);
+        fileOut << "AutoCAD Binary DXF\r\n" << static_cast<char>(26) << '\0';
+        writer = new dxfWriterBinary(&fileOut);
         DRW_DBG("dxfRW::read binary file\n");
     } else {
-        filestr.open (fileName.c_str(), std::ios_base::out | std::ios::trunc);
-        writer = new dxfWriterAscii(&filestr);
+        fileOut.open (fileName.c_str(), std::ios_base::out | std::ios::trunc);
+        writer = new dxfWriterAscii(&fileOut);
         std::string comm = std::string("dxfrw ") + std::string(DRW_VERSION);
         writer->writeString(999, comm);
     }
@@ -160,7 +166,18 @@ bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
 
     writer->writeString(0, "SECTION");
     writer->writeString(2, "ENTITIES");
-    iface->writeEntities();
+    if (!fileOut.good()) {
+        fileOut.close();
+        delete writer;
+        writer = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool dxfRW::writeEnd(){
+    if (writer == nullptr)
+        return false;
     writer->writeString(0, "ENDSEC");
 
     if (version > DRW::AC1009) {
@@ -170,9 +187,9 @@ bool dxfRW::write(DRW_Interface *interface_, DRW::Version ver, bool bin){
         writer->writeString(0, "ENDSEC");
     }
     writer->writeString(0, "EOF");
-    filestr.flush();
-    filestr.close();
-    isOk = true;
+    fileOut.flush();
+    const bool isOk = fileOut.good();
+    fileOut.close();
     delete writer;
     writer = nullptr;
     return isOk;
@@ -14,6 +14,7 @@
 #define LIBDXFRW_H
 
 #include <string>
+#include <fstream>
 #include "drw_entities.h"
 #include "drw_objects.h"
 #include "drw_header.h"
@@ -43,6 +44,15 @@ class dxfRW {
     void setBinary(bool b) {binFile = b;}
 
     bool write(DRW_Interface *interface_, DRW::Version ver, bool bin);
+    /// streaming write, split in two halves of write()
+    /*!
+     * writeBegin() writes header, tables and blocks and opens the ENTITIES section.
+     * Entities can then be passed one by one to the write* functions, writeEnd()
+     * closes the section, writes the objects and closes the file.
+     * If writeBegin() fails the file is closed and writeEnd() returns false.
+     */
+    bool writeBegin(DRW_Interface *interface_, DRW::Version ver, bool bin);
+    bool writeEnd();
     bool writeLineType(DRW_LType *ent);
     bool writeLayer(DRW_Layer *ent);
     bool writeDimstyle(DRW_Dimstyle *ent);
@@ -131,6 +141,7 @@ class dxfRW {
     bool binFile;
     dxfReader *reader;
     dxfWriter *writer;
+    std::ofstream fileOut;
     DRW_Interface *iface;
     DRW_Header header;
 //    int section;
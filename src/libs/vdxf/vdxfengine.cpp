@@ -42,6 +42,7 @@
 #include <QPen>
 #include <QPolygonF>
 #include <QTextItem>
+#include <QVector>
 #include <Qt>
 #include <QtDebug>
 
@@ -78,11 +79,15 @@ VDxfEngine::VDxfEngine()
     , fileName()
     , m_version(DRW::AC1014)
     , m_binary(false)
+    , m_streaming(false)
+    , m_fonts()
     , transform()
     , input()
     , varMeasurement(VarMeasurement::Metric)
     , varInsunits(VarInsunits::Millimeters)
     , textBuffer(new DRW_Text())
+    , penColor(DRW::ColorByLayer)
+    , penStyle("BYLAYER")
 {
 }
 
@@ -112,13 +117,28 @@ bool VDxfEngine::begin(QPaintDevice *pdev)
     input = QSharedPointer<dx_iface>(new dx_iface(fileName.toStdString(), m_version, varMeasurement, varInsunits));
     input->AddQtLTypes();
     input->AddDefLayers();
+
+    if (m_streaming)
+    {
+        for (int i = 0; i < m_fonts.size(); ++i)
+        {
+            input->AddFont(m_fonts.at(i));
+        }
+
+        if (not input->StartStream(m_binary))
+        {
+            qWarning("VDxfEngine::begin(), could not open the file '%s'", qUtf8Printable(fileName));
+            input.reset();
+            return false;
+        }
+    }
     return true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VDxfEngine::end()
 {
-    const bool res = input->fileExport(m_binary);
+    const bool res = input->IsStreaming() ? input->FinishStream() : input->fileExport(m_binary);
     return res;
 }
 
@@ -136,6 +156,12 @@ void VDxfEngine::updateState(const QPaintEngineState &state)
     {
         transform = state.transform(); // Save new transformation for moving paths
     }
+
+    if (flags & QPaintEngine::DirtyPen)
+    {// Translate the pen once per state change, not per entity
+        penColor = getPenColor();
+        penStyle = getPenStyle();
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -155,9 +181,9 @@ void VDxfEngine::drawPath(const QPainterPath &path)
         { // Use lwpolyline
             DRW_LWPolyline *poly = new DRW_LWPolyline();
             poly->layer = "0";
-            poly->color = getPenColor();
+            poly->color = penColor;
             poly->lWeight = DRW_LW_Conv::widthByLayer;
-            poly->lineType = getPenStyle();
+            poly->lineType = penStyle;
 
             if (polygon.size() > 1 && polygon.first() == polygon.last())
             {
@@ -166,6 +192,7 @@ void VDxfEngine::drawPath(const QPainterPath &path)
 
             poly->flags |= 0x80; // plinegen
 
+            poly->vertlist.reserve(static_cast<size_t>(polygon.count()));
             for (int i=0; i < polygon.count(); ++i)
             {
                 poly->addVertex(DRW_Vertex2D(FromPixel(polygon.at(i).x(), varInsunits),
@@ -178,9 +205,9 @@ void VDxfEngine::drawPath(const QPainterPath &path)
         { // Use polyline
             DRW_Polyline *poly = new DRW_Polyline();
             poly->layer = "0";
-            poly->color = getPenColor();
+            poly->color = penColor;
             poly->lWeight = DRW_LW_Conv::widthByLayer;
-            poly->lineType = getPenStyle();
+            poly->lineType = penStyle;
             if (polygon.size() > 1 && polygon.first() == polygon.last())
             {
                 poly->flags |= 0x1; // closed
@@ -188,6 +215,7 @@ void VDxfEngine::drawPath(const QPainterPath &path)
 
             poly->flags |= 0x80; // plinegen
 
+            poly->vertlist.reserve(static_cast<size_t>(polygon.count()));
             for (int i=0; i < polygon.count(); ++i)
             {
                 poly->addVertex(DRW_Vertex(FromPixel(polygon.at(i).x(), varInsunits),
@@ -213,9 +241,9 @@ void VDxfEngine::drawLines(const QLineF * lines, int lineCount)
         line->secPoint =  DRW_Coord(FromPixel(p2.x(), varInsunits),
                                     FromPixel(getSize().height() - p2.y(), varInsunits), 0);
         line->layer = "0";
-        line->color = getPenColor();
+        line->color = penColor;
         line->lWeight = DRW_LW_Conv::widthByLayer;
-        line->lineType = getPenStyle();
+        line->lineType = penStyle;
 
         input->AddEntity(line);
     }
@@ -241,9 +269,9 @@ void VDxfEngine::drawPolygon(const QPointF *points, int pointCount, PolygonDrawM
     { // Use lwpolyline
         DRW_LWPolyline *poly = new DRW_LWPolyline();
         poly->layer = "0";
-        poly->color = getPenColor();
+        poly->color = penColor;
         poly->lWeight = DRW_LW_Conv::widthByLayer;
-        poly->lineType = getPenStyle();
+        poly->lineType = penStyle;
 
         if (pointCount > 1 && points[0] == points[pointCount])
         {
@@ -265,9 +293,9 @@ void VDxfEngine::drawPolygon(const QPointF *points, int pointCount, PolygonDrawM
     { // Use polyline
         DRW_Polyline *poly = new DRW_Polyline();
         poly->layer = "0";
-        poly->color = getPenColor();
+        poly->color = penColor;
         poly->lWeight = DRW_LW_Conv::widthByLayer;
-        poly->lineType = getPenStyle();
+        poly->lineType = penStyle;
 
         if (pointCount > 1 && points[0] == points[pointCount])
         {
@@ -327,9 +355,9 @@ void VDxfEngine::drawEllipse(const QRectF & rect)
     ellipse->endparam = 2*M_PI;
 
     ellipse->layer = "0";
-    ellipse->color = getPenColor();
+    ellipse->color = penColor;
     ellipse->lWeight = DRW_LW_Conv::widthByLayer;
-    ellipse->lineType = getPenStyle();
+    ellipse->lineType = penStyle;
 
     input->AddEntity(ellipse);
 }
@@ -361,9 +389,9 @@ void VDxfEngine::drawTextItem(const QPointF & p, const QTextItem & textItem)
         textBuffer->angle = -rotationAngle;
 
         textBuffer->layer = "0";
-        textBuffer->color = getPenColor();
+        textBuffer->color = penColor;
         textBuffer->lWeight = DRW_LW_Conv::widthByLayer;
-        textBuffer->lineType = getPenStyle();
+        textBuffer->lineType = penStyle;
     }
 
     /* Because QPaintEngine::drawTextItem doesn't pass whole string per time we mark end of each string by adding
@@ -464,6 +492,30 @@ bool VDxfEngine::IsBinaryFormat() const
     return m_binary;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfEngine::SetStreaming(bool streaming)
+{
+    Q_ASSERT(not isActive());
+    m_streaming = streaming;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDxfEngine::IsStreaming() const
+{
+    return m_streaming;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AddFont register text font before export. In streaming mode text styles are written before the first entity,
+ * fonts that were not registered fall back to the standard text style.
+ */
+void VDxfEngine::AddFont(const QFont &font)
+{
+    Q_ASSERT(not isActive());
+    m_fonts.append(font);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 std::string VDxfEngine::getPenStyle()
 {
@@ -620,40 +672,68 @@ bool VDxfEngine::ExportToAAMA(const QVector<VLayoutPiece> &details)
     }
     input->AddAAMALayers();
 
-    ExportAAMAGlobalText(input, details);
-
+    // Blocks are declared up front, their entities are added when the BLOCKS section is written
+    QVector<dx_ifaceBlock *> blocks;
+    blocks.reserve(details.size());
     for(int i = 0; i < details.size(); ++i)
     {
-        const VLayoutPiece &detail = details.at(i);
-
-        dx_ifaceBlock *detailBlock = new dx_ifaceBlock();
-
-        QString blockName = detail.GetName();
+        QString blockName = details.at(i).GetName();
         if (m_version <= DRW::AC1009)
         {
             blockName.replace(' ', '_');
         }
 
+        dx_ifaceBlock *detailBlock = new dx_ifaceBlock();
         detailBlock->name = blockName.toStdString();
         detailBlock->layer = "1";
 
-        ExportAAMAOutline(detailBlock, detail);
-        ExportAAMADraw(detailBlock, detail);
-        ExportAAMAIntcut(detailBlock, detail);
-        ExportAAMANotch(detailBlock, detail);
-        ExportAAMAGrainline(detailBlock, detail);
-        ExportAAMAText(detailBlock, detail);
-
         input->AddBlock(detailBlock);
+        blocks.append(detailBlock);
+    }
 
+    if (m_streaming)
+    {
+        const bool started = input->StartStream(m_binary, [this, &details](int index, dx_ifaceBlock *block)
+        {
+            ExportAAMABlock(block, details.at(index));
+        });
+
+        if (not started)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        for(int i = 0; i < blocks.size(); ++i)
+        {
+            ExportAAMABlock(blocks.at(i), details.at(i));
+        }
+    }
+
+    ExportAAMAGlobalText(input, details);
+
+    for(int i = 0; i < blocks.size(); ++i)
+    {
         DRW_Insert *insert = new DRW_Insert();
-        insert->name = blockName.toStdString();
+        insert->name = blocks.at(i)->name;
         insert->layer = "1";
 
         input->AddEntity(insert);
     }
 
-    return input->fileExport(m_binary);
+    return m_streaming ? input->FinishStream() : input->fileExport(m_binary);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfEngine::ExportAAMABlock(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail)
+{
+    ExportAAMAOutline(detailBlock, detail);
+    ExportAAMADraw(detailBlock, detail);
+    ExportAAMAIntcut(detailBlock, detail);
+    ExportAAMANotch(detailBlock, detail);
+    ExportAAMAGrainline(detailBlock, detail);
+    ExportAAMAText(detailBlock, detail);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -672,7 +752,7 @@ void VDxfEngine::ExportAAMAOutline(dx_ifaceBlock *detailBlock, const VLayoutPiec
     DRW_Entity *e = AAMAPolygon(outline, "1", true);
     if (e)
     {
-        detailBlock->ent.push_back(e);
+        input->AddBlockEntity(detailBlock, e);
     }
 }
 
@@ -685,7 +765,7 @@ void VDxfEngine::ExportAAMADraw(dx_ifaceBlock *detailBlock, const VLayoutPiece &
         DRW_Entity *e = AAMAPolygon(poly, "8", true);
         if (e)
         {
-            detailBlock->ent.push_back(e);
+            input->AddBlockEntity(detailBlock, e);
         }
     }
 }
@@ -699,7 +779,7 @@ void VDxfEngine::ExportAAMAIntcut(dx_ifaceBlock *detailBlock, const VLayoutPiece
         DRW_Entity *e = AAMAPolygon(drawIntCut.at(j), "8", false);
         if (e)
         {
-            detailBlock->ent.push_back(e);
+            input->AddBlockEntity(detailBlock, e);
         }
     }
 
@@ -709,7 +789,7 @@ void VDxfEngine::ExportAAMAIntcut(dx_ifaceBlock *detailBlock, const VLayoutPiece
         DRW_Entity *e = AAMAPolygon(drawIntCut.at(j), "11", false);
         if (e)
         {
-            detailBlock->ent.push_back(e);
+            input->AddBlockEntity(detailBlock, e);
         }
     }
 }
@@ -725,7 +805,7 @@ void VDxfEngine::ExportAAMANotch(dx_ifaceBlock *detailBlock, const VLayoutPiece
             DRW_Entity *e = AAMALine(notches.at(i), "4");
             if (e)
             {
-                detailBlock->ent.push_back(e);
+                input->AddBlockEntity(detailBlock, e);
             }
         }
     }
@@ -740,7 +820,7 @@ void VDxfEngine::ExportAAMAGrainline(dx_ifaceBlock *detailBlock, const VLayoutPi
         DRW_Entity *e = AAMALine(QLineF(grainline.first(), grainline.last()), "7");
         if (e)
         {
-            detailBlock->ent.push_back(e);
+            input->AddBlockEntity(detailBlock, e);
         }
     }
 }
@@ -754,7 +834,7 @@ void VDxfEngine::ExportAAMAText(dx_ifaceBlock *detailBlock, const VLayoutPiece &
     for (int i = 0; i < list.size(); ++i)
     {
         QPointF pos(startPos.x(), startPos.y() - ToPixel(AAMATextHeight, varInsunits)*(list.size() - i-1));
-        detailBlock->ent.push_back(AAMAText(pos, list.at(i), "1"));
+        input->AddBlockEntity(detailBlock, AAMAText(pos, list.at(i), "1"));
     }
 }
 
@@ -842,6 +922,7 @@ P *VDxfEngine::CreateAAMAPolygon(const QVector<QPointF> &polygon, const QString
         }
     }
 
+    poly->vertlist.reserve(static_cast<size_t>(polygon.count()));
     for (int i=0; i < polygon.count(); ++i)
     {
         poly->addVertex(V(FromPixel(polygon.at(i).x(), varInsunits),
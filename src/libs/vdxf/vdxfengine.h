@@ -30,6 +30,8 @@
 #define VDXFENGINE_H
 
 #include <qcompilerdetection.h>
+#include <QFont>
+#include <QList>
 #include <QMatrix>
 #include <QPaintEngine>
 #include <QPointF>
@@ -86,6 +88,11 @@ class VDxfEngine : public QPaintEngine
     void SetBinaryFormat(bool binary);
     bool IsBinaryFormat() const;
 
+    void SetStreaming(bool streaming);
+    bool IsStreaming() const;
+
+    void AddFont(const QFont &font);
+
     std::string getPenStyle();
     int getPenColor();
 
@@ -99,16 +106,21 @@ class VDxfEngine : public QPaintEngine
     QString          fileName;
     DRW::Version     m_version;
     bool             m_binary;
+    bool             m_streaming;
+    QList<QFont>     m_fonts;
     QTransform       transform;
     QSharedPointer<dx_iface> input;
     VarMeasurement varMeasurement;
     VarInsunits varInsunits;
     DRW_Text *textBuffer;
+    int         penColor;
+    std::string penStyle;
 
     Q_REQUIRED_RESULT double FromPixel(double pix, const VarInsunits &unit) const;
     Q_REQUIRED_RESULT double ToPixel(double val, const VarInsunits &unit) const;
 
     bool ExportToAAMA(const QVector<VLayoutPiece> &details);
+    void ExportAAMABlock(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail);
     void ExportAAMAOutline(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail);
     void ExportAAMADraw(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail);
     void ExportAAMAIntcut(dx_ifaceBlock *detailBlock, const VLayoutPiece &detail);
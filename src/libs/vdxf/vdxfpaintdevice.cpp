@@ -140,6 +140,38 @@ bool VDxfPaintDevice::IsBinaryFormat() const
     return engine->IsBinaryFormat();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStreaming write entities to the file as soon as they are drawn instead of keeping the whole drawing in
+ * memory until the end.
+ */
+void VDxfPaintDevice::SetStreaming(bool streaming)
+{
+    if (engine->isActive())
+    {
+        qWarning("VDxfPaintDevice::SetStreaming(), cannot set streaming while Dxf is being generated");
+        return;
+    }
+    engine->SetStreaming(streaming);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VDxfPaintDevice::IsStreaming() const
+{
+    return engine->IsStreaming();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDxfPaintDevice::AddFont(const QFont &font)
+{
+    if (engine->isActive())
+    {
+        qWarning("VDxfPaintDevice::AddFont(), cannot add font while Dxf is being generated");
+        return;
+    }
+    engine->AddFont(font);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VDxfPaintDevice::setMeasurement(const VarMeasurement &var)
 {
@@ -30,6 +30,7 @@
 #define VDXFPAINTDEVICE_H
 
 #include <qcompilerdetection.h>
+#include <QFont>
 #include <QPaintDevice>
 #include <QSize>
 #include <QString>
@@ -63,6 +64,11 @@ class VDxfPaintDevice : public QPaintDevice
     void SetBinaryFormat(bool binary);
     bool IsBinaryFormat() const;
 
+    void SetStreaming(bool streaming);
+    bool IsStreaming() const;
+
+    void AddFont(const QFont &font);
+
     void setMeasurement(const VarMeasurement &var);
     void setInsunits(const VarInsunits &var);
 
@@ -941,8 +941,7 @@ qreal VMeasurements::EvalFormula(VContainer *data, const QString &formula, bool
             // Replace line return character with spaces for calc if exist
             QString f = formula;
             f.replace("\n", " ");
-            QScopedPointer<Calculator> cal(new Calculator());
-            const qreal result = cal->EvalFormula(data->DataVariables(), f);
+            const qreal result = Calculator::EvalCachedFormula(data->DataVariables(), f);
 
             (qIsInf(result) || qIsNaN(result)) ? *ok = false : *ok = true;
             return result;
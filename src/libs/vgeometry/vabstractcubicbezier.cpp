@@ -55,20 +55,132 @@
 #include <QMessageLogger>
 #include <QPoint>
 #include <QtDebug>
+#include <QtMath>
+#include <algorithm>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 #include "../vgeometry/vpointf.h"
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QPointF PointAtT(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal t)
+{
+    const qreal mt = 1 - t;
+    const qreal a = mt * mt * mt;
+    const qreal b = 3 * mt * mt * t;
+    const qreal c = 3 * mt * t * t;
+    const qreal d = t * t * t;
+    return QPointF(a * p1.x() + b * p2.x() + c * p3.x() + d * p4.x(),
+                   a * p1.y() + b * p2.y() + c * p3.y() + d * p4.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal SpeedAtT(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4, qreal t)
+{
+    const qreal mt = 1 - t;
+    const QPointF derivative = 3 * (mt * mt * (p2 - p1) + 2 * mt * t * (p3 - p2) + t * t * (p4 - p3));
+    return qSqrt(derivative.x() * derivative.x() + derivative.y() * derivative.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool IsFlat(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4)
+{
+    const qreal tolerance = 0.001; // px
+    const QLineF chord(p1, p4);
+    const qreal chordLength = chord.length();
+    if (qFuzzyIsNull(chordLength))
+    {
+        return QLineF(p1, p2).length() <= tolerance && QLineF(p1, p3).length() <= tolerance;
+    }
+
+    const QPointF dir = p4 - p1;
+    const qreal d2 = qAbs(dir.x() * (p2.y() - p1.y()) - dir.y() * (p2.x() - p1.x())) / chordLength;
+    const qreal d3 = qAbs(dir.x() * (p3.y() - p1.y()) - dir.y() * (p3.x() - p1.x())) / chordLength;
+    return d2 <= tolerance && d3 <= tolerance;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SubdivideIntersectLine(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4,
+                            const QLineF &line, int depth, QVector<QPointF> &intersections)
+{
+    // Bounding box of control points contains the curve, reject pieces that cannot reach the segment.
+    if (qMax(qMax(p1.x(), p2.x()), qMax(p3.x(), p4.x())) < qMin(line.x1(), line.x2()) ||
+        qMin(qMin(p1.x(), p2.x()), qMin(p3.x(), p4.x())) > qMax(line.x1(), line.x2()) ||
+        qMax(qMax(p1.y(), p2.y()), qMax(p3.y(), p4.y())) < qMin(line.y1(), line.y2()) ||
+        qMin(qMin(p1.y(), p2.y()), qMin(p3.y(), p4.y())) > qMax(line.y1(), line.y2()))
+    {
+        return;
+    }
+
+    // Convex hull on one side of the line also means no intersection.
+    const QPointF dir = line.p2() - line.p1();
+    auto Side = [&line, &dir](const QPointF &p)
+    {
+        return dir.x() * (p.y() - line.y1()) - dir.y() * (p.x() - line.x1());
+    };
+    const qreal s1 = Side(p1);
+    const qreal s2 = Side(p2);
+    const qreal s3 = Side(p3);
+    const qreal s4 = Side(p4);
+    if ((s1 > 0 && s2 > 0 && s3 > 0 && s4 > 0) || (s1 < 0 && s2 < 0 && s3 < 0 && s4 < 0))
+    {
+        return;
+    }
+
+    if (depth <= 0 || IsFlat(p1, p2, p3, p4))
+    {
+        QPointF crosPoint;
+        if (line.intersects(QLineF(p1, p4), &crosPoint) == QLineF::BoundedIntersection)
+        {
+            // Neighbor pieces share the end point, do not report the same crossing twice.
+            if (intersections.isEmpty() || not VFuzzyComparePoints(intersections.last(), crosPoint))
+            {
+                intersections.append(crosPoint);
+            }
+        }
+        return;
+    }
+
+    const QPointF p12 = (p1 + p2) / 2;
+    const QPointF p23 = (p2 + p3) / 2;
+    const QPointF p34 = (p3 + p4) / 2;
+    const QPointF p123 = (p12 + p23) / 2;
+    const QPointF p234 = (p23 + p34) / 2;
+    const QPointF p1234 = (p123 + p234) / 2;
+
+    SubdivideIntersectLine(p1, p12, p123, p1234, line, depth - 1, intersections);
+    SubdivideIntersectLine(p1234, p234, p34, p4, line, depth - 1, intersections);
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The LengthTable struct keeps everything we know about the curve length.
+ *
+ * points are the adaptive flattening used only for drawing. length is the quadrature length of the curve. cumulative
+ * holds chord lengths of the curve sampled at uniform steps of t, it gives GetParmT() a starting guess that is refined
+ * with quadrature.
+ */
+struct VAbstractCubicBezier::LengthTable
+{
+    QVector<QPointF> points{};
+    qreal            length{0};
+    QVector<qreal>   cumulative{};
+};
+
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractCubicBezier::VAbstractCubicBezier(const GOType &type, const quint32 &idObject, const Draw &mode)
-    : VAbstractBezier(type, idObject, mode)
+    : VAbstractBezier(type, idObject, mode),
+      lengthTable()
 {
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 VAbstractCubicBezier::VAbstractCubicBezier(const VAbstractCubicBezier &curve)
-    : VAbstractBezier(curve)
+    : VAbstractBezier(curve),
+      lengthTable(std::atomic_load(&curve.lengthTable))
 {
 }
 
@@ -80,6 +192,7 @@ VAbstractCubicBezier &VAbstractCubicBezier::operator=(const VAbstractCubicBezier
         return *this;
     }
     VAbstractBezier::operator=(curve);
+    std::atomic_store(&lengthTable, std::atomic_load(&curve.lengthTable));
     return *this;
 }
 
@@ -88,6 +201,10 @@ VAbstractCubicBezier::~VAbstractCubicBezier()
 {
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void VAbstractCubicBezier::Swap(VAbstractCubicBezier &curve) Q_DECL_NOTHROW
+{ VAbstractCurve::Swap(curve); std::swap(lengthTable, curve.lengthTable); }
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief CutSpline cut spline.
@@ -173,21 +290,49 @@ qreal VAbstractCubicBezier::GetParmT(qreal length) const
     {
         return 0;
     }
-    else if (length > GetLength())
+
+    const std::shared_ptr<const LengthTable> table = GetLengthTable();
+    const QVector<qreal> &cumulative = table->cumulative;
+    const qreal sampledLength = cumulative.last();
+    if (qFuzzyIsNull(table->length) || qFuzzyIsNull(sampledLength))
     {
-        length = GetLength();
+        return 0;
     }
 
-    const qreal eps = 0.001 * length;
-    qreal parT = 0.5;
-    qreal step = parT;
-    qreal splLength = LengthT(parT);
+    if (length >= table->length)
+    {
+        return 1;
+    }
 
-    while (qAbs(splLength - length) > eps)
+    // Starting guess from the table
+    const qreal target = length * sampledLength / table->length;
+    const int segments = cumulative.size() - 1;
+    const int i = qBound(1, static_cast<int>(std::lower_bound(cumulative.constBegin(), cumulative.constEnd(), target)
+                                             - cumulative.constBegin()), segments);
+    const qreal step = cumulative.at(i) - cumulative.at(i - 1);
+    const qreal fraction = qFuzzyIsNull(step) ? 0 : (target - cumulative.at(i - 1)) / step;
+    qreal parT = qBound(0.0, (i - 1 + fraction) / segments, 1.0);
+
+    // Newton's method, length of each step is integrated separately so we never integrate from the start again
+    const QPointF p1 = static_cast<QPointF>(GetP1());
+    const QPointF p2 = GetControlPoint1();
+    const QPointF p3 = GetControlPoint2();
+    const QPointF p4 = static_cast<QPointF>(GetP4());
+    const auto speed = [p1, p2, p3, p4](qreal value) { return SpeedAtT(p1, p2, p3, p4, value); };
+
+    const qreal eps = ToPixel(0.0001, Unit::Mm);
+    qreal splLength = ArcLength(speed, 0, parT);
+    for (int iteration = 0; iteration < 10 && qAbs(splLength - length) > eps; ++iteration)
     {
-        step /= 2.0;
-        splLength > length ? parT -= step : parT += step;
-        splLength = LengthT(parT);
+        const qreal derivative = speed(parT);
+        if (qFuzzyIsNull(derivative))
+        {
+            break;
+        }
+
+        const qreal nextT = qBound(0.0, parT - (splLength - length) / derivative, 1.0);
+        splLength += ArcLength(speed, parT, nextT);
+        parT = nextT;
     }
     return parT;
 }
@@ -555,6 +700,8 @@ QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, c
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief LengthBezier return spline length using 4 spline point.
+ *
+ * Length is integrated with Gauss-Legendre quadrature, it does not depend on the flattening used for drawing.
  * @param p1 first spline point
  * @param p2 first control point.
  * @param p3 second control point.
@@ -563,7 +710,28 @@ QVector<QPointF> VAbstractCubicBezier::GetCubicBezierPoints(const QPointF &p1, c
  */
 qreal VAbstractCubicBezier::LengthBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4)
 {
-    return PathLength(GetCubicBezierPoints(p1, p2, p3, p4));
+    return ArcLength([p1, p2, p3, p4](qreal value) { return SpeedAtT(p1, p2, p3, p4, value); }, 0, 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BezierIntersectLine return list of points where cubic bezier curve crosses line segment.
+ *
+ * Curve is subdivided until the piece is flat, pieces whose control points are outside of the segment bounding box or
+ * lie on one side of the line are dropped.
+ * @param p1 first spline point
+ * @param p2 first control point.
+ * @param p3 second control point.
+ * @param p4 last spline point.
+ * @param line line segment.
+ * @return intersection points in order from the first spline point.
+ */
+QVector<QPointF> VAbstractCubicBezier::BezierIntersectLine(const QPointF &p1, const QPointF &p2, const QPointF &p3,
+                                                           const QPointF &p4, const QLineF &line)
+{
+    QVector<QPointF> intersections;
+    SubdivideIntersectLine(p1, p2, p3, p4, line, 32, intersections);
+    return intersections;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -574,29 +742,95 @@ qreal VAbstractCubicBezier::LengthT(qreal t) const
         qDebug()<<"Wrong value t.";
         return 0;
     }
-    QLineF seg1_2 ( static_cast<QPointF>(GetP1 ()), GetControlPoint1 () );
-    seg1_2.setLength(seg1_2.length () * t);
-    const QPointF p12 = seg1_2.p2();
 
-    QLineF seg2_3 ( GetControlPoint1 (), GetControlPoint2 () );
-    seg2_3.setLength(seg2_3.length () * t);
-    const QPointF p23 = seg2_3.p2();
+    const QPointF p1 = static_cast<QPointF>(GetP1());
+    const QPointF p2 = GetControlPoint1();
+    const QPointF p3 = GetControlPoint2();
+    const QPointF p4 = static_cast<QPointF>(GetP4());
+    return ArcLength([p1, p2, p3, p4](qreal value) { return SpeedAtT(p1, p2, p3, p4, value); }, 0, t);
+}
 
-    QLineF seg12_23 ( p12, p23 );
-    seg12_23.setLength(seg12_23.length () * t);
-    const QPointF p123 = seg12_23.p2();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectLine return list of points for real intersection with line
+ * @param line line that intersect with curve
+ * @return list of intersection points
+ */
+QVector<QPointF> VAbstractCubicBezier::IntersectLine(const QLineF &line) const
+{
+    return BezierIntersectLine(static_cast<QPointF>(GetP1()), GetControlPoint1(), GetControlPoint2(),
+                               static_cast<QPointF>(GetP4()), line);
+}
 
-    QLineF seg3_4 ( GetControlPoint2 (), static_cast<QPointF>(GetP4 ()) );
-    seg3_4.setLength(seg3_4.length () * t);
-    const QPointF p34 = seg3_4.p2();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FlattenedPoints return cached adaptive flattening of the curve.
+ * @return list of points.
+ */
+QVector<QPointF> VAbstractCubicBezier::FlattenedPoints() const
+{
+    return GetLengthTable()->points;
+}
 
-    QLineF seg23_34 ( p23, p34 );
-    seg23_34.setLength(seg23_34.length () * t);
-    const QPointF p234 = seg23_34.p2();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CurveLength return cached length of the curve.
+ * @return length.
+ */
+qreal VAbstractCubicBezier::CurveLength() const
+{
+    return GetLengthTable()->length;
+}
 
-    QLineF seg123_234 ( p123, p234 );
-    seg123_234.setLength(seg123_234.length () * t);
-    const QPointF p1234 = seg123_234.p2();
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ResetLengthTable drop the arc-length table. Must be called by every setter that changes the geometry.
+ */
+void VAbstractCubicBezier::ResetLengthTable()
+{
+    std::atomic_store(&lengthTable, std::shared_ptr<const LengthTable>());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GetLengthTable return the arc-length table, building it on first use.
+ *
+ * The table is immutable once published, so copies of a curve share it and concurrent readers either see a complete
+ * table or build their own identical one.
+ */
+std::shared_ptr<const VAbstractCubicBezier::LengthTable> VAbstractCubicBezier::GetLengthTable() const
+{
+    std::shared_ptr<const LengthTable> table = std::atomic_load(&lengthTable);
+    if (table)
+    {
+        return table;
+    }
+
+    const QPointF p1 = static_cast<QPointF>(GetP1());
+    const QPointF p2 = GetControlPoint1();
+    const QPointF p3 = GetControlPoint2();
+    const QPointF p4 = static_cast<QPointF>(GetP4());
+
+    std::shared_ptr<LengthTable> newTable = std::make_shared<LengthTable>();
+    newTable->points = GetCubicBezierPoints(p1, p2, p3, p4);
+    newTable->length = LengthBezier(p1, p2, p3, p4);
+
+    // Control polygon length is an upper bound of the curve length. Half a millimeter between samples keeps linear
+    // interpolation of t well below the tolerance tools work with.
+    const qreal polygon = QLineF(p1, p2).length() + QLineF(p2, p3).length() + QLineF(p3, p4).length();
+    const int segments = qBound(32, qCeil(polygon / ToPixel(0.5, Unit::Mm)), 4096);
+
+    newTable->cumulative.reserve(segments + 1);
+    newTable->cumulative.append(0);
+    QPointF previous = p1;
+    for (int i = 1; i <= segments; ++i)
+    {
+        const QPointF current = PointAtT(p1, p2, p3, p4, static_cast<qreal>(i) / segments);
+        newTable->cumulative.append(newTable->cumulative.last() + QLineF(previous, current).length());
+        previous = current;
+    }
 
-    return LengthBezier ( static_cast<QPointF>(GetP1()), p12, p123, p1234);
+    table = newTable;
+    std::atomic_store(&lengthTable, table);
+    return table;
 }
@@ -53,10 +53,12 @@
 #define VABSTRACTCUBICBEZIER_H
 
 #include <qcompilerdetection.h>
+#include <QLineF>
 #include <QPointF>
 #include <QString>
 #include <QVector>
 #include <QtGlobal>
+#include <memory>
 
 #include "../ifc/ifcdef.h"
 #include "vabstractbezier.h"
@@ -72,6 +74,8 @@ class VAbstractCubicBezier : public VAbstractBezier
     VAbstractCubicBezier& operator= (const VAbstractCubicBezier &curve);
     virtual ~VAbstractCubicBezier();
 
+	void Swap(VAbstractCubicBezier &curve) Q_DECL_NOTHROW;
+
     virtual VPointF GetP1 () const =0;
     virtual VPointF GetP2 () const =0;
     virtual VPointF GetP3 () const =0;
@@ -84,6 +88,8 @@ class VAbstractCubicBezier : public VAbstractBezier
     qreal GetParmT(qreal length) const;
     qreal LengthT(qreal t) const;
 
+    virtual QVector<QPointF> IntersectLine(const QLineF &line) const Q_DECL_OVERRIDE;
+
 protected:
     virtual void CreateName() Q_DECL_OVERRIDE;
 
@@ -93,9 +99,23 @@ class VAbstractCubicBezier : public VAbstractBezier
     static QVector<QPointF> GetCubicBezierPoints(const QPointF &p1, const QPointF &p2, const QPointF &p3,
                                                  const QPointF &p4);
     static qreal            LengthBezier(const QPointF &p1, const QPointF &p2, const QPointF &p3, const QPointF &p4);
+    static QVector<QPointF> BezierIntersectLine(const QPointF &p1, const QPointF &p2, const QPointF &p3,
+                                                const QPointF &p4, const QLineF &line);
 
     virtual QPointF GetControlPoint1() const =0;
     virtual QPointF GetControlPoint2() const =0;
+
+    QVector<QPointF> FlattenedPoints() const;
+    qreal            CurveLength() const;
+    void             ResetLengthTable();
+
+private:
+    struct LengthTable;
+
+    /** @brief lengthTable lazily built arc-length lookup table, shared between copies of the same geometry. */
+    mutable std::shared_ptr<const LengthTable> lengthTable;
+
+    std::shared_ptr<const LengthTable> GetLengthTable() const;
 };
 
 #endif // VABSTRACTCUBICBEZIER_H
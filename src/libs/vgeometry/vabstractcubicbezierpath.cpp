@@ -137,6 +137,30 @@ qreal VAbstractCubicBezierPath::GetLength() const
     return length;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectLine return list of points for real intersection with line
+ * @param line line that intersect with curve
+ * @return list of intersection points
+ */
+QVector<QPointF> VAbstractCubicBezierPath::IntersectLine(const QLineF &line) const
+{
+    QVector<QPointF> intersections;
+    for (qint32 i = 1; i <= CountSubSpl(); ++i)
+    {
+        const QVector<QPointF> points = GetSpline(i).IntersectLine(line);
+        for (int j = 0; j < points.size(); ++j)
+        {
+            // Neighbor splines share the end point
+            if (intersections.isEmpty() || not VFuzzyComparePoints(intersections.last(), points.at(j)))
+            {
+                intersections.append(points.at(j));
+            }
+        }
+    }
+    return intersections;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<DirectionArrow> VAbstractCubicBezierPath::DirectionArrows() const
 {
@@ -85,6 +85,7 @@ class VAbstractCubicBezierPath : public VAbstractBezier
     virtual QPainterPath     GetPath() const Q_DECL_OVERRIDE;
     virtual QVector<QPointF> getPoints() const Q_DECL_OVERRIDE;
     virtual qreal            GetLength() const Q_DECL_OVERRIDE;
+    virtual QVector<QPointF> IntersectLine(const QLineF &line) const Q_DECL_OVERRIDE;
 
     virtual QVector<DirectionArrow> DirectionArrows() const Q_DECL_OVERRIDE;
 
@@ -57,9 +57,127 @@
 #include <QPainterPath>
 #include <QPoint>
 #include <QtDebug>
+#include <algorithm>
 
 #include "vabstractcurve_p.h"
 
+namespace
+{
+// 16-point Gauss-Legendre rule on [-1, 1]. The rule is symmetric, only positive abscissae are stored.
+const qreal gaussAbscissae[] = {0.0950125098376374, 0.2816035507792589, 0.4580167776572274, 0.6178762444026438,
+                                0.7554044083550030, 0.8656312023878318, 0.9445750230732326, 0.9894009349916499};
+const qreal gaussWeights[]   = {0.1894506104550685, 0.1826034150449236, 0.1691565193950025, 0.1495959888165767,
+                                0.1246289712555339, 0.0951585116824928, 0.0622535239386479, 0.0271524594117541};
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal GaussLegendre(const std::function<qreal (qreal)> &f, qreal a, qreal b)
+{
+    const qreal half = (b - a) / 2;
+    const qreal middle = (a + b) / 2;
+    qreal sum = 0;
+    for (int i = 0; i < 8; ++i)
+    {
+        sum += gaussWeights[i] * (f(middle - half * gaussAbscissae[i]) + f(middle + half * gaussAbscissae[i]));
+    }
+    return sum * half;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal AdaptiveGaussLegendre(const std::function<qreal (qreal)> &f, qreal a, qreal b, qreal whole, qreal tolerance,
+                            int depth)
+{
+    const qreal middle = (a + b) / 2;
+    const qreal left = GaussLegendre(f, a, middle);
+    const qreal right = GaussLegendre(f, middle, b);
+
+    if (depth <= 0 || qAbs(left + right - whole) <= tolerance)
+    {
+        return left + right;
+    }
+
+    return AdaptiveGaussLegendre(f, a, middle, left, tolerance / 2, depth - 1) +
+           AdaptiveGaussLegendre(f, middle, b, right, tolerance / 2, depth - 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+struct PolylineRange
+{
+    int   begin;
+    int   end;
+    qreal minX;
+    qreal minY;
+    qreal maxX;
+    qreal maxY;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+PolylineRange MakeRange(const QVector<QPointF> &points, int begin, int end)
+{
+    PolylineRange range{begin, end, points.at(begin).x(), points.at(begin).y(), points.at(begin).x(),
+                        points.at(begin).y()};
+    for (int i = begin + 1; i <= end; ++i)
+    {
+        range.minX = qMin(range.minX, points.at(i).x());
+        range.minY = qMin(range.minY, points.at(i).y());
+        range.maxX = qMax(range.maxX, points.at(i).x());
+        range.maxY = qMax(range.maxY, points.at(i).y());
+    }
+    return range;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+struct PolylineCrossing
+{
+    int     segment1;
+    int     segment2;
+    QPointF point;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PolylinesIntersection recursively split both polylines, dropping pairs of pieces with disjoint bounding
+ * boxes. Only pairs of single segments that survive are really intersected.
+ */
+void PolylinesIntersection(const QVector<QPointF> &points1, const PolylineRange &range1,
+                           const QVector<QPointF> &points2, const PolylineRange &range2,
+                           QVector<PolylineCrossing> &crossings)
+{
+    if (range1.maxX < range2.minX || range2.maxX < range1.minX ||
+        range1.maxY < range2.minY || range2.maxY < range1.minY)
+    {
+        return;
+    }
+
+    const int segments1 = range1.end - range1.begin;
+    const int segments2 = range2.end - range2.begin;
+
+    if (segments1 == 1 && segments2 == 1)
+    {
+        QPointF crosPoint;
+        const QLineF line(points1.at(range1.begin), points1.at(range1.end));
+        const auto type = line.intersects(QLineF(points2.at(range2.begin), points2.at(range2.end)), &crosPoint);
+        if (type == QLineF::BoundedIntersection)
+        {
+            crossings.append({range1.begin, range2.begin, crosPoint});
+        }
+        return;
+    }
+
+    if (segments1 >= segments2)
+    {
+        const int middle = range1.begin + segments1 / 2;
+        PolylinesIntersection(points1, MakeRange(points1, range1.begin, middle), points2, range2, crossings);
+        PolylinesIntersection(points1, MakeRange(points1, middle, range1.end), points2, range2, crossings);
+    }
+    else
+    {
+        const int middle = range2.begin + segments2 / 2;
+        PolylinesIntersection(points1, range1, points2, MakeRange(points2, range2.begin, middle), crossings);
+        PolylinesIntersection(points1, range1, points2, MakeRange(points2, middle, range2.end), crossings);
+    }
+}
+}
+
 const qreal VAbstractCurve::lengthCurveDirectionArrow = 14;
 
 #ifdef Q_COMPILER_RVALUE_REFS
@@ -347,6 +465,42 @@ QVector<QPointF> VAbstractCurve::CurveIntersectLine(const QVector<QPointF> &poin
     return intersections;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CurvesIntersection return list of intersection points of two curves given as polylines.
+ *
+ * Result is the same as intersecting each segment of the first curve with the second curve one by one, but pieces of
+ * the curves that cannot touch are rejected by bounding boxes.
+ * @param curve1Points points of the first curve.
+ * @param curve2Points points of the second curve.
+ * @return list of intersection points in the order of the first curve segments.
+ */
+QVector<QPointF> VAbstractCurve::CurvesIntersection(const QVector<QPointF> &curve1Points,
+                                                    const QVector<QPointF> &curve2Points)
+{
+    QVector<QPointF> intersections;
+    if (curve1Points.size() < 2 || curve2Points.size() < 2)
+    {
+        return intersections;
+    }
+
+    QVector<PolylineCrossing> crossings;
+    PolylinesIntersection(curve1Points, MakeRange(curve1Points, 0, curve1Points.size() - 1),
+                          curve2Points, MakeRange(curve2Points, 0, curve2Points.size() - 1), crossings);
+
+    std::sort(crossings.begin(), crossings.end(), [](const PolylineCrossing &a, const PolylineCrossing &b)
+    {
+        return a.segment1 < b.segment1 || (a.segment1 == b.segment1 && a.segment2 < b.segment2);
+    });
+
+    intersections.reserve(crossings.size());
+    for (int i = 0; i < crossings.size(); ++i)
+    {
+        intersections.append(crossings.at(i).point);
+    }
+    return intersections;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QVector<DirectionArrow> VAbstractCurve::DirectionArrows() const
 {
@@ -419,6 +573,28 @@ QPainterPath VAbstractCurve::ShowDirection(const QVector<DirectionArrow> &arrows
     return path;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArcLength integrate speed of a parametric curve with adaptive Gauss-Legendre quadrature.
+ *
+ * Unlike PathLength() the result does not depend on how densely the curve was flattened for drawing.
+ * @param speed length of the curve derivative for the parameter value.
+ * @param from first parameter value.
+ * @param to last parameter value.
+ * @return length of the curve between two parameter values.
+ */
+qreal VAbstractCurve::ArcLength(const std::function<qreal (qreal)> &speed, qreal from, qreal to)
+{
+    if (qFuzzyCompare(from + 1, to + 1))
+    {
+        return 0;
+    }
+
+    const qreal whole = GaussLegendre(speed, from, to);
+    const qreal tolerance = qMax(qAbs(whole) * 1e-10, 1e-10);
+    return AdaptiveGaussLegendre(speed, from, to, whole, tolerance, 12);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 qreal VAbstractCurve::PathLength(const QVector<QPointF> &path)
 {
@@ -59,6 +59,7 @@
 #include <QTypeInfo>
 #include <QVector>
 #include <QtGlobal>
+#include <functional>
 
 #include "../ifc/ifcdef.h"
 #include "../vmisc/vmath.h"
@@ -117,6 +118,8 @@ class VAbstractCurve :public VGObject
     QPointF                  getLastPoint();
 
     static QVector<QPointF>  CurveIntersectLine(const QVector<QPointF> &points, const QLineF &line);
+    static QVector<QPointF>  CurvesIntersection(const QVector<QPointF> &curve1Points,
+                                                const QVector<QPointF> &curve2Points);
 
     virtual QString          NameForHistory(const QString &toolName) const=0;
     virtual QVector<DirectionArrow> DirectionArrows() const;
@@ -125,6 +128,8 @@ class VAbstractCurve :public VGObject
     static const qreal lengthCurveDirectionArrow;
 protected:
     virtual void             CreateName() =0;
+
+    static qreal             ArcLength(const std::function<qreal (qreal)> &speed, qreal from, qreal to);
 private:
     QSharedDataPointer<VAbstractCurveData> d;
 
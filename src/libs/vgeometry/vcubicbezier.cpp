@@ -152,6 +152,7 @@ VPointF VCubicBezier::GetP1() const
 void VCubicBezier::SetP1(const VPointF &p)
 {
     d->p1 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -164,6 +165,7 @@ VPointF VCubicBezier::GetP2() const
 void VCubicBezier::SetP2(const VPointF &p)
 {
     d->p2 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -176,6 +178,7 @@ VPointF VCubicBezier::GetP3() const
 void VCubicBezier::SetP3(const VPointF &p)
 {
     d->p3 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -188,6 +191,7 @@ VPointF VCubicBezier::GetP4() const
 void VCubicBezier::SetP4(const VPointF &p)
 {
     d->p4 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -209,8 +213,7 @@ qreal VCubicBezier::GetEndAngle() const
  */
 qreal VCubicBezier::GetLength() const
 {
-    return LengthBezier (static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                         static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+    return CurveLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -220,8 +223,7 @@ qreal VCubicBezier::GetLength() const
  */
 QVector<QPointF> VCubicBezier::getPoints() const
 {
-    return GetCubicBezierPoints(static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+    return FlattenedPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
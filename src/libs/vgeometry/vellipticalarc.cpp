@@ -197,7 +197,40 @@ VEllipticalArc::~VEllipticalArc()
  */
 qreal VEllipticalArc::GetLength() const
 {
-    qreal length = PathLength(getPoints());
+    // Integrate exactly the arc getPoints() draws: same parametric angles and the same transformation.
+    const QPointF center = VAbstractArc::GetCenter().toQPointF();
+
+    QLineF startLine(center.x(), center.y(), center.x() + d->radius1, center.y());
+    QLineF endLine = startLine;
+
+    startLine.setAngle(VAbstractArc::GetStartAngle());
+    endLine.setAngle(getRealEndAngle());
+    qreal sweepAngle = startLine.angleTo(endLine);
+
+    if (qFuzzyIsNull(sweepAngle))
+    {
+        sweepAngle = 360;
+    }
+
+    QTransform t = d->m_transform;
+    t.translate(center.x(), center.y());
+    t.rotate(-GetRotationAngle());
+    t.translate(-center.x(), -center.y());
+
+    const qreal radius1 = d->radius1;
+    const qreal radius2 = d->radius2;
+    const auto speed = [t, radius1, radius2](qreal angle)
+    {
+        // Derivative of (radius1*cos(angle), -radius2*sin(angle)), translation does not change length
+        const qreal dx = -radius1 * qSin(angle);
+        const qreal dy = -radius2 * qCos(angle);
+        const qreal mx = t.m11() * dx + t.m21() * dy;
+        const qreal my = t.m12() * dx + t.m22() * dy;
+        return qSqrt(mx * mx + my * my);
+    };
+
+    const qreal startAngle = qDegreesToRadians(VAbstractArc::GetStartAngle());
+    qreal length = ArcLength(speed, startAngle, startAngle + qDegreesToRadians(sweepAngle));
 
     if (IsFlipped())
     {
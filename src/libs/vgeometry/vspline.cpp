@@ -199,8 +199,7 @@ VSpline::~VSpline()
  */
 qreal VSpline::GetLength () const
 {
-    return LengthBezier ( static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()), static_cast<QPointF>(GetP3()),
-                          static_cast<QPointF>(GetP4()));
+    return CurveLength();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -224,8 +223,7 @@ QPointF VSpline::CutSpline(qreal length, VSpline &spl1, VSpline &spl2) const
  */
 QVector<QPointF> VSpline::getPoints() const
 {
-    return GetCubicBezierPoints(static_cast<QPointF>(GetP1()), static_cast<QPointF>(GetP2()),
-                                static_cast<QPointF>(GetP3()), static_cast<QPointF>(GetP4()));
+    return FlattenedPoints();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -284,6 +282,7 @@ VPointF VSpline::GetP1() const
 void VSpline::SetP1(const VPointF &p)
 {
     d->p1 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -324,6 +323,7 @@ VPointF VSpline::GetP4() const
 void VSpline::SetP4(const VPointF &p)
 {
     d->p4 = p;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -363,6 +363,7 @@ void VSpline::SetStartAngle(qreal angle, const QString &formula)
 {
     d->angle1 = angle;
     d->angle1F = formula;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -370,6 +371,7 @@ void VSpline::SetEndAngle(qreal angle, const QString &formula)
 {
     d->angle2 = angle;
     d->angle2F = formula;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -401,6 +403,7 @@ void VSpline::SetC1Length(qreal length, const QString &formula)
 {
     d->c1Length = length;
     d->c1LengthF = formula;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -408,6 +411,7 @@ void VSpline::SetC2Length(qreal length, const QString &formula)
 {
     d->c2Length = length;
     d->c2LengthF = formula;
+    ResetLengthTable();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -55,12 +55,122 @@
 #include "../vgeometry/vpointf.h"
 
 #include <QLineF>
+#include <QRectF>
 #include <QSet>
 #include <QVector>
 #include <QPainterPath>
+#include <QPolygonF>
+#include <QtMath>
+#include <algorithm>
+#include <functional>
 
 const qreal maxL = 2.4;
 
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The SegmentGrid class buckets the segments of a path into a uniform grid.
+ *
+ * Segment j goes from point j to point j+1, the last one goes back to the first point. Two segments can intersect or
+ * overlap only if their bounding boxes, grown by the margin, share a cell.
+ */
+class SegmentGrid
+{
+public:
+    SegmentGrid(const QVector<QPointF> &points, qreal margin);
+
+    QVector<qint32> Candidates(qint32 segment, qint32 from);
+
+private:
+    const QVector<QPointF> &points;
+    const qreal margin;
+    QRectF      bounds;
+    int         side;
+    qreal       cellWidth;
+    qreal       cellHeight;
+    QVector<QVector<qint32>> cells;
+    QVector<qint32> stamp;
+
+    QRectF SegmentRect(qint32 segment) const;
+    void   ForEachCell(const QRectF &rect, const std::function<void(QVector<qint32> &cell)> &func);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+SegmentGrid::SegmentGrid(const QVector<QPointF> &points, qreal margin)
+    : points(points),
+      margin(margin),
+      bounds(),
+      side(1),
+      cellWidth(1),
+      cellHeight(1),
+      cells(),
+      stamp(points.size(), -1)
+{
+    const qint32 count = points.size();
+    bounds = QPolygonF(points).boundingRect().adjusted(-margin, -margin, margin, margin);
+
+    side = qBound(1, qCeil(qSqrt(count)), 1024);
+    cellWidth = qMax(bounds.width() / side, margin);
+    cellHeight = qMax(bounds.height() / side, margin);
+    cells.resize(side * side);
+
+    for (qint32 j = 0; j < count; ++j)
+    {
+        ForEachCell(SegmentRect(j), [j](QVector<qint32> &cell){cell.append(j);});
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Candidates returns segments not less than from that may touch the segment, in descending order.
+ */
+QVector<qint32> SegmentGrid::Candidates(qint32 segment, qint32 from)
+{
+    QVector<qint32> candidates;
+    ForEachCell(SegmentRect(segment), [this, segment, from, &candidates](QVector<qint32> &cell)
+    {
+        for (int k = 0; k < cell.size(); ++k)
+        {
+            const qint32 j = cell.at(k);
+            if (j >= from && stamp.at(j) != segment)
+            {
+                stamp[j] = segment;
+                candidates.append(j);
+            }
+        }
+    });
+
+    std::sort(candidates.begin(), candidates.end(), std::greater<qint32>());
+    return candidates;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF SegmentGrid::SegmentRect(qint32 segment) const
+{
+    const QPointF &p1 = points.at(segment);
+    const QPointF &p2 = points.at(segment == points.size()-1 ? 0 : segment+1);
+    return QRectF(p1, p2).normalized().adjusted(-margin, -margin, margin, margin);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SegmentGrid::ForEachCell(const QRectF &rect, const std::function<void(QVector<qint32> &cell)> &func)
+{
+    const int left = qBound(0, static_cast<int>((rect.left() - bounds.left()) / cellWidth), side - 1);
+    const int right = qBound(0, static_cast<int>((rect.right() - bounds.left()) / cellWidth), side - 1);
+    const int top = qBound(0, static_cast<int>((rect.top() - bounds.top()) / cellHeight), side - 1);
+    const int bottom = qBound(0, static_cast<int>((rect.bottom() - bounds.top()) / cellHeight), side - 1);
+
+    for (int row = top; row <= bottom; ++row)
+    {
+        for (int column = left; column <= right; ++column)
+        {
+            func(cells[row * side + column]);
+        }
+    }
+}
+}
+
 #ifdef Q_COMPILER_RVALUE_REFS
 VAbstractPiece &VAbstractPiece::operator=(VAbstractPiece &&piece) Q_DECL_NOTHROW
 { Swap(piece); return *this; }
@@ -325,6 +435,9 @@ QVector<QPointF> VAbstractPiece::CheckLoops(const QVector<QPointF> &points)
 
     QVector<QPointF> ekvPoints;
 
+    // Only segments close to segment i can make a loop with it. Margin covers the tolerance of collinear overlaps.
+    SegmentGrid grid(points, accuracyPointOnLine);
+
     qint32 i, j, jNext = 0;
     for (i = 0; i < count; ++i)
     {
@@ -343,8 +456,10 @@ QVector<QPointF> VAbstractPiece::CheckLoops(const QVector<QPointF> &points)
         const QLineF line1(points.at(i), points.at(i+1));
         // Because a path can contains several loops we will seek the last and only then remove the loop(s)
         // That's why we parse from the end
-        for (j = count-1; j >= i+2; --j)
+        const QVector<qint32> candidates = grid.Candidates(i, i+2);
+        for (int c = 0; c < candidates.size(); ++c)
         {
+            j = candidates.at(c);
             j == count-1 ? jNext = 0 : jNext = j+1;
             QLineF line2(points.at(j), points.at(jNext));
 
@@ -63,35 +63,32 @@ VBestSquare::VBestSquare(const QSizeF &sheetSize, bool saveLength)
     , valideResult(false)
     , resMirror(false), type (BestFrom::Rotation)
     , saveLength(saveLength)
+    , maxSquare(Square(bestSize))
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief NewResult keeps the candidate if it ranks higher than the current best result. A combine candidate always
+ * ranks higher than a rotation one, inside one type the smaller square wins and on a tie the later candidate wins.
+ *
+ * The ranking doesn't depend on the order candidates come in, so positions checked in parallel give the same best
+ * result as the serial search and candidates which can't win may be skipped.
+ */
 void VBestSquare::NewResult(const QSizeF &candidate, int i, int j, const QTransform &transform, bool mirror, BestFrom type)
 {
-    if (saveLength)
+    const QSizeF size = saveLength ? QSizeF(sheetWidth, candidate.height()) : candidate;
+    const qint64 square = Square(size);
+    if (square <= 0 || square > maxSquare)
     {
-        const QSizeF saveLengthSize(sheetWidth, candidate.height());
-        if (Square(saveLengthSize) <= Square(bestSize) && Square(saveLengthSize) > 0 && type >= this->type)
-        {
-            bestSize = saveLengthSize;
-        }
-        else
-        {
-            return;
-        }
+        return;
     }
-    else
+
+    if (valideResult && (type < this->type || (type == this->type && square > Square(bestSize))))
     {
-        if (Square(candidate) <= Square(bestSize) && Square(candidate) > 0 && type >= this->type)
-        {
-            bestSize = candidate;
-        }
-        else
-        {
-            return;
-        }
+        return;
     }
 
+    bestSize = size;
     resI = i;
     resJ = j;
     resTransform = transform;
@@ -157,6 +154,26 @@ bool VBestSquare::IsSaveLength() const
     return saveLength;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+qint64 VBestSquare::BestSquare() const
+{
+    return Square(bestSize);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CandidateSquare return square that will be compared with the best result if candidate size will be passed to
+ * NewResult(). Take into account save length mode.
+ */
+qint64 VBestSquare::CandidateSquare(const QSizeF &candidate) const
+{
+    if (saveLength)
+    {
+        return Square(QSizeF(sheetWidth, candidate.height()));
+    }
+    return Square(candidate);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 qint64 VBestSquare::Square(const QSizeF &size)
 {
@@ -76,6 +76,9 @@ class VBestSquare
 
     bool IsSaveLength() const;
 
+    qint64 BestSquare() const;
+    qint64 CandidateSquare(const QSizeF &candidate) const;
+
 private:
     // All nedded information about best result
     int resI; // Edge of global contour
@@ -87,6 +90,7 @@ class VBestSquare
     bool resMirror;
     BestFrom type;
     bool saveLength;
+    qint64 maxSquare; // Candidates bigger than the sheet are never accepted
 
     static qint64 Square(const QSizeF &size);
 };
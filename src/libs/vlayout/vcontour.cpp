@@ -51,6 +51,7 @@
 
 #include "vcontour.h"
 
+#include <algorithm>
 #include <QLineF>
 #include <QPainterPath>
 #include <QPoint>
@@ -63,6 +64,151 @@
 #include "vlayoutpiece.h"
 #include "../vmisc/vmath.h"
 
+namespace
+{
+// Limit memory used by the edges index. Too small cells don't give any advantage anyway.
+const int maxCellsPerSide = 256;
+
+//---------------------------------------------------------------------------------------------------------------------
+inline bool IsNull(qreal value)
+{
+    return qAbs(value) <= 1e-12;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline bool ComparePoints(const QPointF &a, const QPointF &b)
+{
+    return IsNull(a.x() - b.x()) && IsNull(a.y() - b.y());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Dot(const QPointF &a, const QPointF &b)
+{
+    return a.x() * b.x() + a.y() * b.y();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LinesIntersect check if two segments intersect. Touching and overlapping segments also intersect.
+ *
+ * Follows rules QPainterPath::intersects() uses for segments to keep results of layout the same.
+ */
+bool LinesIntersect(const QLineF &a, const QLineF &b)
+{
+    const QPointF p1 = a.p1();
+    const QPointF p2 = a.p2();
+    const QPointF q1 = b.p1();
+    const QPointF q2 = b.p2();
+
+    if (ComparePoints(p1, p2) || ComparePoints(q1, q2))
+    {
+        return false;
+    }
+
+    if ((ComparePoints(p1, q1) && ComparePoints(p2, q2)) || (ComparePoints(p1, q2) && ComparePoints(p2, q1)))
+    {
+        return true;
+    }
+
+    const QPointF pDelta = p2 - p1;
+    const QPointF qDelta = q2 - q1;
+
+    const qreal par = pDelta.x() * qDelta.y() - pDelta.y() * qDelta.x();
+
+    if (qFuzzyIsNull(par))
+    {
+        const QPointF normal(-pDelta.y(), pDelta.x());
+
+        // coinciding?
+        if (qFuzzyIsNull(Dot(normal, q1 - p1)))
+        {
+            const qreal dp = Dot(pDelta, pDelta);
+
+            const qreal tq1 = Dot(pDelta, q1 - p1);
+            const qreal tq2 = Dot(pDelta, q2 - p1);
+
+            if ((tq1 > 0 && tq1 < dp) || (tq2 > 0 && tq2 < dp))
+            {
+                return true;
+            }
+
+            const qreal dq = Dot(qDelta, qDelta);
+
+            const qreal tp1 = Dot(qDelta, p1 - q1);
+            const qreal tp2 = Dot(qDelta, p2 - q1);
+
+            if ((tp1 > 0 && tp1 < dq) || (tp2 > 0 && tp2 < dq))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const qreal invPar = 1 / par;
+
+    const qreal tp = (qDelta.y() * (q1.x() - p1.x()) - qDelta.x() * (q1.y() - p1.y())) * invPar;
+
+    if (tp < 0 || tp > 1)
+    {
+        return false;
+    }
+
+    const qreal tq = (pDelta.y() * (q1.x() - p1.x()) - pDelta.x() * (q1.y() - p1.y())) * invPar;
+
+    return tq >= 0 && tq <= 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal IsLeft(const QLineF &edge, const QPointF &point)
+{
+    return (edge.x2() - edge.x1()) * (point.y() - edge.y1()) - (point.x() - edge.x1()) * (edge.y2() - edge.y1());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Winding add edge contribution to the winding number of the point. Only edges to the right of the point count.
+ */
+inline void Winding(const QLineF &edge, const QPointF &point, int &winding)
+{
+    if (edge.y1() <= point.y())
+    {
+        if (edge.y2() > point.y() && IsLeft(edge, point) > 0)
+        {
+            ++winding;
+        }
+    }
+    else if (edge.y2() <= point.y() && IsLeft(edge, point) < 0)
+    {
+        --winding;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool PolygonContains(const QVector<QPointF> &polygon, const QPointF &point)
+{
+    int winding = 0;
+    for (int i = 0; i < polygon.size(); ++i)
+    {
+        Winding(QLineF(polygon.at(i), polygon.at((i + 1) % polygon.size())), point, winding);
+    }
+    return winding != 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline QRectF EdgeRect(const QLineF &edge)
+{
+    return QRectF(edge.p1(), edge.p2()).normalized();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline bool RectsOverlap(const QRectF &r1, const QRectF &r2)
+{
+    return not (r1.left() > r2.right() || r1.right() < r2.left() || r1.top() > r2.bottom() || r1.bottom() < r2.top());
+}
+}
+
 #ifdef Q_COMPILER_RVALUE_REFS
 VContour &VContour::operator=(VContour &&contour) Q_DECL_NOTHROW { Swap(contour); return *this; }
 #endif
@@ -104,6 +250,7 @@ VContour::~VContour()
 void VContour::SetContour(const QVector<QPointF> &contour)
 {
     d->globalContour = contour;
+    BuildIndex();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -389,3 +536,201 @@ QLineF VContour::EmptySheetEdge() const
 {
     return QLineF(0, 0, d->paperWidth - 5, 0);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Intersects check if closed polygon intersects or touches area inside global contour.
+ *
+ * Gives the same answer as QPainterPath::intersects() for contour path and polygon path, but tests only edges which
+ * are close to the polygon edges. Candidates are taken from the edges index.
+ * @param points polygon points. Polygon will be closed automatically.
+ */
+bool VContour::Intersects(const QVector<QPointF> &points) const
+{
+    if (d->globalContour.size() < 2 || points.size() < 2)
+    {
+        return false;
+    }
+
+    QVector<QPointF> polygon = points;
+    polygon.append(polygon.first());
+    const QRectF polygonRect = QPolygonF(polygon).boundingRect();
+
+    if (not RectsOverlap(d->indexRect, polygonRect))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < polygon.size() - 1; ++i)
+    {
+        const QLineF edge(polygon.at(i), polygon.at(i + 1));
+        const QRectF edgeRect = EdgeRect(edge);
+
+        int column1 = 0, row1 = 0, column2 = 0, row2 = 0;
+        if (not CellRange(edgeRect, column1, row1, column2, row2))
+        {
+            continue;
+        }
+
+        for (int row = row1; row <= row2; ++row)
+        {
+            for (int column = column1; column <= column2; ++column)
+            {
+                const int cell = row * d->columns + column;
+                for (int k = d->cellStart.at(cell); k < d->cellStart.at(cell + 1); ++k)
+                {
+                    const QLineF gEdge = IndexEdge(d->cellEdges.at(k));
+                    if (RectsOverlap(edgeRect, EdgeRect(gEdge)) && LinesIntersect(gEdge, edge))
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+    }
+
+    // No edges intersect. Polygons intersect only if one contains another.
+    if (ContourContains(polygon.first()))
+    {
+        return true;
+    }
+
+    const QPointF first = d->globalContour.first();
+    return polygonRect.contains(first) && PolygonContains(points, first);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BuildIndex build uniform grid over contour edges. Each cell keeps edges whose bounding rect overlaps the cell.
+ */
+void VContour::BuildIndex()
+{
+    d->cellStart.clear();
+    d->cellEdges.clear();
+    d->columns = 0;
+    d->rows = 0;
+    d->indexRect = QRectF();
+
+    const int count = d->globalContour.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    d->indexRect = BoundingRect();
+
+    const int cellsPerSide = qBound(1, qCeil(qSqrt(count)), maxCellsPerSide);
+    d->cellSize = qMax(qMax(d->indexRect.width(), d->indexRect.height()) / cellsPerSide, 1.0);
+    d->columns = qMax(1, qCeil(d->indexRect.width() / d->cellSize));
+    d->rows = qMax(1, qCeil(d->indexRect.height() / d->cellSize));
+
+    const int cells = d->columns * d->rows;
+    QVector<int> counts(cells + 1, 0);
+
+    // First pass count edges in each cell, second pass fill cells.
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            int column1 = 0, row1 = 0, column2 = 0, row2 = 0;
+            CellRange(EdgeRect(IndexEdge(i)), column1, row1, column2, row2);
+
+            for (int row = row1; row <= row2; ++row)
+            {
+                for (int column = column1; column <= column2; ++column)
+                {
+                    const int cell = row * d->columns + column;
+                    if (pass == 0)
+                    {
+                        ++counts[cell];
+                    }
+                    else
+                    {
+                        d->cellEdges[counts[cell]++] = i;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0)
+        {
+            d->cellStart.resize(cells + 1);
+            int total = 0;
+            for (int cell = 0; cell < cells; ++cell)
+            {
+                d->cellStart[cell] = total;
+                total += counts.at(cell);
+                counts[cell] = d->cellStart.at(cell); // Reuse as fill cursor
+            }
+            d->cellStart[cells] = total;
+            d->cellEdges.resize(total);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CellRange find range of grid cells covered by the rect.
+ * @return false if rect is out of indexed area.
+ */
+bool VContour::CellRange(const QRectF &rect, int &column1, int &row1, int &column2, int &row2) const
+{
+    if (d->columns <= 0 || d->rows <= 0 || not RectsOverlap(d->indexRect, rect))
+    {
+        return false;
+    }
+
+    column1 = qBound(0, qFloor((rect.left() - d->indexRect.left()) / d->cellSize), d->columns - 1);
+    column2 = qBound(0, qFloor((rect.right() - d->indexRect.left()) / d->cellSize), d->columns - 1);
+    row1 = qBound(0, qFloor((rect.top() - d->indexRect.top()) / d->cellSize), d->rows - 1);
+    row2 = qBound(0, qFloor((rect.bottom() - d->indexRect.top()) / d->cellSize), d->rows - 1);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QLineF VContour::IndexEdge(int i) const
+{
+    return QLineF(d->globalContour.at(i), d->globalContour.at((i + 1) % d->globalContour.size()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ContourContains check if point is inside closed global contour (winding fill rule).
+ *
+ * Only edges to the right of the point change winding number, so it is enough to check cells of the point row
+ * starting from the point column.
+ */
+bool VContour::ContourContains(const QPointF &point) const
+{
+    if (not d->indexRect.contains(point))
+    {
+        return false;
+    }
+
+    int column1 = 0, row1 = 0, column2 = 0, row2 = 0;
+    if (not CellRange(QRectF(point, point), column1, row1, column2, row2))
+    {
+        return false;
+    }
+
+    QVector<int> edges;
+    for (int column = column1; column < d->columns; ++column)
+    {
+        const int cell = row1 * d->columns + column;
+        for (int k = d->cellStart.at(cell); k < d->cellStart.at(cell + 1); ++k)
+        {
+            edges.append(d->cellEdges.at(k));
+        }
+    }
+
+    // Edge can be registered in several cells
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    int winding = 0;
+    for (int i = 0; i < edges.size(); ++i)
+    {
+        Winding(IndexEdge(edges.at(i)), point, winding);
+    }
+    return winding != 0;
+}
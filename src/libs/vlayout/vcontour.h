@@ -111,9 +111,16 @@ class VContour
 
     QPainterPath ContourPath() const;
 
+    bool Intersects(const QVector<QPointF> &points) const;
+
 private:
     QSharedDataPointer<VContourData> d;
 
+    void BuildIndex();
+    bool CellRange(const QRectF &rect, int &column1, int &row1, int &column2, int &row2) const;
+    QLineF IndexEdge(int i) const;
+    bool ContourContains(const QPointF &point) const;
+
     void AppendWhole(QVector<QPointF> &contour, const VLayoutPiece &detail, int detJ) const;
 };
 
@@ -54,6 +54,8 @@
 
 #include <QSharedData>
 #include <QPointF>
+#include <QRectF>
+#include <QVector>
 
 #include "../vmisc/diagnostic.h"
 
@@ -65,16 +67,20 @@ class VContourData : public QSharedData
 {
 public:
     VContourData()
-        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(0), paperWidth(0), shift(0), indexRect(), cellSize(1),
+          columns(0), rows(0), cellStart(), cellEdges()
     {}
 
     VContourData(int height, int width)
-        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0)
+        :globalContour(QVector<QPointF>()), paperHeight(height), paperWidth(width), shift(0), indexRect(), cellSize(1),
+          columns(0), rows(0), cellStart(), cellEdges()
     {}
 
     VContourData(const VContourData &contour)
         :QSharedData(contour), globalContour(contour.globalContour), paperHeight(contour.paperHeight),
-          paperWidth(contour.paperWidth), shift(contour.shift)
+          paperWidth(contour.paperWidth), shift(contour.shift), indexRect(contour.indexRect),
+          cellSize(contour.cellSize), columns(contour.columns), rows(contour.rows), cellStart(contour.cellStart),
+          cellEdges(contour.cellEdges)
     {}
 
     ~VContourData() {}
@@ -90,6 +96,21 @@ class VContourData : public QSharedData
 
     quint32 shift;
 
+    /** @brief indexRect area covered by the edges index (uniform grid). */
+    QRectF indexRect;
+
+    /** @brief cellSize size of a grid cell side in pixels. */
+    qreal cellSize;
+
+    int columns;
+    int rows;
+
+    /** @brief cellStart for each cell position of the first edge in cellEdges. Last value is the size of cellEdges. */
+    QVector<int> cellStart;
+
+    /** @brief cellEdges indexes of contour edges sorted by cells. Edge i connects points i and i+1. */
+    QVector<int> cellEdges;
+
 private:
     VContourData &operator=(const VContourData &) Q_DECL_EQ_DELETE;
 };
@@ -12,8 +12,12 @@ HEADERS += \
     $$PWD/vcontour_p.h \
     $$PWD/vbestsquare.h \
     $$PWD/vposition.h \
+    $$PWD/vlayoutscheduler.h \
+    $$PWD/vnfpposition.h \
     $$PWD/vtextmanager.h \
     $$PWD/vposter.h \
+    $$PWD/vtiledraster.h \
+    $$PWD/vlayoutsheet.h \
     $$PWD/vgraphicsfillitem.h \
     $$PWD/vabstractpiece.h \
     $$PWD/vabstractpiece_p.h \
@@ -29,8 +33,12 @@ SOURCES += \
     $$PWD/vcontour.cpp \
     $$PWD/vbestsquare.cpp \
     $$PWD/vposition.cpp \
+    $$PWD/vlayoutscheduler.cpp \
+    $$PWD/vnfpposition.cpp \
     $$PWD/vtextmanager.cpp \
     $$PWD/vposter.cpp \
+    $$PWD/vtiledraster.cpp \
+    $$PWD/vlayoutsheet.cpp \
     $$PWD/vgraphicsfillitem.cpp \
     $$PWD/vabstractpiece.cpp \
     $$PWD/vlayoutpiece.cpp \
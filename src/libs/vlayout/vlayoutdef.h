@@ -70,6 +70,12 @@ enum class BestFrom : char
     Combine = 1
 };
 
+enum class LayoutEngine : char
+{
+    EdgeToEdge = 0,  // Align piece edges with global contour edges (VPosition)
+    NoFitPolygon = 1 // Bottom-left placement from no-fit polygons (VNfpPosition)
+};
+
 /* Warning! Debugging doesn't work stable in debug mode. If you need big allocation use release mode. Or disable
  * Address Sanitizer.
  */
@@ -51,20 +51,104 @@
 
 #include "vlayoutgenerator.h"
 
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QGraphicsRectItem>
 #include <QRectF>
+#include <QThread>
 #include <QThreadPool>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
 
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
+#include "../vmisc/vfunctiontask.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper.h"
 
+namespace
+{
+/** @brief How often (ms) the main thread wakes up while the layout attempts run. */
+const unsigned long attemptsEventsInterval = 50;
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VLayoutAttempt struct holds the settings and the outcome of one multi-start layout attempt.
+ */
+struct VLayoutAttempt
+{
+    VLayoutAttempt(Cases caseType, quint32 shift, quint32 seed)
+        : caseType(caseType),
+          shift(shift),
+          seed(seed),
+          stop(false),
+          finished(false),
+          arranged(0),
+          state(LayoutErrors::NoError),
+          papers()
+    {}
+
+    Cases                 caseType;
+    quint32               shift;
+    quint32               seed;
+    std::atomic_bool      stop;
+    std::atomic_bool      finished;
+    std::atomic_int       arranged;
+    LayoutErrors          state;
+    QVector<VLayoutPaper> papers;
+
+private:
+    Q_DISABLE_COPY(VLayoutAttempt)
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief isBetterLayout compares results of two attempts. Fewer sheets win, then the shorter total used length,
+ * then the smaller total used area.
+ */
+bool isBetterLayout(const QVector<VLayoutPaper> &candidate, const QVector<VLayoutPaper> &best)
+{
+    if (candidate.size() != best.size())
+    {
+        return candidate.size() < best.size();
+    }
+
+    qreal candidateLength = 0;
+    qreal candidateArea = 0;
+    for (int i = 0; i < candidate.size(); ++i)
+    {
+        const QRectF rect = candidate.at(i).piecesBoundingRect();
+        candidateLength += rect.height();
+        candidateArea += rect.width() * rect.height();
+    }
+
+    qreal bestLength = 0;
+    qreal bestArea = 0;
+    for (int i = 0; i < best.size(); ++i)
+    {
+        const QRectF rect = best.at(i).piecesBoundingRect();
+        bestLength += rect.height();
+        bestArea += rect.width() * rect.height();
+    }
+
+    if (not qFuzzyCompare(candidateLength, bestLength))
+    {
+        return candidateLength < bestLength;
+    }
+
+    return candidateArea < bestArea && not qFuzzyCompare(candidateArea, bestArea);
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 VLayoutGenerator::VLayoutGenerator(QObject *parent)
     : QObject(parent),
       papers(),
+      pieces(),
       bank(new VBank()),
+      caseType(Cases::CaseDesc),
       paperHeight(0),
       paperWidth(0),
       margins(),
@@ -85,7 +169,10 @@ VLayoutGenerator::VLayoutGenerator(QObject *parent)
       stripOptimizationEnabled(false),
       multiplier(1),
       stripOptimization(false),
-      textAsPaths(false)
+      textAsPaths(false),
+      engine(LayoutEngine::EdgeToEdge),
+      attempts(1),
+      timeBudget(0)
 {}
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -97,6 +184,7 @@ VLayoutGenerator::~VLayoutGenerator()
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::setPieces(const QVector<VLayoutPiece> &pieces)
 {
+    this->pieces = pieces;
     bank->setPieces(pieces);
 }
 
@@ -109,6 +197,7 @@ void VLayoutGenerator::SetLayoutWidth(qreal width)
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutGenerator::SetCaseType(Cases caseType)
 {
+    this->caseType = caseType;
     bank->SetCaseType(caseType);
 }
 
@@ -151,74 +240,258 @@ void VLayoutGenerator::Generate()
             }
         }
 
-        while (bank->allPieceCount() > 0)
+        const LayoutErrors result = attempts > 1 ? GenerateMultiStart(height, width)
+                                                 : ArrangePapers(bank, shift, height, width, stopGeneration, nullptr,
+                                                                 papers);
+        if (result != LayoutErrors::NoError)
         {
-            if (stopGeneration.load())
-            {
-                break;
-            }
+            state = result;
+            emit Error(state);
+            return;
+        }
+    }
+    else
+    {
+        state = LayoutErrors::PrepareLayoutError;
+        emit Error(state);
+        return;
+    }
+
+    if (stripOptimizationEnabled)
+    {
+        GatherPages();
+    }
 
-            VLayoutPaper paper(height, width);
-            paper.SetShift(shift);
-            paper.SetLayoutWidth(bank->GetLayoutWidth());
-            paper.SetPaperIndex(static_cast<quint32>(papers.count()));
-            paper.SetRotate(rotate);
-            paper.SetRotationIncrease(rotationIncrease);
-            paper.SetSaveLength(saveLength);
-            do
+    if (IsUnitePages())
+    {
+        UnitePages();
+    }
+
+    emit Finished();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ArrangePapers runs one greedy pass: takes pieces from the bank in its order and fills sheets one by one.
+ * @param arranged if not null receives the number of arranged pieces, otherwise progress goes to the Arranged signal.
+ */
+LayoutErrors VLayoutGenerator::ArrangePapers(VBank *bank, quint32 shift, int height, int width,
+                                             std::atomic_bool &stop, std::atomic_int *arranged,
+                                             QVector<VLayoutPaper> &result)
+{
+    while (bank->allPieceCount() > 0)
+    {
+        if (stop.load())
+        {
+            break;
+        }
+
+        VLayoutPaper paper(height, width);
+        paper.SetShift(shift);
+        paper.SetLayoutWidth(bank->GetLayoutWidth());
+        paper.SetPaperIndex(static_cast<quint32>(result.count()));
+        paper.SetRotate(rotate);
+        paper.SetRotationIncrease(rotationIncrease);
+        paper.SetSaveLength(saveLength);
+        paper.SetEngine(engine);
+        do
+        {
+            const int index = bank->GetTiket();
+            if (paper.arrangePiece(bank->getPiece(index), stop))
             {
-                const int index = bank->GetTiket();
-                if (paper.arrangePiece(bank->getPiece(index), stopGeneration))
+                bank->Arranged(index);
+                if (arranged != nullptr)
                 {
-                    bank->Arranged(index);
-                    emit Arranged(bank->ArrangedCount());
+                    arranged->store(bank->ArrangedCount());
                 }
                 else
                 {
-                    bank->NotArranged(index);
-                }
-
-                if (stopGeneration.load())
-                {
-                    break;
+                    emit Arranged(bank->ArrangedCount());
                 }
-            } while(bank->LeftArrange() > 0);
+            }
+            else
+            {
+                bank->NotArranged(index);
+            }
 
-            if (stopGeneration.load())
+            if (stop.load())
             {
                 break;
             }
+        } while(bank->LeftArrange() > 0);
+
+        if (stop.load())
+        {
+            break;
+        }
+
+        if (paper.Count() > 0)
+        {
+            result.append(paper);
+        }
+        else
+        {
+            return LayoutErrors::EmptyPaperError;
+        }
+    }
+
+    return LayoutErrors::NoError;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief GenerateMultiStart runs several independent layout passes at once and keeps the best one.
+ *
+ * The first attempt uses the settings as is, the others cycle through the grouping cases, shift lengths and piece
+ * orders. When the time budget is over, attempts that are still running get cancelled as soon as at least one
+ * attempt has finished.
+ */
+LayoutErrors VLayoutGenerator::GenerateMultiStart(int height, int width)
+{
+    const int casesCount = static_cast<int>(Cases::UnknownCase);
+
+    std::vector<std::unique_ptr<VLayoutAttempt>> runs;
+    runs.reserve(static_cast<size_t>(attempts));
+    for (int i = 0; i < attempts; ++i)
+    {
+        const Cases attemptCase = static_cast<Cases>((static_cast<int>(caseType) + i) % casesCount);
 
-            if (paper.Count() > 0)
+        quint32 attemptShift = shift;
+        switch ((i / casesCount) % 3)
+        {
+            case 1:
+                attemptShift = shift / 2;
+                break;
+            case 2:
+                attemptShift = 0; // Whole edges
+                break;
+            default:
+                break;
+        }
+
+        runs.emplace_back(new VLayoutAttempt(attemptCase, attemptShift, static_cast<quint32>(i)));
+    }
+
+    // Attempts get their own pool. The edge-to-edge search inside each attempt uses the global one.
+    QThreadPool pool;
+    pool.setMaxThreadCount(qMin(attempts, qMax(1, QThread::idealThreadCount())));
+
+    const qreal layoutWidth = bank->GetLayoutWidth();
+    for (auto &run : runs)
+    {
+        VLayoutAttempt *attempt = run.get();
+        pool.start(new VFunctionTask([this, attempt, layoutWidth, height, width]()
+        {
+            if (attempt->stop.load())
+            {
+                return;
+            }
+
+            QVector<VLayoutPiece> attemptPieces = pieces;
+            if (attempt->seed > 0)
+            {
+                std::mt19937 generator(attempt->seed);
+                std::shuffle(attemptPieces.begin(), attemptPieces.end(), generator);
+            }
+
+            VBank attemptBank;
+            attemptBank.setPieces(attemptPieces);
+            attemptBank.SetLayoutWidth(layoutWidth);
+            attemptBank.SetCaseType(attempt->caseType);
+
+            if (not attemptBank.Prepare())
             {
-                papers.append(paper);
+                attempt->state = LayoutErrors::PrepareLayoutError;
             }
             else
             {
-                state = LayoutErrors::EmptyPaperError;
-                emit Error(state);
-                return;
+                attempt->state = ArrangePapers(&attemptBank, attempt->shift, height, width, attempt->stop,
+                                               &attempt->arranged, attempt->papers);
+            }
+
+            // A cancelled attempt leaves pieces in its bank, its sheets are not a complete layout
+            if (attempt->state != LayoutErrors::NoError || attemptBank.allPieceCount() == 0)
+            {
+                attempt->finished.store(true);
+            }
+        }));
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const QCoreApplication *instance = QCoreApplication::instance();
+    const bool isGuiThread = instance && (QThread::currentThread() == instance->thread());
+
+    int reported = 0;
+    while (not pool.waitForDone(attemptsEventsInterval))
+    {
+        if (isGuiThread)
+        {
+            QCoreApplication::processEvents();
+        }
+
+        bool anyFinished = false;
+        int arranged = 0;
+        for (auto &run : runs)
+        {
+            anyFinished = anyFinished || run->finished.load();
+            arranged = qMax(arranged, run->arranged.load());
+        }
+
+        if (stopGeneration.load() || (timeBudget > 0 && timer.elapsed() >= timeBudget && anyFinished))
+        {
+            pool.clear();
+            for (auto &run : runs)
+            {
+                run->stop.store(true);
             }
         }
+
+        if (arranged > reported)
+        {
+            reported = arranged;
+            emit Arranged(reported);
+        }
     }
-    else
+
+    if (stopGeneration.load())
     {
-        state = LayoutErrors::PrepareLayoutError;
-        emit Error(state);
-        return;
+        return LayoutErrors::NoError;
     }
 
-    if (stripOptimizationEnabled)
+    const VLayoutAttempt *best = nullptr;
+    LayoutErrors error = LayoutErrors::NoError;
+    for (auto &run : runs)
     {
-        GatherPages();
+        if (not run->finished.load())
+        {
+            continue;
+        }
+
+        if (run->state != LayoutErrors::NoError)
+        {
+            if (error == LayoutErrors::NoError)
+            {
+                error = run->state;
+            }
+            continue;
+        }
+
+        if (best == nullptr || isBetterLayout(run->papers, best->papers))
+        {
+            best = run.get();
+        }
     }
 
-    if (IsUnitePages())
+    if (best == nullptr)
     {
-        UnitePages();
+        return error != LayoutErrors::NoError ? error : LayoutErrors::EmptyPaperError;
     }
 
-    emit Finished();
+    papers = best->papers;
+    emit Arranged(pieces.size());
+    return LayoutErrors::NoError;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -292,6 +565,48 @@ void VLayoutGenerator::SetTestAsPaths(bool value)
     textAsPaths = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+LayoutEngine VLayoutGenerator::GetEngine() const
+{
+    return engine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutGenerator::SetEngine(LayoutEngine value)
+{
+    engine = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutGenerator::GetAttempts() const
+{
+    return attempts;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetAttempts sets how many independent layout attempts Generate() runs. 1 means a single greedy pass.
+ */
+void VLayoutGenerator::SetAttempts(int value)
+{
+    attempts = qMax(1, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutGenerator::GetTimeBudget() const
+{
+    return timeBudget;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetTimeBudget sets time limit in milliseconds for multi-start generation. 0 means no limit.
+ */
+void VLayoutGenerator::SetTimeBudget(int value)
+{
+    timeBudget = qMax(0, value);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 quint8 VLayoutGenerator::GetMultiplier() const
 {
@@ -129,6 +129,15 @@ class VLayoutGenerator :public QObject
     bool         IsTestAsPaths() const;
     void         SetTestAsPaths(bool value);
 
+    LayoutEngine GetEngine() const;
+    void         SetEngine(LayoutEngine value);
+
+    int          GetAttempts() const;
+    void         SetAttempts(int value);
+
+    int          GetTimeBudget() const;
+    void         SetTimeBudget(int value);
+
 signals:
     void         Start();
     void         Arranged(int count);
@@ -141,7 +150,9 @@ public slots:
 private:
     Q_DISABLE_COPY(VLayoutGenerator)
     QVector<VLayoutPaper> papers;
+    QVector<VLayoutPiece> pieces;
     VBank           *bank;
+    Cases            caseType;
     qreal            paperHeight;
     qreal            paperWidth;
     QMarginsF        margins;
@@ -158,10 +169,17 @@ public slots:
     quint8           multiplier;
     bool             stripOptimization;
     bool             textAsPaths;
+    LayoutEngine     engine;
+    int              attempts;
+    int              timeBudget;
 
     int                 PageHeight() const;
     int                 PageWidth() const;
 
+    LayoutErrors        ArrangePapers(VBank *bank, quint32 shift, int height, int width, std::atomic_bool &stop,
+                                      std::atomic_int *arranged, QVector<VLayoutPaper> &result);
+    LayoutErrors        GenerateMultiStart(int height, int width);
+
     void                GatherPages();
     void                UnitePages();
     void                unitePieces(int j, QList<QList<VLayoutPiece> > &pieces, qreal length, int i);
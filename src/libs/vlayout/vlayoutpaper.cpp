@@ -53,7 +53,6 @@
 #include "vlayoutpaper.h"
 
 #include <QBrush>
-#include <QCoreApplication>
 #include <QGraphicsRectItem>
 #include <QGraphicsScene>
 #include <QList>
@@ -61,8 +60,6 @@
 #include <QPointF>
 #include <QRect>
 #include <QRectF>
-#include <QThread>
-#include <QThreadPool>
 #include <QVector>
 #include <Qt>
 #include <QtAlgorithms>
@@ -71,6 +68,8 @@
 #include "vcontour.h"
 #include "vlayoutpiece.h"
 #include "vlayoutpaper_p.h"
+#include "vlayoutscheduler.h"
+#include "vnfpposition.h"
 #include "vposition.h"
 
 #ifdef Q_COMPILER_RVALUE_REFS
@@ -207,6 +206,18 @@ void VLayoutPaper::SetSaveLength(bool value)
     d->saveLength = value;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+LayoutEngine VLayoutPaper::GetEngine() const
+{
+    return d->engine;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutPaper::SetEngine(LayoutEngine engine)
+{
+    d->engine = engine;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPaper::SetPaperIndex(quint32 index)
 {
@@ -252,68 +263,41 @@ int VLayoutPaper::Count() const
 //---------------------------------------------------------------------------------------------------------------------
 bool VLayoutPaper::AddToSheet(const VLayoutPiece &piece, std::atomic_bool &stop)
 {
-    VBestSquare bestResult(d->globalContour.GetSize(), d->saveLength);
-    QThreadPool *thread_pool = QThreadPool::globalInstance();
-    thread_pool->setExpiryTimeout(1000);
-    QVector<VPosition *> threads;
-
-    int pieceEdgesCount = 0;
+    // Positions read the piece from several threads
+    piece.CacheMappedPoints();
 
-    if (d->globalContour.GetContour().isEmpty())
+    if (d->engine == LayoutEngine::NoFitPolygon)
     {
-        pieceEdgesCount = piece.pieceEdgesCount();
-    }
-    else
-    {
-        pieceEdgesCount = piece.LayoutEdgesCount();
-    }
+        VNfpPosition position(d->globalContour, d->arrangedHulls, d->arrangedRect, piece, &stop, d->localRotate,
+                              d->localRotationIncrease, d->saveLength);
+        position.run();
 
-    for (int j=1; j <= d->globalContour.GlobalEdgesCount(); ++j)
-    {
-        for (int i=1; i<= pieceEdgesCount; ++i)
+        if (stop.load())
         {
-            VPosition *thread = new VPosition(d->globalContour, j, piece, i, &stop, d->localRotate,
-                                              d->localRotationIncrease,
-                                              d->saveLength);
-            //Info for debug
-            #ifdef LAYOUT_DEBUG
-                thread->setPaperIndex(d->paperIndex);
-                thread->setFrame(d->frame);
-                thread->setPieceCount(d->pieces.count());
-                thread->setPieces(d->pieces);
-            #endif
-
-            thread->setAutoDelete(false);
-            threads.append(thread);
-            thread_pool->start(thread);
-
-            d->frame = d->frame + 3 + static_cast<quint32>(360/d->localRotationIncrease*2);
+            return false;
         }
-    }
 
-    // Wait for done
-    do
-    {
-        QCoreApplication::processEvents();
-        QThread::msleep(250);
+        return SaveResult(position.getBestResult(), piece);
     }
-    while(thread_pool->activeThreadCount() > 0 && not stop.load());
+
+    VLayoutScheduler scheduler(d->globalContour, piece, &stop, d->localRotate, d->localRotationIncrease,
+                               d->saveLength);
+
+    //Info for debug
+    #ifdef LAYOUT_DEBUG
+        scheduler.SetDebugInfo(d->paperIndex, d->frame, d->pieces);
+    #endif
+
+    const VBestSquare bestResult = scheduler.Run();
+
+    d->frame = d->frame + static_cast<quint32>(scheduler.WorkItemsCount())
+            * (3 + static_cast<quint32>(360/d->localRotationIncrease*2));
 
     if (stop.load())
     {
-        qDeleteAll(threads.begin(), threads.end());
-        threads.clear();
         return false;
     }
 
-    for (int i=0; i < threads.size(); ++i)
-    {
-        bestResult.NewResult(threads.at(i)->getBestResult());
-    }
-
-    qDeleteAll(threads.begin(), threads.end());
-    threads.clear();
-
     return SaveResult(bestResult, piece);
 }
 
@@ -325,6 +309,15 @@ bool VLayoutPaper::SaveResult(const VBestSquare &bestResult, const VLayoutPiece
         VLayoutPiece workDetail = piece;
         workDetail.setTransform(bestResult.Transform());// Don't forget set transform
         workDetail.SetMirror(bestResult.isMirror());
+
+        if (d->engine == LayoutEngine::NoFitPolygon)
+        { // NFP engine doesn't use global contour
+            d->pieces.append(workDetail);
+            d->arrangedHulls.append(VNfpPosition::ConvexHull(workDetail.getLayoutAllowancePoints()));
+            d->arrangedRect = d->arrangedRect.united(workDetail.LayoutBoundingRect());
+            return true;
+        }
+
         const QVector<QPointF> newGContour = d->globalContour.UniteWithContour(workDetail, bestResult.GContourEdge(),
                                                                                bestResult.pieceEdge(),
                                                                                bestResult.Type());
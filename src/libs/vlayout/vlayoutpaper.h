@@ -107,6 +107,9 @@ class VLayoutPaper
     bool    IsSaveLength() const;
     void    SetSaveLength(bool value);
 
+    LayoutEngine GetEngine() const;
+    void         SetEngine(LayoutEngine engine);
+
     void    SetPaperIndex(quint32 index);
 
     bool    arrangePiece(const VLayoutPiece &piece, std::atomic_bool &stop);
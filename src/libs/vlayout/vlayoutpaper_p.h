@@ -56,6 +56,7 @@
 #include <QSharedData>
 #include <QVector>
 #include <QPointF>
+#include <QRectF>
 
 #include "vlayoutpiece.h"
 #include "vcontour.h"
@@ -77,7 +78,10 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          engine(LayoutEngine::EdgeToEdge),
+          arrangedHulls(),
+          arrangedRect()
     {}
 
     VLayoutPaperData(int height, int width)
@@ -90,7 +94,10 @@ class VLayoutPaperData : public QSharedData
           localRotate(true),
           globalRotationIncrease(180),
           localRotationIncrease(180),
-          saveLength(false)
+          saveLength(false),
+          engine(LayoutEngine::EdgeToEdge),
+          arrangedHulls(),
+          arrangedRect()
     {}
 
     VLayoutPaperData(const VLayoutPaperData &paper)
@@ -104,7 +111,10 @@ class VLayoutPaperData : public QSharedData
           localRotate(paper.localRotate),
           globalRotationIncrease(paper.globalRotationIncrease),
           localRotationIncrease(paper.localRotationIncrease),
-          saveLength(paper.saveLength)
+          saveLength(paper.saveLength),
+          engine(paper.engine),
+          arrangedHulls(paper.arrangedHulls),
+          arrangedRect(paper.arrangedRect)
     {}
 
     ~VLayoutPaperData() {}
@@ -124,6 +134,14 @@ class VLayoutPaperData : public QSharedData
     int      localRotationIncrease;
     bool     saveLength;
 
+    LayoutEngine engine;
+
+    /** @brief arrangedHulls convex hulls of arranged pieces layout allowance. Used by NFP engine. */
+    QVector<QVector<QPointF>> arrangedHulls;
+
+    /** @brief arrangedRect bounding rect of arranged pieces layout allowance. Used by NFP engine. */
+    QRectF arrangedRect;
+
 private:
     VLayoutPaperData& operator=(const VLayoutPaperData&) Q_DECL_EQ_DELETE;
 };
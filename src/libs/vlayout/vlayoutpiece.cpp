@@ -52,6 +52,7 @@
 
 #include "vlayoutpiece.h"
 
+#include <algorithm>
 #include <QBrush>
 #include <QFlags>
 #include <QFont>
@@ -463,23 +464,24 @@ VLayoutPiece VLayoutPiece::Create(const VPiece &piece, const VContainer *pattern
 
 //---------------------------------------------------------------------------------------------------------------------
 // cppcheck-suppress unusedFunction
-QVector<QPointF> VLayoutPiece::getContourPoints() const
+const QVector<QPointF> &VLayoutPiece::getContourPoints() const
 {
-    return Map(d->contour);
+    return CachedPoints(d->contour, d->contourCache);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VLayoutPiece::SetCountourPoints(const QVector<QPointF> &points, bool hideMainPath)
 {
     d->contour = RemoveDublicates(points, false);
+    d->contourCache.Clear();
     setHideSeamLine(hideMainPath);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 // cppcheck-suppress unusedFunction
-QVector<QPointF> VLayoutPiece::GetSeamAllowancePoints() const
+const QVector<QPointF> &VLayoutPiece::GetSeamAllowancePoints() const
 {
-    return Map(d->seamAllowance);
+    return CachedPoints(d->seamAllowance, d->seamAllowanceCache);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -490,6 +492,7 @@ void VLayoutPiece::setSeamAllowancePoints(const QVector<QPointF> &points, bool s
         SetSeamAllowance(seamAllowance);
         SetSeamAllowanceBuiltIn(seamAllowanceBuiltIn);
         d->seamAllowance = points;
+        d->seamAllowanceCache.Clear();
         if (not d->seamAllowance.isEmpty())
         {
             d->seamAllowance = RemoveDublicates(d->seamAllowance, false);
@@ -503,9 +506,9 @@ void VLayoutPiece::setSeamAllowancePoints(const QVector<QPointF> &points, bool s
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-QVector<QPointF> VLayoutPiece::getLayoutAllowancePoints() const
+const QVector<QPointF> &VLayoutPiece::getLayoutAllowancePoints() const
 {
-    return Map(d->layoutAllowance);
+    return CachedPoints(d->layoutAllowance, d->layoutAllowanceCache);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -697,6 +700,7 @@ QTransform VLayoutPiece::getTransform() const
 void VLayoutPiece::setTransform(const QTransform &transform)
 {
     d->transform = transform;
+    d->ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -717,6 +721,7 @@ void VLayoutPiece::Translate(qreal dx, qreal dy)
     QTransform m;
     m.translate(dx, dy);
     d->transform *= m;
+    d->ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -727,6 +732,7 @@ void VLayoutPiece::Rotate(const QPointF &originPoint, qreal degrees)
     m.rotate(-degrees);
     m.translate(-originPoint.x(), -originPoint.y());
     d->transform *= m;
+    d->ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -760,6 +766,7 @@ void VLayoutPiece::Mirror(const QLineF &edge)
     d->transform *= m;
 
     d->mirror = !d->mirror;
+    d->ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -777,50 +784,58 @@ int VLayoutPiece::LayoutEdgesCount() const
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::pieceEdge(int i) const
 {
-    return Edge(piecePath(), i);
+    return Edge(MappedPiecePath(), i);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QLineF VLayoutPiece::LayoutEdge(int i) const
 {
-    return Edge(d->layoutAllowance, i);
+    return Edge(CachedPoints(d->layoutAllowance, d->layoutAllowanceCache), i);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::pieceEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(piecePath(), p1);
+    return EdgeByPoint(MappedPiecePath(), p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VLayoutPiece::LayoutEdgeByPoint(const QPointF &p1) const
 {
-    return EdgeByPoint(d->layoutAllowance, p1);
+    return EdgeByPoint(CachedPoints(d->layoutAllowance, d->layoutAllowanceCache), p1);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::pieceBoundingRect() const
 {
-    QVector<QPointF> points;
     if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
     {
-        points = GetSeamAllowancePoints();
+        return CachedBoundingRect(d->seamAllowance, d->seamAllowanceCache);
     }
     else
     {
-        points = getContourPoints();
+        return CachedBoundingRect(d->contour, d->contourCache);
     }
-
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QRectF VLayoutPiece::LayoutBoundingRect() const
 {
-    QVector<QPointF> points = getLayoutAllowancePoints();
-    points.append(points.first());
-    return QPolygonF(points).boundingRect();
+    return CachedBoundingRect(d->layoutAllowance, d->layoutAllowanceCache);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CacheMappedPoints fills the cache of mapped points and bounding rects.
+ *
+ * Const getters fill the cache on first request without locking. Call this method before a piece is shared between
+ * threads, so they only read the cache. A copy that gets moved detaches and fills own cache.
+ */
+void VLayoutPiece::CacheMappedPoints() const
+{
+    CachedBoundingRect(d->contour, d->contourCache);
+    CachedBoundingRect(d->seamAllowance, d->seamAllowanceCache);
+    CachedBoundingRect(d->layoutAllowance, d->layoutAllowanceCache);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -890,6 +905,7 @@ void VLayoutPiece::SetLayoutAllowancePoints()
     {
         d->layoutAllowance.clear();
     }
+    d->layoutAllowanceCache.Clear();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -952,6 +968,7 @@ template <class T>
 QVector<T> VLayoutPiece::Map(const QVector<T> &points) const
 {
     QVector<T> p;
+    p.reserve(points.size());
     for (int i = 0; i < points.size(); ++i)
     {
         p.append(d->transform.map(points.at(i)));
@@ -959,16 +976,55 @@ QVector<T> VLayoutPiece::Map(const QVector<T> &points) const
 
     if (d->mirror)
     {
-        QList<T> list = p.toList();
-        for (int k=0, s=list.size(), max=(s/2); k<max; k++)
-        {
-			list.swapItemsAt(k, s-(1+k));
-        }
-        p = list.toVector();
+        std::reverse(p.begin(), p.end());
     }
     return p;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedPoints return mapped points from the cache. Map points if cache is not valid.
+ */
+const QVector<QPointF> &VLayoutPiece::CachedPoints(const QVector<QPointF> &points, VCachedPoints &cache) const
+{
+    if (not cache.valid)
+    {
+        cache.points = Map(points);
+        cache.valid = true;
+    }
+    return cache.points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CachedBoundingRect return bounding rect of mapped points from the cache.
+ */
+QRectF VLayoutPiece::CachedBoundingRect(const QVector<QPointF> &points, VCachedPoints &cache) const
+{
+    if (not cache.rectValid)
+    {
+        cache.boundingRect = QPolygonF(CachedPoints(points, cache)).boundingRect();
+        cache.rectValid = true;
+    }
+    return cache.boundingRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MappedPiecePath mapped version of piecePath().
+ */
+const QVector<QPointF> &VLayoutPiece::MappedPiecePath() const
+{
+    if (IsSeamAllowance() && not IsSeamAllowanceBuiltIn())
+    {
+        return CachedPoints(d->seamAllowance, d->seamAllowanceCache);
+    }
+    else
+    {
+        return CachedPoints(d->contour, d->contourCache);
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 QPainterPath VLayoutPiece::createMainPath() const
 {
@@ -1319,9 +1375,14 @@ bool VLayoutPiece::isMirror() const
 void VLayoutPiece::SetMirror(bool value)
 {
     d->mirror = value;
+    d->ClearCache();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Edge return edge of mapped path. Mapped path of mirrored piece is already reversed, so edges follow the same
+ * direction as for not mirrored piece.
+ */
 QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
 {
     if (i < 1 || i > path.count())
@@ -1329,29 +1390,13 @@ QLineF VLayoutPiece::Edge(const QVector<QPointF> &path, int i) const
         return QLineF();
     }
 
-    int i1, i2;
     if (i < path.count())
     {
-        i1 = i-1;
-        i2 = i;
-    }
-    else
-    {
-        i1 = path.count()-1;
-        i2 = 0;
-    }
-
-    if (d->mirror)
-    {
-        const int oldI1 = i1;
-        const int size = path.size()-1; //-V807
-        i1 = size - i2;
-        i2 = size - oldI1;
-        return QLineF(d->transform.map(path.at(i2)), d->transform.map(path.at(i1)));
+        return QLineF(path.at(i-1), path.at(i));
     }
     else
     {
-        return QLineF(d->transform.map(path.at(i1)), d->transform.map(path.at(i2)));
+        return QLineF(path.at(path.count()-1), path.at(0));
     }
 }
 
@@ -1368,10 +1413,9 @@ int VLayoutPiece::EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) c
         return 0;
     }
 
-    const QVector<QPointF> points = Map(path);
-    for (int i=0; i < points.size(); i++)
+    for (int i=0; i < path.size(); i++)
     {
-        if (points.at(i) == p1)
+        if (path.at(i) == p1)
         {
             return i+1;
         }
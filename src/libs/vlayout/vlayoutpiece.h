@@ -71,6 +71,7 @@
 #include "vabstractpiece.h"
 
 class VLayoutPieceData;
+class VCachedPoints;
 class VLayoutPiecePath;
 class QGraphicsItem;
 class QGraphicsPathItem;
@@ -95,14 +96,14 @@ class VLayoutPiece :public VAbstractPiece
 
     static VLayoutPiece       Create(const VPiece &piece, const VContainer *pattern);
 
-    QVector<QPointF>          getContourPoints() const;
+    const QVector<QPointF>   &getContourPoints() const;
     void                      SetCountourPoints(const QVector<QPointF> &points, bool hideMainPath = false);
 
-    QVector<QPointF>          GetSeamAllowancePoints() const;
+    const QVector<QPointF>   &GetSeamAllowancePoints() const;
     void                      setSeamAllowancePoints(const QVector<QPointF> &points, bool seamAllowance = true,
                                                      bool seamAllowanceBuiltIn = false);
 
-    QVector<QPointF>          getLayoutAllowancePoints() const;
+    const QVector<QPointF>   &getLayoutAllowancePoints() const;
     void                      SetLayoutAllowancePoints();
 
     QVector<QLineF>           getNotches() const;
@@ -152,6 +153,7 @@ class VLayoutPiece :public VAbstractPiece
 
     QRectF                    pieceBoundingRect() const;
     QRectF                    LayoutBoundingRect() const;
+    void                      CacheMappedPoints() const;
     qreal                     Diagonal() const;
 
     bool                      isNull() const;
@@ -184,6 +186,11 @@ class VLayoutPiece :public VAbstractPiece
     template <class T>
     QVector<T>                           Map(const QVector<T> &points) const;
 
+    const QVector<QPointF>              &CachedPoints(const QVector<QPointF> &points, VCachedPoints &cache) const;
+    QRectF                               CachedBoundingRect(const QVector<QPointF> &points,
+                                                            VCachedPoints &cache) const;
+    const QVector<QPointF>              &MappedPiecePath() const;
+
     QLineF                               Edge(const QVector<QPointF> &path, int i) const;
     int                                  EdgeByPoint(const QVector<QPointF> &path, const QPointF &p1) const;
 };
@@ -55,6 +55,7 @@
 
 #include <QSharedData>
 #include <QPointF>
+#include <QRectF>
 #include <QVector>
 #include <QTransform>
 
@@ -70,6 +71,39 @@ QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Weffc++")
 QT_WARNING_DISABLE_GCC("-Wnon-virtual-dtor")
 
+/**
+ * @brief The VCachedPoints class keeps points mapped with piece transform and their bounding rect.
+ *
+ * Nesting asks the same piece for its points many times between two transformations. Values are calculated on first
+ * request and stay valid until the piece is moved, rotated or mirrored. The cache is not locked, a piece shared between
+ * threads must have it filled first (see VLayoutPiece::CacheMappedPoints()).
+ */
+class VCachedPoints
+{
+public:
+    VCachedPoints()
+        : points(),
+          boundingRect(),
+          valid(false),
+          rectValid(false)
+    {}
+
+    void Clear()
+    {
+        points.clear();
+        boundingRect = QRectF();
+        valid = false;
+        rectValid = false;
+    }
+
+    QVector<QPointF> points;
+    QRectF           boundingRect;
+    bool             valid;
+    bool             rectValid;
+};
+
+Q_DECLARE_TYPEINFO(VCachedPoints, Q_MOVABLE_TYPE);
+
 class VLayoutPieceData : public QSharedData
 {
 public:
@@ -87,7 +121,10 @@ class VLayoutPieceData : public QSharedData
           patternInfo(),
           grainlinePoints(),
           m_tmPiece(),
-          m_tmPattern()
+          m_tmPattern(),
+          contourCache(),
+          seamAllowanceCache(),
+          layoutAllowanceCache()
     {}
 
     VLayoutPieceData(const VLayoutPieceData &piece)
@@ -105,9 +142,19 @@ class VLayoutPieceData : public QSharedData
           patternInfo(piece.patternInfo),
           grainlinePoints(piece.grainlinePoints),
           m_tmPiece(piece.m_tmPiece),
-          m_tmPattern(piece.m_tmPattern)
+          m_tmPattern(piece.m_tmPattern),
+          contourCache(piece.contourCache),
+          seamAllowanceCache(piece.seamAllowanceCache),
+          layoutAllowanceCache(piece.layoutAllowanceCache)
     {}
 
+    void ClearCache()
+    {
+        contourCache.Clear();
+        seamAllowanceCache.Clear();
+        layoutAllowanceCache.Clear();
+    }
+
     ~VLayoutPieceData() {}
 
     QVector<QPointF>           contour;            //! @brief contour list of contour points.
@@ -125,6 +172,10 @@ class VLayoutPieceData : public QSharedData
     VTextManager               m_tmPiece;          //! @brief m_tmPiece text manager for laying out piece info
     VTextManager               m_tmPattern;        //! @brief m_tmPattern text manager for laying out pattern info */
 
+    mutable VCachedPoints      contourCache;       //! @brief contourCache mapped contour points
+    mutable VCachedPoints      seamAllowanceCache; //! @brief seamAllowanceCache mapped seam allowance points
+    mutable VCachedPoints      layoutAllowanceCache; //! @brief layoutAllowanceCache mapped layout allowance points
+
 private:
     VLayoutPieceData &operator=(const VLayoutPieceData &) Q_DECL_EQ_DELETE;
 };
@@ -0,0 +1,253 @@
+/***************************************************************************
+ **  @file   vlayoutscheduler.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vlayoutscheduler.h"
+
+#include <QCoreApplication>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+#include "vcontour.h"
+#include "vlayoutdef.h"
+#include "vlayoutpiece.h"
+#include "vposition.h"
+
+namespace
+{
+// How often the waiting thread wakes up to process events. Completion of work doesn't depend on this value.
+const unsigned long eventsInterval = 50; // ms
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VLayoutSchedulerWorker class takes batches of work items from the scheduler until no one left.
+ *
+ * Worker reports to the scheduler in the destructor. This way the scheduler will be notified even if the thread pool
+ * was cleared (see VLayoutGenerator::Abort()) and the worker was deleted without running.
+ */
+class VLayoutSchedulerWorker : public QRunnable
+{
+public:
+    explicit VLayoutSchedulerWorker(VLayoutScheduler *scheduler)
+        : QRunnable(),
+          scheduler(scheduler)
+    {
+        setAutoDelete(true);
+    }
+
+    virtual ~VLayoutSchedulerWorker() Q_DECL_OVERRIDE
+    {
+        scheduler->WorkerDone();
+    }
+
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        while (scheduler->RunBatch())
+        {}
+    }
+
+private:
+    Q_DISABLE_COPY(VLayoutSchedulerWorker)
+    VLayoutScheduler *scheduler;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutScheduler::VLayoutScheduler(const VContour &gContour, const VLayoutPiece &piece, std::atomic_bool *stop,
+                                   bool rotate, int rotationIncrease, bool saveLength)
+    : gContour(gContour),
+      piece(piece),
+      stop(stop),
+      rotate(rotate),
+      rotationIncrease(rotationIncrease),
+      saveLength(saveLength),
+      pieceEdgesCount(0),
+      itemsCount(0),
+      batchSize(1),
+      paperIndex(0),
+      frame(0),
+      pieces(),
+      results(),
+      resultsData(nullptr),
+      nextItem(0),
+      bestSquare(VBestSquare(gContour.GetSize(), saveLength).BestSquare()),
+      mutex(),
+      finished(),
+      activeWorkers(0)
+{
+    if (gContour.GetContour().isEmpty())
+    {
+        pieceEdgesCount = piece.pieceEdgesCount();
+    }
+    else
+    {
+        pieceEdgesCount = piece.LayoutEdgesCount();
+    }
+
+    itemsCount = gContour.GlobalEdgesCount() * pieceEdgesCount;
+
+    const VBestSquare emptyResult(gContour.GetSize(), saveLength);
+    results.reserve(itemsCount);
+    for (int i = 0; i < itemsCount; ++i)
+    {
+        results.append(emptyResult);
+    }
+    resultsData = results.data(); // Detach once here, workers write only to own items
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutScheduler::~VLayoutScheduler()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutScheduler::SetDebugInfo(quint32 paperIndex, quint32 frame, const QVector<VLayoutPiece> &pieces)
+{
+    this->paperIndex = paperIndex;
+    this->frame = frame;
+    this->pieces = pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutScheduler::WorkItemsCount() const
+{
+    return itemsCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VBestSquare VLayoutScheduler::Run()
+{
+    VBestSquare bestResult(gContour.GetSize(), saveLength);
+
+    if (itemsCount <= 0)
+    {
+        return bestResult;
+    }
+
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    threadPool->setExpiryTimeout(1000);
+
+    const int threads = qMax(1, threadPool->maxThreadCount());
+    // Several batches per thread give good balance between load distribution and contention on the queue.
+    batchSize = qMax(1, itemsCount / (threads * 4));
+    const int workers = qMin(threads, (itemsCount + batchSize - 1) / batchSize);
+
+    {
+        QMutexLocker locker(&mutex);
+        activeWorkers = workers;
+    }
+
+    for (int i = 0; i < workers; ++i)
+    {
+        threadPool->start(new VLayoutSchedulerWorker(this));
+    }
+
+    // Only the GUI thread pumps events. Multi-start attempts run the scheduler from pool threads.
+    const QCoreApplication *instance = QCoreApplication::instance();
+    const bool isGuiThread = instance && (QThread::currentThread() == instance->thread());
+
+    // Wait for done. The last worker wakes us up.
+    {
+        QMutexLocker locker(&mutex);
+        while (activeWorkers > 0)
+        {
+            finished.wait(&mutex, eventsInterval);
+            if (activeWorkers > 0 && isGuiThread)
+            {
+                locker.unlock();
+                QCoreApplication::processEvents();
+                locker.relock();
+            }
+        }
+    }
+
+    if (stop->load())
+    {
+        return bestResult;
+    }
+
+    for (int i = 0; i < itemsCount; ++i)
+    {
+        bestResult.NewResult(results.at(i));
+    }
+
+    return bestResult;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VLayoutScheduler::RunBatch()
+{
+    if (stop->load())
+    {
+        return false;
+    }
+
+    const int begin = nextItem.fetch_add(batchSize);
+    if (begin >= itemsCount)
+    {
+        return false;
+    }
+
+    const int end = qMin(begin + batchSize, itemsCount);
+    for (int item = begin; item < end; ++item)
+    {
+        if (stop->load())
+        {
+            return false;
+        }
+        RunItem(item);
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutScheduler::RunItem(int item)
+{
+    // Items go in the same order as the old loop over global edges (j) and piece edges (i).
+    const int j = item / pieceEdgesCount + 1;
+    const int i = item % pieceEdgesCount + 1;
+
+    VPosition position(gContour, j, piece, i, stop, rotate, rotationIncrease, saveLength, &bestSquare);
+
+    //Info for debug
+#ifdef LAYOUT_DEBUG
+    position.setPaperIndex(paperIndex);
+    position.setFrame(frame + static_cast<quint32>(item) * (3 + static_cast<quint32>(360/rotationIncrease*2)));
+    position.setPieceCount(static_cast<quint32>(pieces.count()));
+    position.setPieces(pieces);
+#endif
+
+    position.run();
+    resultsData[item] = position.getBestResult();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VLayoutScheduler::WorkerDone()
+{
+    QMutexLocker locker(&mutex);
+    --activeWorkers;
+    if (activeWorkers <= 0)
+    {
+        finished.wakeAll();
+    }
+}
@@ -0,0 +1,94 @@
+/***************************************************************************
+ **  @file   vlayoutscheduler.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VLAYOUTSCHEDULER_H
+#define VLAYOUTSCHEDULER_H
+
+#include <QMutex>
+#include <QVector>
+#include <QWaitCondition>
+#include <QtGlobal>
+#include <atomic>
+
+#include "vbestsquare.h"
+#include "vposition.h"
+
+class VContour;
+class VLayoutPiece;
+class VLayoutSchedulerWorker;
+
+/**
+ * @brief The VLayoutScheduler class runs search of the best position for one piece on a sheet.
+ *
+ * Each pair (global contour edge, piece edge) is a work item. Work items are split in batches which workers take from
+ * a shared queue until it is empty. All workers share the same read-only contour and piece, the best square found so
+ * far is shared too, so a worker can skip positions that have no chance to become the best result. The calling thread
+ * sleeps until the last worker signals completion.
+ */
+class VLayoutScheduler
+{
+public:
+    VLayoutScheduler(const VContour &gContour, const VLayoutPiece &piece, std::atomic_bool *stop, bool rotate,
+                     int rotationIncrease, bool saveLength);
+    ~VLayoutScheduler();
+
+    void SetDebugInfo(quint32 paperIndex, quint32 frame, const QVector<VLayoutPiece> &pieces);
+
+    int         WorkItemsCount() const;
+    VBestSquare Run();
+
+private:
+    Q_DISABLE_COPY(VLayoutScheduler)
+    friend class VLayoutSchedulerWorker;
+
+    const VContour     &gContour;
+    const VLayoutPiece &piece;
+    std::atomic_bool   *stop;
+    bool                rotate;
+    int                 rotationIncrease;
+    bool                saveLength;
+    int                 pieceEdgesCount;
+    int                 itemsCount;
+    int                 batchSize;
+
+    quint32               paperIndex;
+    quint32               frame;
+    QVector<VLayoutPiece> pieces;
+
+    /** @brief results the best result for each work item. Merged in order of work items to get stable result. */
+    QVector<VBestSquare> results;
+    VBestSquare         *resultsData;
+
+    std::atomic<int>    nextItem;
+    VSharedBestSquare   bestSquare;
+
+    QMutex         mutex;
+    QWaitCondition finished;
+    int            activeWorkers;
+
+    bool RunBatch();
+    void RunItem(int item);
+    void WorkerDone();
+};
+
+#endif // VLAYOUTSCHEDULER_H
@@ -0,0 +1,149 @@
+/***************************************************************************
+ **  @file   vlayoutsheet.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vlayoutsheet.h"
+
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+#include <QTransform>
+#include <algorithm>
+
+#include "../vmisc/def.h"
+#include "vlayoutpiece.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+bool StacksBefore(const QGraphicsItem *item1, const QGraphicsItem *item2)
+{
+    return item1->zValue() < item2->zValue();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PaintItem paints an item and its children in the order QGraphicsScene would.
+ */
+void PaintItem(QPainter *painter, QGraphicsItem *item, const QTransform &sheetTransform)
+{
+    if (not item->isVisible())
+    {
+        return;
+    }
+
+    QList<QGraphicsItem *> children = item->childItems();
+    std::stable_sort(children.begin(), children.end(), StacksBefore);
+
+    int i = 0;
+    for (; i < children.size(); ++i)
+    {
+        QGraphicsItem *child = children.at(i);
+        if (child->zValue() >= 0 && not (child->flags() & QGraphicsItem::ItemStacksBehindParent))
+        {
+            break;
+        }
+        PaintItem(painter, child, sheetTransform);
+    }
+
+    if (not (item->flags() & QGraphicsItem::ItemHasNoContents))
+    {
+        QStyleOptionGraphicsItem option;
+        option.exposedRect = item->boundingRect();
+        option.rect = option.exposedRect.toAlignedRect();
+
+        painter->save();
+        painter->setWorldTransform(item->sceneTransform() * sheetTransform);
+        painter->setOpacity(item->effectiveOpacity());
+        item->paint(painter, &option, nullptr);
+        painter->restore();
+    }
+
+    for (; i < children.size(); ++i)
+    {
+        PaintItem(painter, children.at(i), sheetTransform);
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutSheet::VLayoutSheet(const QRectF &paperRect, const QVector<VLayoutPiece> &pieces, bool textAsPaths)
+    : m_paperRect(paperRect),
+      m_items()
+{
+    for (int i = 0; i < pieces.size(); ++i)
+    {
+        m_items.append(pieces.at(i).GetItem(textAsPaths));
+    }
+    std::stable_sort(m_items.begin(), m_items.end(), StacksBefore);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutSheet::~VLayoutSheet()
+{
+    qDeleteAll(m_items);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QRectF VLayoutSheet::PaperRect() const
+{
+    return m_paperRect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Paint paints the sheet, mapping the paper rect to target like QGraphicsScene::render() with
+ * Qt::IgnoreAspectRatio.
+ * @param painter active painter.
+ * @param target rectangle on the device.
+ * @param paintPaper fill the paper white like the visible paper item of the scene, otherwise the background of the
+ * device stays.
+ */
+void VLayoutSheet::Paint(QPainter *painter, const QRectF &target, bool paintPaper) const
+{
+    SCASSERT(painter != nullptr)
+
+    if (m_paperRect.isEmpty() || target.isEmpty())
+    {
+        return;
+    }
+
+    painter->save();
+
+    const QTransform sheetTransform = QTransform::fromTranslate(-m_paperRect.x(), -m_paperRect.y())
+            * QTransform::fromScale(target.width() / m_paperRect.width(), target.height() / m_paperRect.height())
+            * QTransform::fromTranslate(target.x(), target.y())
+            * painter->worldTransform();
+
+    painter->setWorldTransform(sheetTransform);
+    if (paintPaper)
+    {
+        painter->fillRect(m_paperRect, Qt::white);
+    }
+
+    for (int i = 0; i < m_items.size(); ++i)
+    {
+        PaintItem(painter, m_items.at(i), sheetTransform);
+    }
+
+    painter->restore();
+}
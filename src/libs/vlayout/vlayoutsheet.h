@@ -0,0 +1,58 @@
+/***************************************************************************
+ **  @file   vlayoutsheet.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VLAYOUTSHEET_H
+#define VLAYOUTSHEET_H
+
+#include <QList>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+
+class QGraphicsItem;
+class QPainter;
+class VLayoutPiece;
+
+/**
+ * @brief The VLayoutSheet class paints one layout sheet without a graphics scene.
+ *
+ * The piece items are built in the constructor, which must run in the GUI thread because it reads the application
+ * settings. Paint() only reads them, so several sheets can be painted from worker threads at the same time.
+ */
+class VLayoutSheet
+{
+public:
+    VLayoutSheet(const QRectF &paperRect, const QVector<VLayoutPiece> &pieces, bool textAsPaths);
+    ~VLayoutSheet();
+
+    QRectF PaperRect() const;
+    void   Paint(QPainter *painter, const QRectF &target, bool paintPaper) const;
+
+private:
+    Q_DISABLE_COPY(VLayoutSheet)
+
+    QRectF                 m_paperRect;
+    QList<QGraphicsItem *> m_items;
+};
+
+#endif // VLAYOUTSHEET_H
@@ -0,0 +1,441 @@
+/***************************************************************************
+ **  @file   vnfpposition.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vnfpposition.h"
+
+#include <QLineF>
+#include <QPolygonF>
+#include <algorithm>
+
+#include "vcontour.h"
+#include "vlayoutpiece.h"
+
+namespace
+{
+// Distance in pixels which is treated as touching. Touching pieces don't overlap.
+const qreal accuracy = 0.001;
+
+struct NfpPolygon
+{
+    QVector<QPointF> points;
+    QRectF           rect;
+};
+
+struct NfpCandidate
+{
+    QPointF translation;
+    QRectF  bound;
+    qint64  square;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline qreal Cross(const QPointF &o, const QPointF &a, const QPointF &b)
+{
+    return (a.x() - o.x()) * (b.y() - o.y()) - (a.y() - o.y()) * (b.x() - o.x());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline bool RectsOverlap(const QRectF &r1, const QRectF &r2)
+{
+    return not (r1.left() > r2.right() || r1.right() < r2.left() || r1.top() > r2.bottom() || r1.bottom() < r2.top());
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StrictlyInside check if point is inside convex polygon and not on its border.
+ */
+bool StrictlyInside(const NfpPolygon &nfp, const QPointF &point)
+{
+    if (point.x() <= nfp.rect.left() + accuracy || point.x() >= nfp.rect.right() - accuracy
+        || point.y() <= nfp.rect.top() + accuracy || point.y() >= nfp.rect.bottom() - accuracy)
+    {
+        return false;
+    }
+
+    const int count = nfp.points.size();
+    for (int i = 0; i < count; ++i)
+    {
+        const QPointF &a = nfp.points.at(i);
+        const QPointF &b = nfp.points.at((i + 1) % count);
+        const qreal length = QLineF(a, b).length();
+        if (qFuzzyIsNull(length))
+        {
+            continue;
+        }
+
+        if (Cross(a, b, point) / length <= accuracy)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AppendEdgeIntersections(const QVector<QPointF> &p1, const QVector<QPointF> &p2, QVector<QPointF> &candidates)
+{
+    for (int i = 0; i < p1.size(); ++i)
+    {
+        const QLineF edge1(p1.at(i), p1.at((i + 1) % p1.size()));
+        const QRectF rect1 = QRectF(edge1.p1(), edge1.p2()).normalized();
+
+        for (int j = 0; j < p2.size(); ++j)
+        {
+            const QLineF edge2(p2.at(j), p2.at((j + 1) % p2.size()));
+            if (not RectsOverlap(rect1, QRectF(edge2.p1(), edge2.p2()).normalized()))
+            {
+                continue;
+            }
+
+            QPointF point;
+            if (edge1.intersects(edge2, &point) == QLineF::BoundedIntersection)
+            {
+                candidates.append(point);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> StartFromLowest(const QVector<QPointF> &points)
+{
+    int pos = 0;
+    for (int i = 1; i < points.size(); ++i)
+    {
+        if (points.at(i).y() < points.at(pos).y()
+            || (qFuzzyCompare(points.at(i).y(), points.at(pos).y()) && points.at(i).x() < points.at(pos).x()))
+        {
+            pos = i;
+        }
+    }
+
+    QVector<QPointF> reordered;
+    reordered.reserve(points.size() + 2);
+    for (int i = 0; i < points.size(); ++i)
+    {
+        reordered.append(points.at((pos + i) % points.size()));
+    }
+    return reordered;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VNfpPosition::VNfpPosition(const VContour &gContour, const QVector<QVector<QPointF>> &arrangedHulls,
+                           const QRectF &arrangedRect, const VLayoutPiece &piece, std::atomic_bool *stop, bool rotate,
+                           int rotationIncrease, bool saveLength)
+    : bestResult(VBestSquare(gContour.GetSize(), saveLength)),
+      gContour(gContour),
+      arrangedHulls(arrangedHulls),
+      arrangedRect(arrangedRect),
+      piece(piece),
+      stop(stop),
+      rotate(rotate),
+      rotationIncrease(rotationIncrease)
+{
+    if ((rotationIncrease >= 1 && rotationIncrease <= 180 && 360 % rotationIncrease == 0) == false)
+    {
+        this->rotationIncrease = 180;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VNfpPosition::run()
+{
+    if (stop->load())
+    {
+        return;
+    }
+
+    const QPointF center = piece.LayoutBoundingRect().center();
+    const int increase = rotate ? rotationIncrease : 360;
+
+    QVector<bool> mirrors = QVector<bool>() << false;
+    if (not piece.IsForbidFlipping())
+    {
+        mirrors.append(true);
+    }
+
+    for (int m = 0; m < mirrors.size(); ++m)
+    {
+        for (int angle = 0; angle < 360; angle = angle + increase)
+        {
+            if (stop->load())
+            {
+                return;
+            }
+
+            // We should use copy of the piece.
+            VLayoutPiece workpiece = piece;
+            if (mirrors.at(m))
+            {
+                workpiece.Mirror(QLineF(center, QPointF(center.x(), center.y() + 100)));
+            }
+
+            if (angle > 0)
+            {
+                workpiece.Rotate(center, angle);
+            }
+
+            CheckOrientation(workpiece);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VBestSquare VNfpPosition::getBestResult() const
+{
+    return bestResult;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ConvexHull find convex hull of points (Andrew's monotone chain). Result has counterclockwise order.
+ */
+QVector<QPointF> VNfpPosition::ConvexHull(const QVector<QPointF> &points)
+{
+    QVector<QPointF> sorted = points;
+    if (sorted.size() < 3)
+    {
+        return sorted;
+    }
+
+    std::sort(sorted.begin(), sorted.end(), [](const QPointF &a, const QPointF &b)
+    {
+        return a.x() < b.x() || (not (b.x() < a.x()) && a.y() < b.y());
+    });
+
+    QVector<QPointF> hull(2 * sorted.size());
+    int k = 0;
+
+    // Lower hull
+    for (int i = 0; i < sorted.size(); ++i)
+    {
+        while (k >= 2 && Cross(hull.at(k-2), hull.at(k-1), sorted.at(i)) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = sorted.at(i);
+    }
+
+    // Upper hull
+    for (int i = sorted.size() - 2, t = k + 1; i >= 0; --i)
+    {
+        while (k >= t && Cross(hull.at(k-2), hull.at(k-1), sorted.at(i)) <= 0)
+        {
+            --k;
+        }
+        hull[k++] = sorted.at(i);
+    }
+
+    hull.resize(k - 1); // Last point is equal to the first
+    return hull;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MinkowskiSum sum of two convex polygons with counterclockwise order. Result is convex polygon with
+ * counterclockwise order.
+ */
+QVector<QPointF> VNfpPosition::MinkowskiSum(const QVector<QPointF> &a, const QVector<QPointF> &b)
+{
+    if (a.isEmpty() || b.isEmpty())
+    {
+        return QVector<QPointF>();
+    }
+
+    if (a.size() < 3 || b.size() < 3)
+    { // Degenerated polygons, just sum all vertices
+        QVector<QPointF> sums;
+        for (int i = 0; i < a.size(); ++i)
+        {
+            for (int j = 0; j < b.size(); ++j)
+            {
+                sums.append(a.at(i) + b.at(j));
+            }
+        }
+        return ConvexHull(sums);
+    }
+
+    // Merge edges of both polygons sorted by polar angle
+    QVector<QPointF> p = StartFromLowest(a);
+    QVector<QPointF> q = StartFromLowest(b);
+
+    const int n = p.size();
+    const int m = q.size();
+
+    p.append(p.at(0));
+    p.append(p.at(1));
+    q.append(q.at(0));
+    q.append(q.at(1));
+
+    QVector<QPointF> sum;
+    sum.reserve(n + m);
+    int i = 0;
+    int j = 0;
+    while (i < n || j < m)
+    {
+        sum.append(p.at(i) + q.at(j));
+        const qreal cross = Cross(QPointF(), p.at(i+1) - p.at(i), q.at(j+1) - q.at(j));
+        if (cross >= 0 && i < n)
+        {
+            ++i;
+        }
+        if (cross <= 0 && j < m)
+        {
+            ++j;
+        }
+    }
+    return sum;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VNfpPosition::CheckOrientation(VLayoutPiece &workpiece)
+{
+    const QRectF pieceRect = workpiece.pieceBoundingRect();
+    const QRectF layoutRect = workpiece.LayoutBoundingRect();
+
+    // Inner-fit rectangle. All translations which keep the piece inside the sheet.
+    const QRectF ifr(QPointF(-pieceRect.left(), -pieceRect.top()),
+                     QPointF(gContour.GetWidth() - pieceRect.right(), gContour.GetHeight() - pieceRect.bottom()));
+    if (ifr.width() < 0 || ifr.height() < 0)
+    {
+        return; // The piece doesn't fit the sheet
+    }
+
+    // Reflected piece hull. Reflection keeps counterclockwise order.
+    QVector<QPointF> reflected = ConvexHull(workpiece.getLayoutAllowancePoints());
+    for (int i = 0; i < reflected.size(); ++i)
+    {
+        reflected[i] = -reflected.at(i);
+    }
+
+    QVector<NfpPolygon> nfps;
+    for (int i = 0; i < arrangedHulls.size(); ++i)
+    {
+        NfpPolygon nfp;
+        nfp.points = MinkowskiSum(arrangedHulls.at(i), reflected);
+        if (nfp.points.size() < 3)
+        {
+            continue;
+        }
+        nfp.rect = QPolygonF(nfp.points).boundingRect();
+        if (RectsOverlap(nfp.rect, ifr))
+        {
+            nfps.append(nfp);
+        }
+    }
+
+    // Candidates: corners of inner-fit rectangle, vertices of NFPs, intersections of NFP edges with each other and
+    // with inner-fit rectangle.
+    QVector<QPointF> points;
+    const QVector<QPointF> ifrPolygon = QVector<QPointF>() << ifr.topLeft() << ifr.topRight() << ifr.bottomRight()
+                                                           << ifr.bottomLeft();
+    points += ifrPolygon;
+
+    for (int i = 0; i < nfps.size(); ++i)
+    {
+        points += nfps.at(i).points;
+        AppendEdgeIntersections(nfps.at(i).points, ifrPolygon, points);
+
+        for (int j = i + 1; j < nfps.size(); ++j)
+        {
+            if (RectsOverlap(nfps.at(i).rect, nfps.at(j).rect))
+            {
+                AppendEdgeIntersections(nfps.at(i).points, nfps.at(j).points, points);
+            }
+        }
+    }
+
+    QVector<NfpCandidate> candidates;
+    candidates.reserve(points.size());
+    for (int i = 0; i < points.size(); ++i)
+    {
+        QPointF t = points.at(i);
+        if (t.x() < ifr.left() - accuracy || t.x() > ifr.right() + accuracy
+            || t.y() < ifr.top() - accuracy || t.y() > ifr.bottom() + accuracy)
+        {
+            continue;
+        }
+        t.setX(qBound(ifr.left(), t.x(), ifr.right()));
+        t.setY(qBound(ifr.top(), t.y(), ifr.bottom()));
+
+        NfpCandidate candidate;
+        candidate.translation = t;
+        candidate.bound = arrangedRect.united(layoutRect.translated(t));
+        candidate.square = bestResult.CandidateSquare(candidate.bound.size());
+        candidates.append(candidate);
+    }
+
+    // Check the best candidates first. The first valid one wins.
+    std::sort(candidates.begin(), candidates.end(), [](const NfpCandidate &c1, const NfpCandidate &c2)
+    {
+        if (c1.square != c2.square)
+        {
+            return c1.square < c2.square;
+        }
+
+        if (c1.translation.y() < c2.translation.y())
+        {
+            return true;
+        }
+
+        if (c2.translation.y() < c1.translation.y())
+        {
+            return false;
+        }
+
+        return c1.translation.x() < c2.translation.x();
+    });
+
+    for (int i = 0; i < candidates.size(); ++i)
+    {
+        if (stop->load())
+        {
+            return;
+        }
+
+        const NfpCandidate &candidate = candidates.at(i);
+        if (candidate.square > bestResult.BestSquare())
+        {
+            return; // Cannot beat the best result from other orientations
+        }
+
+        bool overlap = false;
+        for (int j = 0; j < nfps.size(); ++j)
+        {
+            if (StrictlyInside(nfps.at(j), candidate.translation))
+            {
+                overlap = true;
+                break;
+            }
+        }
+
+        if (not overlap)
+        {
+            workpiece.Translate(candidate.translation.x(), candidate.translation.y());
+            bestResult.NewResult(candidate.bound.size(), 0, 0, workpiece.getTransform(), workpiece.isMirror(),
+                                 BestFrom::Rotation);
+            return;
+        }
+    }
+}
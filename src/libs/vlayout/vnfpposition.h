@@ -0,0 +1,78 @@
+/***************************************************************************
+ **  @file   vnfpposition.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VNFPPOSITION_H
+#define VNFPPOSITION_H
+
+#include <QPointF>
+#include <QRectF>
+#include <QVector>
+#include <QtGlobal>
+#include <atomic>
+
+#include "vbestsquare.h"
+
+class VContour;
+class VLayoutPiece;
+
+/**
+ * @brief The VNfpPosition class searches position for a piece with help of no-fit polygons (NFP).
+ *
+ * For each allowed orientation of the piece the class builds no-fit polygons between the piece and every already
+ * arranged piece. NFP is the set of piece translations where the piece overlaps the arranged piece. Any translation
+ * inside the sheet inner-fit rectangle and outside of all NFPs is a valid position. Candidates are taken from NFP
+ * vertices and intersections of NFP edges, the one that gives the smallest layout square wins, ties are resolved by
+ * bottom-left rule.
+ *
+ * Pieces are approximated by convex hulls of their layout allowance. This keeps NFP calculation linear (Minkowski sum
+ * of convex polygons) at the cost of not nesting pieces into concave parts of others.
+ */
+class VNfpPosition
+{
+public:
+    VNfpPosition(const VContour &gContour, const QVector<QVector<QPointF>> &arrangedHulls, const QRectF &arrangedRect,
+                 const VLayoutPiece &piece, std::atomic_bool *stop, bool rotate, int rotationIncrease,
+                 bool saveLength);
+
+    void run();
+
+    VBestSquare getBestResult() const;
+
+    static QVector<QPointF> ConvexHull(const QVector<QPointF> &points);
+    static QVector<QPointF> MinkowskiSum(const QVector<QPointF> &a, const QVector<QPointF> &b);
+
+private:
+    Q_DISABLE_COPY(VNfpPosition)
+    VBestSquare                     bestResult;
+    const VContour                 &gContour;
+    const QVector<QVector<QPointF>> &arrangedHulls;
+    const QRectF                    arrangedRect;
+    const VLayoutPiece             &piece;
+    std::atomic_bool               *stop;
+    bool                            rotate;
+    int                             rotationIncrease;
+
+    void CheckOrientation(VLayoutPiece &workpiece);
+};
+
+#endif // VNFPPOSITION_H
@@ -73,13 +73,15 @@
 #include "../vmisc/def.h"
 #include "../vmisc/vmath.h"
 
+std::atomic<quint64> VPosition::checkedCandidates(0);
+
 //---------------------------------------------------------------------------------------------------------------------
 VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece, int i, std::atomic_bool *stop,
-                     bool rotate, int rotationIncrease, bool saveLength)
-    : QRunnable(),
-      bestResult(VBestSquare(gContour.GetSize(), saveLength)),
+                     bool rotate, int rotationIncrease, bool saveLength, VSharedBestSquare *sharedBestSquare)
+    : bestResult(VBestSquare(gContour.GetSize(), saveLength)),
       gContour(gContour),
       piece(piece),
+      gRect(gContour.BoundingRect()),
       i(i),
       j(j),
       paperIndex(0),
@@ -87,9 +89,11 @@ VPosition::VPosition(const VContour &gContour, int j, const VLayoutPiece &piece,
       piecesCount(0),
       pieces(),
       stop(stop),
+      sharedBestSquare(sharedBestSquare),
       rotate(rotate),
       rotationIncrease(rotationIncrease),
-      angle_between(0)
+      angle_between(0),
+      checked(0)
 {
     if ((rotationIncrease >= 1 && rotationIncrease <= 180 && 360 % rotationIncrease == 0) == false)
     {
@@ -109,6 +113,7 @@ void VPosition::run()
     VLayoutPiece workpiece = piece;
 
     int dEdge = i;// For mirror piece edge will be different
+    ++checked;
     if (CheckCombineEdges(workpiece, j, dEdge))
     {
         #ifdef LAYOUT_DEBUG
@@ -132,6 +137,8 @@ void VPosition::run()
             Rotate(rotationIncrease);
         }
     }
+
+    checkedCandidates.fetch_add(checked, std::memory_order_relaxed);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -276,6 +283,22 @@ int VPosition::Bias(int length, int maxLength)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CheckedCandidates returns how many piece placements all positions have tried since the last
+ * ResetCheckedCandidates() call. Used to compare the search effort of layouts, e.g. by the layout benchmark.
+ */
+quint64 VPosition::CheckedCandidates()
+{
+    return checkedCandidates.load();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VPosition::ResetCheckedCandidates()
+{
+    checkedCandidates.store(0);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &piece, int globalI, int detJ,
                               BestFrom type)
@@ -284,6 +307,24 @@ void VPosition::SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &piece
     newGContour.append(newGContour.first());
     const QSizeF size = QPolygonF(newGContour).boundingRect().size();
     bestResult.NewResult(size, globalI, detJ, piece.getTransform(), piece.isMirror(), type);
+
+    if (sharedBestSquare != nullptr && bestResult.ValidResult())
+    {
+        // The local best result is one of the candidates, so other positions may use its square as a bound
+        std::atomic<qint64> *shared = &sharedBestSquare->rotationSquare;
+        if (bestResult.Type() == BestFrom::Combine)
+        {
+            sharedBestSquare->combineFound.store(true);
+            shared = &sharedBestSquare->combineSquare;
+        }
+
+        const qint64 square = bestResult.BestSquare();
+        qint64 current = shared->load();
+        while (square < current && not shared->compare_exchange_weak(current, square))
+        {
+            // Another candidate could update the value meanwhile. Repeat until our value is stored or is not better.
+        }
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -304,13 +345,31 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &piece, int j, int &dEdge)
     CrossingType type = CrossingType::Intersection;
     if (SheetContains(piece.pieceBoundingRect()))
     {
-        if (not gContour.GetContour().isEmpty())
+        if (gContour.GetContour().isEmpty())
+        {
+            type = CrossingType::NoIntersection;
+        }
+        else if (CanBeatBest(piece, BestFrom::Combine))
         {
             type = Crossing(piece);
         }
         else
         {
-            type = CrossingType::NoIntersection;
+            // This position can't win, but whether the mirrored one is checked must not depend on the cutoff.
+            // Otherwise the result would depend on the order the positions run in.
+            VLayoutPiece mirrored = piece;
+            mirrored.Mirror(globalEdge);
+            if (piece.IsForbidFlipping() || not SheetContains(mirrored.pieceBoundingRect())
+                    || not CanBeatBest(mirrored, BestFrom::Combine))
+            {
+                return false;
+            }
+
+            type = Crossing(piece);
+            if (type == CrossingType::NoIntersection)
+            {
+                return false;
+            }
         }
     }
 
@@ -352,7 +411,7 @@ bool VPosition::CheckCombineEdges(VLayoutPiece &piece, int j, int &dEdge)
         }
 
         CrossingType type = CrossingType::Intersection;
-        if (SheetContains(piece.pieceBoundingRect()))
+        if (SheetContains(piece.pieceBoundingRect()) && CanBeatBest(piece, BestFrom::Combine))
         {
             type = Crossing(piece);
         }
@@ -389,7 +448,7 @@ bool VPosition::CheckRotationEdges(VLayoutPiece &piece, int j, int dEdge, int an
 #endif
 
     CrossingType type = CrossingType::Intersection;
-    if (SheetContains(piece.pieceBoundingRect()))
+    if (SheetContains(piece.pieceBoundingRect()) && CanBeatBest(piece, BestFrom::Rotation))
     {
         type = Crossing(piece);
     }
@@ -413,15 +472,15 @@ bool VPosition::CheckRotationEdges(VLayoutPiece &piece, int j, int dEdge, int an
 //---------------------------------------------------------------------------------------------------------------------
 VPosition::CrossingType VPosition::Crossing(const VLayoutPiece &piece) const
 {
-    const QRectF gRect = gContour.BoundingRect();
     if (not gRect.intersects(piece.LayoutBoundingRect()) && not gRect.contains(piece.pieceBoundingRect()))
     {
         // This we can determine efficiently.
         return CrossingType::NoIntersection;
     }
 
-    const QPainterPath gPath = gContour.ContourPath();
-    if (not gPath.intersects(piece.LayoutAllowancePath()) && not gPath.contains(piece.createMainPath()))
+    // Main path lies inside layout allowance, so if allowance doesn't intersect the contour the main path cannot be
+    // contained by the contour too.
+    if (not gContour.Intersects(piece.getLayoutAllowancePoints()))
     {
         return CrossingType::NoIntersection;
     }
@@ -438,6 +497,38 @@ bool VPosition::SheetContains(const QRectF &rect) const
     return bRect.contains(rect);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CanBeatBest cheap check if a candidate position has a chance to become the best result.
+ *
+ * United contour always contains all points of the global contour and all layout allowance points of the piece. So,
+ * united bounding rect of both is the lower bound for the candidate size. If even this bound is worse than the best
+ * square of the same type found so far, or the candidate is a rotation and a combine candidate was already found, the
+ * candidate can't win and there is no need to run expensive crossing test.
+ */
+bool VPosition::CanBeatBest(const VLayoutPiece &piece, BestFrom type) const
+{
+    if (sharedBestSquare == nullptr)
+    {
+        return true;
+    }
+
+    if (type == BestFrom::Rotation && sharedBestSquare->combineFound.load())
+    {
+        return false;
+    }
+
+    QRectF bound = piece.LayoutBoundingRect();
+    if (not gContour.GetContour().isEmpty())
+    {
+        bound = bound.united(gRect);
+    }
+
+    const qint64 best = type == BestFrom::Combine ? sharedBestSquare->combineSquare.load()
+                                                  : sharedBestSquare->rotationSquare.load();
+    return bestResult.CandidateSquare(bound.size()) <= best;
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void VPosition::CombineEdges(VLayoutPiece &piece, const QLineF &globalEdge, const int &dEdge)
 {
@@ -509,6 +600,7 @@ void VPosition::Rotate(int increase)
         // We should use copy of the piece.
         VLayoutPiece workpiece = piece;
 
+        ++checked;
         if (CheckRotationEdges(workpiece, j, i, angle))
         {
             #ifdef LAYOUT_DEBUG
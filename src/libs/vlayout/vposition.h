@@ -54,7 +54,7 @@
 #define VPOSITION_H
 
 #include <qcompilerdetection.h>
-#include <QRunnable>
+#include <QRectF>
 #include <QVector>
 #include <QtGlobal>
 #include <atomic>
@@ -64,12 +64,42 @@
 #include "vlayoutdef.h"
 #include "vlayoutpiece.h"
 
-class VPosition : public QRunnable
+/**
+ * @brief The VSharedBestSquare struct holds the best squares found so far by all positions of the current piece.
+ *
+ * A combine candidate always ranks higher than a rotation one (see VBestSquare::NewResult()), so each type has own
+ * bound and rotation candidates are skipped as soon as any combine candidate is found.
+ */
+struct VSharedBestSquare
+{
+    explicit VSharedBestSquare(qint64 square)
+        : combineSquare(square),
+          rotationSquare(square),
+          combineFound(false)
+    {}
+
+    std::atomic<qint64> combineSquare;
+    std::atomic<qint64> rotationSquare;
+    std::atomic_bool    combineFound;
+
+private:
+    Q_DISABLE_COPY(VSharedBestSquare)
+};
+
+/**
+ * @brief The VPosition class checks all positions of the piece edge i against the global contour edge j.
+ *
+ * The class doesn't own the contour and the piece. Both must stay alive while the object exists. This allows sharing
+ * read-only data between all candidates processed by VLayoutScheduler.
+ */
+class VPosition
 {
 public:
     VPosition(const VContour &gContour, int j, const VLayoutPiece &piece, int i, std::atomic_bool *stop, bool rotate,
-              int rotationIncrease, bool saveLength);
-    virtual ~VPosition() Q_DECL_OVERRIDE{}
+              int rotationIncrease, bool saveLength, VSharedBestSquare *sharedBestSquare = nullptr);
+    ~VPosition() {}
+
+    void run();
 
     quint32 getPaperIndex() const;
     void setPaperIndex(const quint32 &value);
@@ -89,11 +119,15 @@ class VPosition : public QRunnable
 
     static int Bias(int length, int maxLength);
 
+    static quint64 CheckedCandidates();
+    static void    ResetCheckedCandidates();
+
 private:
     Q_DISABLE_COPY(VPosition)
     VBestSquare bestResult;
-    const VContour gContour;
-    const VLayoutPiece piece;
+    const VContour &gContour;
+    const VLayoutPiece &piece;
+    const QRectF gRect;
     int i;
     int j;
     quint32 paperIndex;
@@ -101,12 +135,22 @@ class VPosition : public QRunnable
     quint32 piecesCount;
     QVector<VLayoutPiece> pieces;
     std::atomic_bool *stop;
+    /**
+     * @brief sharedBestSquare the best squares found so far by all candidates of the current piece. Used for early
+     * cutoff of positions which can't beat the best result.
+     */
+    VSharedBestSquare *sharedBestSquare;
     bool rotate;
     int rotationIncrease;
     /**
      * @brief angle_between keep angle between global edge and piece edge. Need for optimization rotation.
      */
     qreal angle_between;
+    /** @brief checked the number of placements this position has tried, flushed to checkedCandidates in run(). */
+    quint64 checked;
+
+    /** @brief checkedCandidates the number of placements tried by all positions since the last reset. */
+    static std::atomic<quint64> checkedCandidates;
 
     enum class CrossingType : char
     {
@@ -122,8 +166,6 @@ class VPosition : public QRunnable
         EdgeError = 2
     };
 
-    virtual void run() Q_DECL_OVERRIDE;
-
     void SaveCandidate(VBestSquare &bestResult, const VLayoutPiece &piece, int globalI, int detJ, BestFrom type);
 
     bool CheckCombineEdges(VLayoutPiece &piece, int j, int &dEdge);
@@ -131,6 +173,7 @@ class VPosition : public QRunnable
 
     CrossingType Crossing(const VLayoutPiece &piece) const;
     bool         SheetContains(const QRectF &rect) const;
+    bool         CanBeatBest(const VLayoutPiece &piece, BestFrom type) const;
 
     void CombineEdges(VLayoutPiece &piece, const QLineF &globalEdge, const int &dEdge);
     void RotateEdges(VLayoutPiece &piece, const QLineF &globalEdge, int dEdge, int angle) const;
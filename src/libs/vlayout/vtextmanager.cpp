@@ -30,8 +30,11 @@
 #include <QFileInfo>
 #include <QFontMetrics>
 #include <QLatin1String>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
 #include <QApplication>
+#include <QCache>
 #include <QDebug>
 
 #include "../ifc/xml/vabstractpattern.h"
@@ -57,6 +60,48 @@ QList<TextLine> VTextManager::m_patternLabelLines = QList<TextLine>();
 
 namespace
 {
+// Layout pieces are prepared in parallel. Guards reading the pattern document and the shared pattern label lines.
+QMutex documentMutex;
+
+/** @brief Maximum number of fitted labels kept in the cache. */
+const int maxFittedLabels = 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+QMutex *FittedFontCacheMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QCache<QString, int> *FittedFontCache()
+{
+    static QCache<QString, int> cache(maxFittedLabels);
+    return &cache;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString FittedFontKey(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH)
+{
+    QString key = font.toString() + QLatin1Char('|') + QString::number(fW, 'g', 12) + QLatin1Char('|')
+            + QString::number(fH, 'g', 12);
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const TextLine &tl = lines.at(i);
+        key += QLatin1Char('\n') + QString::number(tl.m_iFontSize) + QLatin1Char(tl.bold ? 'b' : '-')
+                + QLatin1Char(tl.italic ? 'i' : '-') + tl.m_text;
+    }
+    return key;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int TextLineWidth(QFont font, const TextLine &tl, int iFS)
+{
+    font.setPixelSize(iFS + tl.m_iFontSize);
+    font.setBold(tl.bold);
+    font.setItalic(tl.italic);
+    return QFontMetrics(font).horizontalAdvance(tl.m_text);
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 QMap<QString, QString> PreparePlaceholders(const VAbstractPattern *doc)
@@ -278,11 +323,60 @@ const TextLine& VTextManager::GetSourceLine(int i) const
  * @param fH rectangle height
  */
 void VTextManager::FitFontSize(qreal fW, qreal fH)
+{
+    const int iFS = FittedFontSize(m_font, m_liLines, fW, fH);
+    SetFontSize(iFS);
+    qDebug() << "Font size" << GetSourceLinesCount() << iFS;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VTextManager::FittedFontSize returns the font size for FitFontSize. Labels are refitted on every refresh and
+ * layout, but their text and box rarely change, so the result is cached by font, lines and box.
+ * @param font label font
+ * @param lines text lines
+ * @param fW rectangle width
+ * @param fH rectangle height
+ * @return font size in pixels
+ */
+int VTextManager::FittedFontSize(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH)
+{
+    const QString key = FittedFontKey(font, lines, fW, fH);
+    {
+        QMutexLocker locker(FittedFontCacheMutex());
+        if (const int *cached = FittedFontCache()->object(key))
+        {
+            return *cached;
+        }
+    }
+
+    const int iFS = SearchFontSize(font, lines, fW, fH);
+
+    QMutexLocker locker(FittedFontCacheMutex());
+    FittedFontCache()->insert(key, new int(iFS));
+    return iFS;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief VTextManager::SearchFontSize finds the font size without the cache. The start size comes from the height,
+ * if the widest line is too wide the biggest smaller size it fits in is searched.
+ *
+ * The result is the same as of the old linear walk from the start size down to MIN_FONT_SIZE. That includes
+ * MIN_FONT_SIZE - 1 when the start size is already MIN_FONT_SIZE and the line is too wide. SetFontSize() never goes
+ * below MIN_FONT_SIZE.
+ * @param font label font
+ * @param lines text lines
+ * @param fW rectangle width
+ * @param fH rectangle height
+ * @return font size in pixels
+ */
+int VTextManager::SearchFontSize(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH)
 {
     int iFS = 0;
-    if (GetSourceLinesCount() > 0)
+    if (lines.size() > 0)
     {//division by zero
-        iFS = 3*qFloor(fH/GetSourceLinesCount())/4;
+        iFS = 3*qFloor(fH/lines.size())/4;
     }
 
     if (iFS < MIN_FONT_SIZE)
@@ -294,16 +388,10 @@ void VTextManager::FitFontSize(qreal fW, qreal fH)
 
     int iMaxLen = 0;
     TextLine maxLine;
-    QFont fnt;
-    for (int i = 0; i < GetSourceLinesCount(); ++i)
+    for (int i = 0; i < lines.size(); ++i)
     {
-        const TextLine& tl = GetSourceLine(i);
-        fnt = m_font;
-        fnt.setPixelSize(iFS + tl.m_iFontSize);
-        fnt.setBold(tl.bold);
-        fnt.setItalic(tl.italic);
-        QFontMetrics fm(fnt);
-        const int iTW = fm.horizontalAdvance(tl.m_text);
+        const TextLine& tl = lines.at(i);
+        const int iTW = TextLineWidth(font, tl, iFS);
         if (iTW > iMaxLen)
         {
             iMaxLen = iTW;
@@ -312,22 +400,26 @@ void VTextManager::FitFontSize(qreal fW, qreal fH)
     }
     if (iMaxLen > fW)
     {
-        QFont fnt = m_font;
-        fnt.setBold(maxLine.bold);
-        fnt.setItalic(maxLine.italic);
-
-        int lineLength = 0;
-        do
+        // The widest line is too wide at iFS, find the biggest smaller size it fits in. Width grows with the size.
+        int low = MIN_FONT_SIZE;
+        int high = iFS - 1;
+        int fitted = qMin(MIN_FONT_SIZE, iFS - 1);
+        while (low <= high)
         {
-            --iFS;
-            fnt.setPixelSize(iFS + maxLine.m_iFontSize);
-            QFontMetrics fm(fnt);
-            lineLength = fm.horizontalAdvance(maxLine.m_text);
+            const int middle = low + (high - low) / 2;
+            if (TextLineWidth(font, maxLine, middle) <= fW)
+            {
+                fitted = middle;
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle - 1;
+            }
         }
-        while (lineLength > fW && iFS > MIN_FONT_SIZE);
+        iFS = fitted;
     }
-    SetFontSize(iFS);
-    qDebug() << "Font size" << GetSourceLinesCount() << iFS;
+    return iFS;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -340,7 +432,11 @@ void VTextManager::Update(const QString& qsName, const VPieceLabelData& data)
 {
     m_liLines.clear();
 
-    QMap<QString, QString> placeholders = PreparePlaceholders(qApp->getCurrentDocument());
+    QMap<QString, QString> placeholders;
+    {
+        QMutexLocker locker(&documentMutex);
+        placeholders = PreparePlaceholders(qApp->getCurrentDocument());
+    }
     InitPiecePlaceholders(placeholders, qsName, data);
 
     QVector<VLabelTemplateLine> lines = data.GetLabelTemplate();
@@ -362,6 +458,8 @@ void VTextManager::Update(VAbstractPattern *pDoc)
 {
     m_liLines.clear();
 
+    QMutexLocker locker(&documentMutex);
+
     if (m_patternLabelLines.isEmpty() || pDoc->GetPatternWasChanged())
     {
         QVector<VLabelTemplateLine> lines = pDoc->getPatternLabelTemplate();
@@ -79,6 +79,9 @@ class VTextManager
     void         SetFontSize(int iFS);
     void         FitFontSize(qreal fW, qreal fH);
 
+    static int FittedFontSize(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH);
+    static int SearchFontSize(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH);
+
     QList<TextLine> GetAllSourceLines() const;
     int             GetSourceLinesCount() const;
     const TextLine& GetSourceLine(int i) const;
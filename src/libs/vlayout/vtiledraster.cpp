@@ -0,0 +1,698 @@
+/***************************************************************************
+ **  @file   vtiledraster.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vtiledraster.h"
+
+#include <QBrush>
+#include <QFile>
+#include <QGraphicsScene>
+#include <QIODevice>
+#include <QImage>
+#include <QImageWriter>
+#include <QPainter>
+#include <QPicture>
+#include <QRectF>
+#include <QScopedPointer>
+#include <QSize>
+#include <QThread>
+#include <QThreadPool>
+#include <QVector>
+#include <QtEndian>
+
+#include "../vmisc/def.h"
+#include "../vmisc/vfunctiontask.h"
+
+namespace
+{
+// Default strip size, in bytes of ARGB32 pixels.
+const qint64 stripBytes = 16 * 1024 * 1024;
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T>
+void AppendLittleEndian(QByteArray &data, T value)
+{
+    uchar bytes[sizeof(T)];
+    qToLittleEndian(value, bytes);
+    data.append(reinterpret_cast<const char *>(bytes), static_cast<int>(sizeof(T)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief PackBits appends the PackBits (TIFF run length) encoding of data to out.
+ */
+void PackBits(const uchar *data, int size, QByteArray &out)
+{
+    int i = 0;
+    while (i < size)
+    {
+        int run = 1;
+        while (i + run < size && run < 128 && data[i + run] == data[i])
+        {
+            ++run;
+        }
+
+        if (run > 1)
+        {
+            out.append(static_cast<char>(1 - run));
+            out.append(static_cast<char>(data[i]));
+            i += run;
+            continue;
+        }
+
+        // Literal bytes up to the next run of three
+        const int start = i;
+        int length = 0;
+        while (i < size && length < 128)
+        {
+            if (i + 2 < size && data[i] == data[i + 1] && data[i] == data[i + 2])
+            {
+                break;
+            }
+            ++i;
+            ++length;
+        }
+        out.append(static_cast<char>(length - 1));
+        out.append(reinterpret_cast<const char *>(data + start), length);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VRasterStripWriter class writes an image file strip by strip. Encode() is called from worker threads,
+ * the other methods from the exporting thread in strip order.
+ */
+class VRasterStripWriter
+{
+public:
+    VRasterStripWriter() {}
+    virtual ~VRasterStripWriter() Q_DECL_EQ_DEFAULT;
+
+    virtual bool       Begin(QIODevice *device, const QSize &size, int stripHeight) = 0;
+    virtual QByteArray Encode(const QImage &strip) const = 0;
+
+    virtual bool WriteStrip(QIODevice *device, const QByteArray &data)
+    {
+        return device->write(data) == data.size();
+    }
+
+    virtual bool Finish(QIODevice *device)
+    {
+        Q_UNUSED(device)
+        return true;
+    }
+
+private:
+    Q_DISABLE_COPY(VRasterStripWriter)
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VPpmWriter class writes binary (P6) PPM files. Alpha is dropped.
+ */
+class VPpmWriter : public VRasterStripWriter
+{
+public:
+    virtual bool Begin(QIODevice *device, const QSize &size, int stripHeight) Q_DECL_OVERRIDE
+    {
+        Q_UNUSED(stripHeight)
+        const QByteArray header = QString("P6\n%1 %2\n255\n").arg(size.width()).arg(size.height()).toLatin1();
+        return device->write(header) == header.size();
+    }
+
+    virtual QByteArray Encode(const QImage &strip) const Q_DECL_OVERRIDE
+    {
+        QByteArray data;
+        data.reserve(strip.width() * strip.height() * 3);
+        for (int y = 0; y < strip.height(); ++y)
+        {
+            const QRgb *line = reinterpret_cast<const QRgb *>(strip.constScanLine(y));
+            for (int x = 0; x < strip.width(); ++x)
+            {
+                data.append(static_cast<char>(qRed(line[x])));
+                data.append(static_cast<char>(qGreen(line[x])));
+                data.append(static_cast<char>(qBlue(line[x])));
+            }
+        }
+        return data;
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VBmpWriter class writes 24 bit top-down BMP files. Alpha is dropped.
+ */
+class VBmpWriter : public VRasterStripWriter
+{
+public:
+    virtual bool Begin(QIODevice *device, const QSize &size, int stripHeight) Q_DECL_OVERRIDE
+    {
+        Q_UNUSED(stripHeight)
+        const quint32 headerSize = 54;
+        const qint64 rowBytes = (qint64(size.width()) * 3 + 3) & ~qint64(3);
+        const qint64 imageBytes = rowBytes * size.height();
+        if (headerSize + imageBytes > 0xFFFFFFFFLL)
+        {
+            return false;
+        }
+
+        QByteArray header("BM");
+        AppendLittleEndian<quint32>(header, static_cast<quint32>(headerSize + imageBytes));
+        AppendLittleEndian<quint32>(header, 0);
+        AppendLittleEndian<quint32>(header, headerSize);
+        AppendLittleEndian<quint32>(header, 40);
+        AppendLittleEndian<qint32>(header, size.width());
+        AppendLittleEndian<qint32>(header, -size.height()); // Negative height, rows go from top to bottom
+        AppendLittleEndian<quint16>(header, 1);
+        AppendLittleEndian<quint16>(header, 24);
+        AppendLittleEndian<quint32>(header, 0);
+        AppendLittleEndian<quint32>(header, static_cast<quint32>(imageBytes));
+        AppendLittleEndian<qint32>(header, 2835); // 72 dpi
+        AppendLittleEndian<qint32>(header, 2835);
+        AppendLittleEndian<quint32>(header, 0);
+        AppendLittleEndian<quint32>(header, 0);
+        return device->write(header) == header.size();
+    }
+
+    virtual QByteArray Encode(const QImage &strip) const Q_DECL_OVERRIDE
+    {
+        const int padding = (4 - (strip.width() * 3) % 4) % 4;
+        QByteArray data;
+        data.reserve((strip.width() * 3 + padding) * strip.height());
+        for (int y = 0; y < strip.height(); ++y)
+        {
+            const QRgb *line = reinterpret_cast<const QRgb *>(strip.constScanLine(y));
+            for (int x = 0; x < strip.width(); ++x)
+            {
+                data.append(static_cast<char>(qBlue(line[x])));
+                data.append(static_cast<char>(qGreen(line[x])));
+                data.append(static_cast<char>(qRed(line[x])));
+            }
+            data.append(QByteArray(padding, '\0'));
+        }
+        return data;
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The VTiffWriter class writes PackBits compressed RGBA TIFF files, one strip per rendered strip. The image
+ * directory goes to the end of the file because the strip offsets are known only after writing. Files that may
+ * grow past 4 GB are written as BigTIFF.
+ */
+class VTiffWriter : public VRasterStripWriter
+{
+public:
+    VTiffWriter()
+        : m_bigTiff(false),
+          m_size(),
+          m_stripHeight(0),
+          m_offsets(),
+          m_counts()
+    {}
+
+    virtual bool Begin(QIODevice *device, const QSize &size, int stripHeight) Q_DECL_OVERRIDE
+    {
+        m_size = size;
+        m_stripHeight = stripHeight;
+
+        // The worst case of PackBits is one extra byte per 128 bytes plus one per row.
+        const qint64 rowBytes = qint64(size.width()) * 4;
+        const qint64 maxBytes = (rowBytes + rowBytes / 128 + 1) * size.height() + 1024 * 1024;
+        m_bigTiff = maxBytes > 0xFFFFFFFFLL;
+
+        QByteArray header("II");
+        if (m_bigTiff)
+        {
+            AppendLittleEndian<quint16>(header, 43);
+            AppendLittleEndian<quint16>(header, 8);
+            AppendLittleEndian<quint16>(header, 0);
+            AppendLittleEndian<quint64>(header, 0); // Directory offset, written by Finish()
+        }
+        else
+        {
+            AppendLittleEndian<quint16>(header, 42);
+            AppendLittleEndian<quint32>(header, 0);
+        }
+        return device->write(header) == header.size();
+    }
+
+    virtual QByteArray Encode(const QImage &strip) const Q_DECL_OVERRIDE
+    {
+        QByteArray row(strip.width() * 4, '\0');
+        uchar *bytes = reinterpret_cast<uchar *>(row.data());
+
+        QByteArray data;
+        for (int y = 0; y < strip.height(); ++y)
+        {
+            const QRgb *line = reinterpret_cast<const QRgb *>(strip.constScanLine(y));
+            for (int x = 0; x < strip.width(); ++x)
+            {
+                bytes[x * 4] = static_cast<uchar>(qRed(line[x]));
+                bytes[x * 4 + 1] = static_cast<uchar>(qGreen(line[x]));
+                bytes[x * 4 + 2] = static_cast<uchar>(qBlue(line[x]));
+                bytes[x * 4 + 3] = static_cast<uchar>(qAlpha(line[x]));
+            }
+            PackBits(bytes, row.size(), data);
+        }
+        return data;
+    }
+
+    virtual bool WriteStrip(QIODevice *device, const QByteArray &data) Q_DECL_OVERRIDE
+    {
+        m_offsets.append(static_cast<quint64>(device->pos()));
+        m_counts.append(static_cast<quint64>(data.size()));
+        return VRasterStripWriter::WriteStrip(device, data);
+    }
+
+    virtual bool Finish(QIODevice *device) Q_DECL_OVERRIDE;
+
+private:
+    Q_DISABLE_COPY(VTiffWriter)
+
+    enum Type : quint16 { Short = 3, Long = 4, Rational = 5, Long8 = 16 };
+
+    struct Entry
+    {
+        quint16    tag;
+        quint16    type;
+        quint64    count;
+        QByteArray value;
+    };
+
+    bool             m_bigTiff;
+    QSize            m_size;
+    int              m_stripHeight;
+    QVector<quint64> m_offsets;
+    QVector<quint64> m_counts;
+
+    static Entry ShortEntry(quint16 tag, const QVector<quint16> &values);
+    static Entry LongEntry(quint16 tag, quint32 value);
+    static Entry RationalEntry(quint16 tag, quint32 numerator, quint32 denominator);
+    Entry        OffsetsEntry(quint16 tag, const QVector<quint64> &values) const;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiffWriter::Entry VTiffWriter::ShortEntry(quint16 tag, const QVector<quint16> &values)
+{
+    Entry entry{tag, Short, static_cast<quint64>(values.size()), QByteArray()};
+    for (quint16 value : values)
+    {
+        AppendLittleEndian<quint16>(entry.value, value);
+    }
+    return entry;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiffWriter::Entry VTiffWriter::LongEntry(quint16 tag, quint32 value)
+{
+    Entry entry{tag, Long, 1, QByteArray()};
+    AppendLittleEndian<quint32>(entry.value, value);
+    return entry;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiffWriter::Entry VTiffWriter::RationalEntry(quint16 tag, quint32 numerator, quint32 denominator)
+{
+    Entry entry{tag, Rational, 1, QByteArray()};
+    AppendLittleEndian<quint32>(entry.value, numerator);
+    AppendLittleEndian<quint32>(entry.value, denominator);
+    return entry;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiffWriter::Entry VTiffWriter::OffsetsEntry(quint16 tag, const QVector<quint64> &values) const
+{
+    Entry entry{tag, m_bigTiff ? Long8 : Long, static_cast<quint64>(values.size()), QByteArray()};
+    for (quint64 value : values)
+    {
+        if (m_bigTiff)
+        {
+            AppendLittleEndian<quint64>(entry.value, value);
+        }
+        else
+        {
+            AppendLittleEndian<quint32>(entry.value, static_cast<quint32>(value));
+        }
+    }
+    return entry;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VTiffWriter::Finish(QIODevice *device)
+{
+    // Entries must be sorted by tag
+    QVector<Entry> entries;
+    entries.append(LongEntry(256, static_cast<quint32>(m_size.width())));        // ImageWidth
+    entries.append(LongEntry(257, static_cast<quint32>(m_size.height())));       // ImageLength
+    entries.append(ShortEntry(258, QVector<quint16>{8, 8, 8, 8}));               // BitsPerSample
+    entries.append(ShortEntry(259, QVector<quint16>{32773}));                    // Compression, PackBits
+    entries.append(ShortEntry(262, QVector<quint16>{2}));                        // PhotometricInterpretation, RGB
+    entries.append(OffsetsEntry(273, m_offsets));                                // StripOffsets
+    entries.append(ShortEntry(277, QVector<quint16>{4}));                        // SamplesPerPixel
+    entries.append(LongEntry(278, static_cast<quint32>(m_stripHeight)));         // RowsPerStrip
+    entries.append(OffsetsEntry(279, m_counts));                                 // StripByteCounts
+    entries.append(RationalEntry(282, 72, 1));                                   // XResolution
+    entries.append(RationalEntry(283, 72, 1));                                   // YResolution
+    entries.append(ShortEntry(284, QVector<quint16>{1}));                        // PlanarConfiguration, chunky
+    entries.append(ShortEntry(296, QVector<quint16>{2}));                        // ResolutionUnit, inch
+    entries.append(ShortEntry(338, QVector<quint16>{2}));                        // ExtraSamples, unassociated alpha
+
+    const int inlineSize = m_bigTiff ? 8 : 4;
+    for (int i = 0; i < entries.size(); ++i)
+    {
+        Entry &entry = entries[i];
+        if (entry.value.size() > inlineSize)
+        {
+            // Values that don't fit in the entry are stored before the directory, on a word boundary
+            if (device->pos() % 2 != 0 && device->write("\0", 1) != 1)
+            {
+                return false;
+            }
+            const quint64 offset = static_cast<quint64>(device->pos());
+            if (device->write(entry.value) != entry.value.size())
+            {
+                return false;
+            }
+            entry.value.clear();
+            if (m_bigTiff)
+            {
+                AppendLittleEndian<quint64>(entry.value, offset);
+            }
+            else
+            {
+                AppendLittleEndian<quint32>(entry.value, static_cast<quint32>(offset));
+            }
+        }
+        else
+        {
+            entry.value.append(QByteArray(inlineSize - entry.value.size(), '\0'));
+        }
+    }
+
+    if (device->pos() % 2 != 0 && device->write("\0", 1) != 1)
+    {
+        return false;
+    }
+    const quint64 directoryOffset = static_cast<quint64>(device->pos());
+
+    QByteArray directory;
+    if (m_bigTiff)
+    {
+        AppendLittleEndian<quint64>(directory, static_cast<quint64>(entries.size()));
+    }
+    else
+    {
+        AppendLittleEndian<quint16>(directory, static_cast<quint16>(entries.size()));
+    }
+
+    for (int i = 0; i < entries.size(); ++i)
+    {
+        const Entry &entry = entries.at(i);
+        AppendLittleEndian<quint16>(directory, entry.tag);
+        AppendLittleEndian<quint16>(directory, entry.type);
+        if (m_bigTiff)
+        {
+            AppendLittleEndian<quint64>(directory, entry.count);
+        }
+        else
+        {
+            AppendLittleEndian<quint32>(directory, static_cast<quint32>(entry.count));
+        }
+        directory.append(entry.value);
+    }
+
+    QByteArray offset;
+    if (m_bigTiff)
+    {
+        AppendLittleEndian<quint64>(directory, 0); // No next directory
+        AppendLittleEndian<quint64>(offset, directoryOffset);
+    }
+    else
+    {
+        AppendLittleEndian<quint32>(directory, 0);
+        AppendLittleEndian<quint32>(offset, static_cast<quint32>(directoryOffset));
+    }
+
+    return device->write(directory) == directory.size()
+            && device->seek(m_bigTiff ? 8 : 4)
+            && device->write(offset) == offset.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VRasterStripWriter *CreateStripWriter(const QByteArray &format)
+{
+    const QByteArray name = format.toUpper();
+    if (name == "TIF" || name == "TIFF")
+    {
+        return new VTiffWriter();
+    }
+    else if (name == "BMP")
+    {
+        return new VBmpWriter();
+    }
+    else if (name == "PPM")
+    {
+        return new VPpmWriter();
+    }
+    return nullptr;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiledRaster::VTiledRaster(QGraphicsScene *scene, const QColor &background, const QFont &font)
+    : m_size(),
+      m_render(),
+      m_background(background),
+      m_font(font),
+      m_quality(-1),
+      m_stripHeight(0),
+      m_threadCount(0),
+      m_error()
+{
+    SCASSERT(scene != nullptr)
+    const QRectF sourceRect = scene->sceneRect();
+    m_size = sourceRect.size().toSize();
+    const QRectF target(QPointF(), QSizeF(m_size));
+    m_render = [scene, sourceRect, target](QPainter *painter)
+    {
+        scene->render(painter, target, sourceRect, Qt::IgnoreAspectRatio);
+    };
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VTiledRaster::VTiledRaster(const QSize &size, const RenderFunction &render, const QColor &background,
+                           const QFont &font)
+    : m_size(size),
+      m_render(render),
+      m_background(background),
+      m_font(font),
+      m_quality(-1),
+      m_stripHeight(0),
+      m_threadCount(0),
+      m_error()
+{
+    SCASSERT(render)
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VTiledRaster::SetQuality(int quality)
+{
+    m_quality = quality;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetStripHeight sets the number of rows rendered at once. 0 picks a height that keeps strips at about 16 MB.
+ */
+void VTiledRaster::SetStripHeight(int rows)
+{
+    m_stripHeight = qMax(0, rows);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetThreadCount sets how many strips are rendered at once. 0 uses all cores.
+ */
+void VTiledRaster::SetThreadCount(int threads)
+{
+    m_threadCount = qMax(0, threads);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VTiledRaster::ErrorString() const
+{
+    return m_error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VTiledRaster::IsStreamed(const QByteArray &format)
+{
+    QScopedPointer<VRasterStripWriter> writer(CreateStripWriter(format));
+    return not writer.isNull();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool VTiledRaster::Write(const QString &fileName, const QByteArray &format)
+{
+    m_error.clear();
+
+    const QSize size = m_size;
+    if (size.isEmpty())
+    {
+        m_error = tr("Nothing to export.");
+        return false;
+    }
+
+    // A scene can be painted only from the GUI thread, strip workers replay this recording instead.
+    QPicture picture;
+    {
+        QPainter painter(&picture);
+        painter.setFont(m_font);
+        painter.setRenderHint(QPainter::Antialiasing, true);
+        painter.setBrush(QBrush(Qt::NoBrush));
+        m_render(&painter);
+    }
+    const QByteArray recording(picture.data(), static_cast<int>(picture.size()));
+
+    int stripHeight = m_stripHeight;
+    if (stripHeight <= 0)
+    {
+        stripHeight = static_cast<int>(qMax<qint64>(1, stripBytes / (qint64(size.width()) * 4)));
+    }
+    stripHeight = qMin(stripHeight, size.height());
+    const int strips = (size.height() + stripHeight - 1) / stripHeight;
+
+    auto RenderStrip = [this, &recording](QImage &strip, int top)
+    {
+        strip.fill(m_background);
+
+        QPicture replay;
+        replay.setData(recording.constData(), static_cast<uint>(recording.size()));
+
+        QPainter painter(&strip);
+        painter.setRenderHint(QPainter::Antialiasing, true);
+        painter.translate(0, -top);
+        replay.play(&painter);
+    };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(m_threadCount > 0 ? m_threadCount : qMax(1, QThread::idealThreadCount()));
+
+    QScopedPointer<VRasterStripWriter> writer(CreateStripWriter(format));
+    if (writer.isNull())
+    {
+        // The encoder needs the whole image, render the strips straight into it.
+        QImage image(size, QImage::Format_ARGB32);
+        if (image.isNull())
+        {
+            m_error = tr("The layout is too big to be exported as %1. Use TIF, BMP or PPM instead.")
+                    .arg(QString(format));
+            return false;
+        }
+
+        uchar *bits = image.bits();
+        const int bytesPerLine = image.bytesPerLine();
+        for (int i = 0; i < strips; ++i)
+        {
+            const int top = i * stripHeight;
+            const int height = qMin(stripHeight, size.height() - top);
+            pool.start(new VFunctionTask([&RenderStrip, bits, bytesPerLine, size, top, height]()
+            {
+                QImage strip(bits + qint64(top) * bytesPerLine, size.width(), height, bytesPerLine,
+                             QImage::Format_ARGB32);
+                RenderStrip(strip, top);
+            }));
+        }
+        pool.waitForDone();
+
+        QImageWriter imageWriter(fileName, format);
+        imageWriter.setQuality(m_quality);
+        if (not imageWriter.write(image))
+        {
+            m_error = imageWriter.errorString();
+            return false;
+        }
+        return true;
+    }
+
+    QFile file(fileName);
+    if (not file.open(QIODevice::WriteOnly))
+    {
+        m_error = tr("Can't open file %1: %2").arg(fileName, file.errorString());
+        return false;
+    }
+
+    if (not writer->Begin(&file, size, stripHeight))
+    {
+        m_error = tr("Can't write %1 file %2.").arg(QString(format), fileName);
+        return false;
+    }
+
+    // Render one strip per thread at a time and write them in order, so memory stays bounded.
+    const int batch = pool.maxThreadCount();
+    for (int first = 0; first < strips; first += batch)
+    {
+        const int count = qMin(batch, strips - first);
+        QVector<QByteArray> encoded(count);
+        QByteArray *results = encoded.data();
+        const VRasterStripWriter *encoder = writer.data();
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int top = (first + i) * stripHeight;
+            const int height = qMin(stripHeight, size.height() - top);
+            pool.start(new VFunctionTask([&RenderStrip, encoder, results, i, size, top, height]()
+            {
+                QImage strip(size.width(), height, QImage::Format_ARGB32);
+                if (not strip.isNull())
+                {
+                    RenderStrip(strip, top);
+                    results[i] = encoder->Encode(strip);
+                }
+            }));
+        }
+        pool.waitForDone();
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (encoded.at(i).isEmpty())
+            {
+                m_error = tr("Not enough memory to render the layout.");
+                return false;
+            }
+
+            if (not writer->WriteStrip(&file, encoded.at(i)))
+            {
+                m_error = tr("Can't write file %1: %2").arg(fileName, file.errorString());
+                return false;
+            }
+        }
+    }
+
+    if (not writer->Finish(&file) || not file.flush())
+    {
+        m_error = tr("Can't write file %1: %2").arg(fileName, file.errorString());
+        return false;
+    }
+    return true;
+}
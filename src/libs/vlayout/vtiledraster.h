@@ -0,0 +1,79 @@
+/***************************************************************************
+ **  @file   vtiledraster.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VTILEDRASTER_H
+#define VTILEDRASTER_H
+
+#include <QByteArray>
+#include <QColor>
+#include <QCoreApplication>
+#include <QFont>
+#include <QSize>
+#include <QString>
+#include <QtGlobal>
+#include <functional>
+
+class QGraphicsScene;
+class QPainter;
+
+/**
+ * @brief The VTiledRaster class renders a scene to a raster file in horizontal strips.
+ *
+ * The scene is recorded once and the strips are rendered in parallel. TIF, BMP and PPM files are written strip by
+ * strip, so the memory used does not depend on the size of the layout. PNG and JPG need the whole image for the
+ * encoder, their strips are rendered straight into it.
+ *
+ * Instead of a scene the content can come from a render function that paints an image of the given size.
+ */
+class VTiledRaster
+{
+    Q_DECLARE_TR_FUNCTIONS(VTiledRaster)
+public:
+    typedef std::function<void(QPainter *painter)> RenderFunction;
+
+    VTiledRaster(QGraphicsScene *scene, const QColor &background, const QFont &font);
+    VTiledRaster(const QSize &size, const RenderFunction &render, const QColor &background, const QFont &font);
+
+    void    SetQuality(int quality);
+    void    SetStripHeight(int rows);
+    void    SetThreadCount(int threads);
+
+    bool    Write(const QString &fileName, const QByteArray &format);
+    QString ErrorString() const;
+
+    static bool IsStreamed(const QByteArray &format);
+
+private:
+    Q_DISABLE_COPY(VTiledRaster)
+
+    QSize          m_size;
+    RenderFunction m_render;
+    QColor         m_background;
+    QFont          m_font;
+    int            m_quality;
+    int            m_stripHeight;
+    int            m_threadCount;
+    QString        m_error;
+};
+
+#endif // VTILEDRASTER_H
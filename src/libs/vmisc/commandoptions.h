@@ -106,9 +106,20 @@ extern const QString SINGLE_OPTION_GAPWIDTH;
 extern const QString LONG_OPTION_GROUPPING;
 extern const QString SINGLE_OPTION_GROUPPING;
 
+extern const QString LONG_OPTION_ATTEMPTS;
+extern const QString SINGLE_OPTION_ATTEMPTS;
+
+extern const QString LONG_OPTION_TIMELIMIT;
+
+extern const QString LONG_OPTION_ENGINE;
+
 extern const QString LONG_OPTION_TEST;
 extern const QString SINGLE_OPTION_TEST;
 
+extern const QString LONG_OPTION_BATCH;
+
+extern const QString LONG_OPTION_JOBS;
+
 extern const QString LONG_OPTION_GRADATIONSIZE;
 extern const QString SINGLE_OPTION_GRADATIONSIZE;
 
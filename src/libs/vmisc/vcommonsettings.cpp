@@ -54,6 +54,8 @@
 #include <QApplication>
 #include <QDate>
 #include <QDir>
+#include <QFileInfo>
+#include <QFileSystemWatcher>
 #include <QFont>
 #include <QLocale>
 #include <QMessageLogger>
@@ -317,8 +319,23 @@ QString PrepareStandardFiles(const QString &currentPath, const QString &standard
 //---------------------------------------------------------------------------------------------------------------------
 VCommonSettings::VCommonSettings(Format format, Scope scope, const QString &organization,
                             const QString &application, QObject *parent)
-    :QSettings(format, scope, organization, application, parent)
-{}
+    :QSettings(format, scope, organization, application, parent),
+      snapshot(),
+      watcher(new QFileSystemWatcher(this))
+{
+    WatchSettingsFile();
+    connect(watcher, &QFileSystemWatcher::fileChanged, this, &VCommonSettings::ReloadSnapshot);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VCommonSettings::VCommonSettings(const QString &fileName, Format format, QObject *parent)
+    :QSettings(fileName, format, parent),
+      snapshot(),
+      watcher(new QFileSystemWatcher(this))
+{
+    WatchSettingsFile();
+    connect(watcher, &QFileSystemWatcher::fileChanged, this, &VCommonSettings::ReloadSnapshot);
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::SharePath(const QString &shareItem)
@@ -460,71 +477,71 @@ QString VCommonSettings::GetDefPathLabelTemplate()
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetPathLabelTemplate() const
 {
-    return value(settingPathsLabelTemplate, GetDefPathLabelTemplate()).toString();
+    return cachedValue(settingPathsLabelTemplate, GetDefPathLabelTemplate()).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetPathLabelTemplate(const QString &text)
 {
-    setValue(settingPathsLabelTemplate, text);
+    setCachedValue(settingPathsLabelTemplate, text);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultPatternTemplate() const
 {
-    return value(settingDefaultPatternTemplate, GetPathLabelTemplate() + "default_pattern_label.xml").toString();
+    return cachedValue(settingDefaultPatternTemplate, GetPathLabelTemplate() + "default_pattern_label.xml").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultPatternTemplate(const QString &text)
 {
-    setValue(settingDefaultPatternTemplate, text);
+    setCachedValue(settingDefaultPatternTemplate, text);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultPieceTemplate() const
 {
-    return value(settingDefaultPieceTemplate, GetPathLabelTemplate() + "default_piece_label.xml").toString();
+    return cachedValue(settingDefaultPieceTemplate, GetPathLabelTemplate() + "default_piece_label.xml").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultPieceTemplate(const QString &value)
 {
-    setValue(settingDefaultPieceTemplate, value);
+    setCachedValue(settingDefaultPieceTemplate, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::GetOsSeparator() const
 {
-    return value(settingConfigurationOsSeparator, 1).toBool();
+    return cachedValue(settingConfigurationOsSeparator, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetOsSeparator(const bool &value)
 {
-    setValue(settingConfigurationOsSeparator, value);
+    setCachedValue(settingConfigurationOsSeparator, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::GetAutosaveState() const
 {
-    return value(settingConfigurationAutosaveState, 1).toBool();
+    return cachedValue(settingConfigurationAutosaveState, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetAutosaveState(const bool &value)
 {
-    setValue(settingConfigurationAutosaveState, value);
+    setCachedValue(settingConfigurationAutosaveState, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VCommonSettings::getAutosaveInterval() const
 {
     bool ok = false;
-    int val = value(settingConfigurationAutosaveTime, 1).toInt(&ok);
+    int val = cachedValue(settingConfigurationAutosaveTime, 1).toInt(&ok);
     if (ok == false)
     {
-        qDebug()<<"Could not convert value"<<value(settingConfigurationAutosaveTime, 1)
+        qDebug()<<"Could not convert value"<<cachedValue(settingConfigurationAutosaveTime, 1)
                <<"to int. Return default value for autosave time"<<1<<"minutes.";
         val = 1;
     }
@@ -534,536 +551,536 @@ int VCommonSettings::getAutosaveInterval() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setAutosaveInterval(const int &value)
 {
-    setValue(settingConfigurationAutosaveTime, value);
+    setCachedValue(settingConfigurationAutosaveTime, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::useModeType() const
 {
-    return value(settingConfigurationUseModeType, true).toBool();
+    return cachedValue(settingConfigurationUseModeType, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setUseModeType(const bool &value)
 {
-    setValue(settingConfigurationUseModeType, value);
+    setCachedValue(settingConfigurationUseModeType, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::useLastExportFormat() const
 {
-    return value(settingConfigurationUseLastExportFormat, true).toBool();
+    return cachedValue(settingConfigurationUseLastExportFormat, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setUseLastExportFormat(const bool &value)
 {
-    setValue(settingConfigurationUseLastExportFormat, value);
+    setCachedValue(settingConfigurationUseLastExportFormat, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getExportFormat() const
 {
-    return value(settingConfigurationExportFormat, "SVG").toString();
+    return cachedValue(settingConfigurationExportFormat, "SVG").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setExportFormat(const QString &value)
 {
-    setValue(settingConfigurationExportFormat, value);
+    setCachedValue(settingConfigurationExportFormat, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::GetSendReportState() const
 {
-    return value(settingConfigurationSendReportState, 1).toBool();
+    return cachedValue(settingConfigurationSendReportState, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetSendReportState(const bool &value)
 {
-    setValue(settingConfigurationSendReportState, value);
+    setCachedValue(settingConfigurationSendReportState, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetLocale() const
 {
-    return value(settingConfigurationLocale, QLocale().name()).toString();
+    return cachedValue(settingConfigurationLocale, QLocale().name()).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetLocale(const QString &value)
 {
-    setValue(settingConfigurationLocale, value);
+    setCachedValue(settingConfigurationLocale, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetPMSystemCode() const
 {
-    return value(settingPMSystemCode, "p998").toString();
+    return cachedValue(settingPMSystemCode, "p998").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetPMSystemCode(const QString &value)
 {
-    setValue(settingPMSystemCode, value);
+    setCachedValue(settingPMSystemCode, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetUnit() const
 {
-    return value(settingConfigurationUnit,
+    return cachedValue(settingConfigurationUnit,
                  QLocale().measurementSystem() == QLocale::MetricSystem ? unitCM : unitINCH).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetUnit(const QString &value)
 {
-    setValue(settingConfigurationUnit, value);
+    setCachedValue(settingConfigurationUnit, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getConfirmItemDelete() const
 {
-    return value(settingConfigurationConfirmItemDeletion, 1).toBool();
+    return cachedValue(settingConfigurationConfirmItemDeletion, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setConfirmItemDelete(const bool &value)
 {
-    setValue(settingConfigurationConfirmItemDeletion, value);
+    setCachedValue(settingConfigurationConfirmItemDeletion, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getConfirmFormatRewriting() const
 {
-    return value(settingConfigurationConfirmFormatRewriting, 1).toBool();
+    return cachedValue(settingConfigurationConfirmFormatRewriting, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setConfirmFormatRewriting(const bool &value)
 {
-    setValue(settingConfigurationConfirmFormatRewriting, value);
+    setCachedValue(settingConfigurationConfirmFormatRewriting, value);
 }
 
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getMoveSuffix() const
 {
-    return value(settingConfigurationMoveSuffix, "").toString();
+    return cachedValue(settingConfigurationMoveSuffix, "").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setMoveSuffix(const QString &value)
 {
-    setValue(settingConfigurationMoveSuffix, value);
+    setCachedValue(settingConfigurationMoveSuffix, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getRotateSuffix() const
 {
-    return value(settingConfigurationRotateSuffix, "").toString();
+    return cachedValue(settingConfigurationRotateSuffix, "").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setRotateSuffix(const QString &value)
 {
-    setValue(settingConfigurationRotateSuffix, value);
+    setCachedValue(settingConfigurationRotateSuffix, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getMirrorByAxisSuffix() const
 {
-    return value(settingConfigurationMirrorByAxisSuffix, "").toString();
+    return cachedValue(settingConfigurationMirrorByAxisSuffix, "").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setMirrorByAxisSuffix(const QString &value)
 {
-    setValue(settingConfigurationMirrorByAxisSuffix, value);
+    setCachedValue(settingConfigurationMirrorByAxisSuffix, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getMirrorByLineSuffix() const
 {
-    return value(settingConfigurationMirrorByLineSuffix, "").toString();
+    return cachedValue(settingConfigurationMirrorByLineSuffix, "").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setMirrorByLineSuffix(const QString &value)
 {
-    setValue(settingConfigurationMirrorByLineSuffix, value);
+    setCachedValue(settingConfigurationMirrorByLineSuffix, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getToolBarStyle() const
 {
-    return value(settingGraphicsViewToolBarStyle, true).toBool();
+    return cachedValue(settingGraphicsViewToolBarStyle, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setToolBarStyle(const bool &value)
 {
-    setValue(settingGraphicsViewToolBarStyle, value);
+    setCachedValue(settingGraphicsViewToolBarStyle, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowToolsToolBar() const
 {
-    return value(settingGraphicsViewShowToolsToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowToolsToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowToolsToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowToolsToolBar, value);
+    setCachedValue(settingGraphicsViewShowToolsToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowPointToolBar() const
 {
-    return value(settingGraphicsViewShowPointToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowPointToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowPointToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowPointToolBar, value);
+    setCachedValue(settingGraphicsViewShowPointToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowLineToolBar() const
 {
-    return value(settingGraphicsViewShowLineToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowLineToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowLineToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowLineToolBar, value);
+    setCachedValue(settingGraphicsViewShowLineToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowCurveToolBar() const
 {
-    return value(settingGraphicsViewShowCurveToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowCurveToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowCurveToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowCurveToolBar, value);
+    setCachedValue(settingGraphicsViewShowCurveToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowArcToolBar() const
 {
-    return value(settingGraphicsViewShowArcToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowArcToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowArcToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowArcToolBar, value);
+    setCachedValue(settingGraphicsViewShowArcToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowOpsToolBar() const
 {
-    return value(settingGraphicsViewShowOpsToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowOpsToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowOpsToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowOpsToolBar, value);
+    setCachedValue(settingGraphicsViewShowOpsToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowPieceToolBar() const
 {
-    return value(settingGraphicsViewShowPieceToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowPieceToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowPieceToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowPieceToolBar, value);
+    setCachedValue(settingGraphicsViewShowPieceToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowDetailsToolBar() const
 {
-    return value(settingGraphicsViewShowDetailsToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowDetailsToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowDetailsToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowDetailsToolBar, value);
+    setCachedValue(settingGraphicsViewShowDetailsToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowLayoutToolBar() const
 {
-    return value(settingGraphicsViewShowLayoutToolBar, false).toBool();
+    return cachedValue(settingGraphicsViewShowLayoutToolBar, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowLayoutToolBar(const bool &value)
 {
-    setValue(settingGraphicsViewShowLayoutToolBar, value);
+    setCachedValue(settingGraphicsViewShowLayoutToolBar, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool  VCommonSettings::getShowScrollBars() const
 {
-    return value(settingGraphicsViewShowScrollBars, 1).toBool();
+    return cachedValue(settingGraphicsViewShowScrollBars, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowScrollBars(const bool  &value)
 {
-    setValue(settingGraphicsViewShowScrollBars, value);
+    setCachedValue(settingGraphicsViewShowScrollBars, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int  VCommonSettings::getScrollBarWidth() const
 {
-    return value(settingGraphicsViewScrollBarWidth, 10).toInt();
+    return cachedValue(settingGraphicsViewScrollBarWidth, 10).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setScrollBarWidth(const int  &width)
 {
-    setValue(settingGraphicsViewScrollBarWidth, width);
+    setCachedValue(settingGraphicsViewScrollBarWidth, width);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VCommonSettings::getScrollDuration() const
 {
-    return value(settingGraphicsViewScrollDuration, 300).toInt();
+    return cachedValue(settingGraphicsViewScrollDuration, 300).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setScrollDuration(const int &duration)
 {
-    setValue(settingGraphicsViewScrollDuration, duration);
+    setCachedValue(settingGraphicsViewScrollDuration, duration);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VCommonSettings::getScrollUpdateInterval() const
 {
-    return value(settingGraphicsViewScrollUpdateInterval, 30).toInt();
+    return cachedValue(settingGraphicsViewScrollUpdateInterval, 30).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setScrollUpdateInterval(const int &interval)
 {
-    setValue(settingGraphicsViewScrollUpdateInterval, interval);
+    setCachedValue(settingGraphicsViewScrollUpdateInterval, interval);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VCommonSettings::getScrollSpeedFactor() const
 {
-    return value(settingGraphicsViewScrollSpeedFactor, 10).toInt();
+    return cachedValue(settingGraphicsViewScrollSpeedFactor, 10).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setScrollSpeedFactor(const int &factor)
 {
-    setValue(settingGraphicsViewScrollSpeedFactor, factor);
+    setCachedValue(settingGraphicsViewScrollSpeedFactor, factor);
 }
 
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getZoomModKey() const
 {
-    return value(settingGraphicsViewZoomModKey, true).toBool();
+    return cachedValue(settingGraphicsViewZoomModKey, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setZoomModKey(const bool &value)
 {
-    setValue(settingGraphicsViewZoomModKey, value);
+    setCachedValue(settingGraphicsViewZoomModKey, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::isZoomDoubleClick() const
 {
-    return value(settingGraphicsViewZoomDoubleClick, true).toBool();
+    return cachedValue(settingGraphicsViewZoomDoubleClick, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setZoomDoubleClick(const bool &value)
 {
-    setValue(settingGraphicsViewZoomDoubleClick, value);
+    setCachedValue(settingGraphicsViewZoomDoubleClick, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::isPanActiveSpaceKey() const
 {
-    return value(settingGraphicsViewPanActiveSpaceKey, false).toBool();
+    return cachedValue(settingGraphicsViewPanActiveSpaceKey, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPanActiveSpaceKey(const bool &value)
 {
-    setValue(settingGraphicsViewPanActiveSpaceKey, value);
+    setCachedValue(settingGraphicsViewPanActiveSpaceKey, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int  VCommonSettings::getZoomSpeedFactor() const
 {
-    return value(settingGraphicsViewZoomSpeedFactor, 16).toInt();
+    return cachedValue(settingGraphicsViewZoomSpeedFactor, 16).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setZoomSpeedFactor(const int  &value)
 {
-    setValue(settingGraphicsViewZoomSpeedFactor, value);
+    setCachedValue(settingGraphicsViewZoomSpeedFactor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int  VCommonSettings::getExportQuality() const
 {
-    return value(settingGraphicsViewExportQuality, 75).toInt();
+    return cachedValue(settingGraphicsViewExportQuality, 75).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setExportQuality(const int  &value)
 {
-    setValue(settingGraphicsViewExportQuality, value);
+    setCachedValue(settingGraphicsViewExportQuality, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getZoomRBPositiveColor() const
 {
-    return value(settingGraphicsViewZoomRBPositiveColor, "Blue").toString();
+    return cachedValue(settingGraphicsViewZoomRBPositiveColor, "Blue").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setZoomRBPositiveColor(const QString &value)
 {
-    setValue(settingGraphicsViewZoomRBPositiveColor, value);
+    setCachedValue(settingGraphicsViewZoomRBPositiveColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getZoomRBNegativeColor() const
 {
-    return value(settingGraphicsViewZoomRBNegativeColor, "Green").toString();
+    return cachedValue(settingGraphicsViewZoomRBNegativeColor, "Green").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setZoomRBNegativeColor(const QString &value)
 {
-    setValue(settingGraphicsViewZoomRBNegativeColor, value);
+    setCachedValue(settingGraphicsViewZoomRBNegativeColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPointNameColor() const
 {
-    return value(settingGraphicsViewPointNameColor, "Black").toString();
+    return cachedValue(settingGraphicsViewPointNameColor, "Black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameColor(const QString &value)
 {
-    setValue(settingGraphicsViewPointNameColor, value);
+    setCachedValue(settingGraphicsViewPointNameColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPointNameHoverColor() const
 {
-    return value(settingGraphicsViewPointNameHoverColor, "Magenta").toString();
+    return cachedValue(settingGraphicsViewPointNameHoverColor, "Magenta").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameHoverColor(const QString &value)
 {
-    setValue(settingGraphicsViewPointNameHoverColor, value);
+    setCachedValue(settingGraphicsViewPointNameHoverColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getAxisOrginColor() const
 {
-    return value(settingGraphicsViewAxisOrginColor, "Magenta").toString();
+    return cachedValue(settingGraphicsViewAxisOrginColor, "Magenta").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setAxisOrginColor(const QString &value)
 {
-    setValue(settingGraphicsViewAxisOrginColor, value);
+    setCachedValue(settingGraphicsViewAxisOrginColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getPrimarySupportColor() const
 {
-    return value(settingGraphicsViewPrimaryColor, "Magenta").toString();
+    return cachedValue(settingGraphicsViewPrimaryColor, "Magenta").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPrimarySupportColor(const QString &value)
 {
-    setValue(settingGraphicsViewPrimaryColor, value);
+    setCachedValue(settingGraphicsViewPrimaryColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getSecondarySupportColor() const
 {
-    return value(settingGraphicsViewSecondaryColor, "Forest Green").toString();
+    return cachedValue(settingGraphicsViewSecondaryColor, "Forest Green").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setSecondarySupportColor(const QString &value)
 {
-    setValue(settingGraphicsViewSecondaryColor, value);
+    setCachedValue(settingGraphicsViewSecondaryColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getTertiarySupportColor() const
 {
-    return value(settingGraphicsViewTertiaryColor, "Navy").toString();
+    return cachedValue(settingGraphicsViewTertiaryColor, "Navy").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setTertiarySupportColor(const QString &value)
 {
-    setValue(settingGraphicsViewTertiaryColor, value);
+    setCachedValue(settingGraphicsViewTertiaryColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getConstrainValue() const
 {
-    return value(settingGraphicsViewConstrainValue, 10.00).toReal();
+    return cachedValue(settingGraphicsViewConstrainValue, 10.00).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setConstrainValue(const qreal &value)
 {
-    setValue(settingGraphicsViewConstrainValue, value);
+    setCachedValue(settingGraphicsViewConstrainValue, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getConstrainModKey() const
 {
-    return value(settingGraphicsViewConstrainModKey, 1).toBool();
+    return cachedValue(settingGraphicsViewConstrainModKey, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setConstrainModKey(const bool &value)
 {
-    setValue(settingGraphicsViewConstrainModKey, value);
+    setCachedValue(settingGraphicsViewConstrainModKey, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VCommonSettings::GetUndoCount() const
 {
     bool ok = false;
-    int val = value(settingPatternUndo, 0).toInt(&ok);
+    int val = cachedValue(settingPatternUndo, 0).toInt(&ok);
     if (ok == false)
     {
-        qDebug()<<"Could not convert value"<<value(settingPatternUndo, 0)
+        qDebug()<<"Could not convert value"<<cachedValue(settingPatternUndo, 0)
                <<"to int. Return default value for undo counts 0 (no limit).";
         val = 0;
     }
@@ -1073,31 +1090,32 @@ int VCommonSettings::GetUndoCount() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetUndoCount(const int &value)
 {
-    setValue(settingPatternUndo, value);
+    setCachedValue(settingPatternUndo, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getSound() const
 {
-    return value(settingSelectionSound, "silent").toString();
+    return cachedValue(settingSelectionSound, "silent").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getSelectionSound() const
 {
-    return QStringLiteral("qrc:/sounds/") + value(settingSelectionSound, "silent").toString() + QStringLiteral(".wav");
+    return QStringLiteral("qrc:/sounds/") + cachedValue(settingSelectionSound, "silent").toString() +
+           QStringLiteral(".wav");
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setSelectionSound(const QString &value)
 {
-    setValue(settingSelectionSound, value);
+    setCachedValue(settingSelectionSound, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VCommonSettings::GetRecentFileList() const
 {
-    const QStringList files = value(settingGeneralRecentFileList).toStringList();
+    const QStringList files = cachedValue(settingGeneralRecentFileList).toStringList();
     QStringList cleared;
 
     for (int i = 0; i < files.size(); ++i)
@@ -1114,103 +1132,103 @@ QStringList VCommonSettings::GetRecentFileList() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetRecentFileList(const QStringList &value)
 {
-    setValue(settingGeneralRecentFileList, value);
+    setCachedValue(settingGeneralRecentFileList, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VCommonSettings::GetRestoreFileList() const
 {
-    return value(settingGeneralRestoreFileList).toStringList();
+    return cachedValue(settingGeneralRestoreFileList).toStringList();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetRestoreFileList(const QStringList &value)
 {
-    setValue(settingGeneralRestoreFileList, value);
+    setCachedValue(settingGeneralRestoreFileList, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QByteArray VCommonSettings::GetGeometry() const
 {
-    return value(settingGeneralGeometry).toByteArray();
+    return cachedValue(settingGeneralGeometry).toByteArray();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetGeometry(const QByteArray &value)
 {
-    setValue(settingGeneralGeometry, value);
+    setCachedValue(settingGeneralGeometry, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QByteArray VCommonSettings::GetWindowState() const
 {
-    return value(settingGeneralWindowState).toByteArray();
+    return cachedValue(settingGeneralWindowState).toByteArray();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetWindowState(const QByteArray &value)
 {
-    setValue(settingGeneralWindowState, value);
+    setCachedValue(settingGeneralWindowState, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QByteArray VCommonSettings::GetToolbarsState() const
 {
-    return value(settingGeneralToolbarsState).toByteArray();
+    return cachedValue(settingGeneralToolbarsState).toByteArray();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetToolbarsState(const QByteArray &value)
 {
-    setValue(settingGeneralToolbarsState, value);
+    setCachedValue(settingGeneralToolbarsState, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QSize VCommonSettings::getPreferenceDialogSize() const
 {
-    return value(settingPreferenceDialogSize, QSize(0, 0)).toSize();
+    return cachedValue(settingPreferenceDialogSize, QSize(0, 0)).toSize();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPreferenceDialogSize(const QSize& sz)
 {
-    setValue(settingPreferenceDialogSize, sz);
+    setCachedValue(settingPreferenceDialogSize, sz);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QSize VCommonSettings::getPatternPieceDialogSize() const
 {
-    return value(settingToolSeamAllowanceDialogSize, QSize(0, 0)).toSize();
+    return cachedValue(settingToolSeamAllowanceDialogSize, QSize(0, 0)).toSize();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPatternPieceDialogSize(const QSize &sz)
 {
-    setValue(settingToolSeamAllowanceDialogSize, sz);
+    setCachedValue(settingToolSeamAllowanceDialogSize, sz);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QSize VCommonSettings::GetFormulaWizardDialogSize() const
 {
-    return value(settingFormulaWizardDialogSize, QSize(0, 0)).toSize();
+    return cachedValue(settingFormulaWizardDialogSize, QSize(0, 0)).toSize();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetFormulaWizardDialogSize(const QSize &sz)
 {
-    setValue(settingFormulaWizardDialogSize, sz);
+    setCachedValue(settingFormulaWizardDialogSize, sz);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QSize VCommonSettings::GetIncrementsDialogSize() const
 {
-    return value(settingIncrementsDialogSize, QSize(0, 0)).toSize();
+    return cachedValue(settingIncrementsDialogSize, QSize(0, 0)).toSize();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetIncrementsDialogSize(const QSize &sz)
 {
-    setValue(settingIncrementsDialogSize, sz);
+    setCachedValue(settingIncrementsDialogSize, sz);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1246,97 +1264,98 @@ void VCommonSettings::SetDateOfLastRemind(const QDate &date)
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getForbidPieceFlipping() const
 {
-    return value(settingPatternForbidFlipping, false).toBool();
+    return cachedValue(settingPatternForbidFlipping, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setForbidPieceFlipping(bool value)
 {
-    setValue(settingPatternForbidFlipping, value);
+    setCachedValue(settingPatternForbidFlipping, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::isHideSeamLine() const
 {
-    return value(settingPatternHideSeamLine, false).toBool();
+    return cachedValue(settingPatternHideSeamLine, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setHideSeamLine(bool value)
 {
-    setValue(settingPatternHideSeamLine, value);
+    setCachedValue(settingPatternHideSeamLine, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showSeamlineNotch() const
 {
-    return value(settingSeamlineNotch, false).toBool();
+    return cachedValue(settingSeamlineNotch, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowSeamlineNotch(bool value)
 {
-    setValue(settingSeamlineNotch, value);
+    setCachedValue(settingSeamlineNotch, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showSeamAllowanceNotch() const
 {
-    return value(settingSeamAllowanceNotch, false).toBool();
+    return cachedValue(settingSeamAllowanceNotch, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowSeamAllowanceNotch(bool value)
 {
-    setValue(settingSeamAllowanceNotch, value);
+    setCachedValue(settingSeamAllowanceNotch, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultNotchLength() const
 {
-   return value(settingDefaultNotchLength, .250).toReal();
+   return cachedValue(settingDefaultNotchLength, .250).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultNotchLength(const qreal &value)
 {
-    setValue(settingDefaultNotchLength, value);
+    setCachedValue(settingDefaultNotchLength, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultNotchWidth() const
 {
-   return value(settingDefaultNotchWidth, .250).toReal();
+   return cachedValue(settingDefaultNotchWidth, .250).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultNotchWidth(const qreal &value)
 {
-    setValue(settingDefaultNotchWidth, value);
+    setCachedValue(settingDefaultNotchWidth, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultNotchType() const
 {
-   return value(settingDefaultNotchType, "Slit").toString();
+   return cachedValue(settingDefaultNotchType, "Slit").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultNotchType(const QString &value)
 {
-    setValue(settingDefaultNotchType, value);
+    setCachedValue(settingDefaultNotchType, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultNotchColor() const
 {
-   return value(settingDefaultNotchColor, "black").toString();
+   return cachedValue(settingDefaultNotchColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultNotchColor(const QString &value)
 {
-    setValue(settingDefaultNotchColor, value);
+    setCachedValue(settingDefaultNotchColor, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1427,7 +1446,7 @@ QChar VCommonSettings::GetDefCSVSeparator() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetDefaultSeamAllowance(double value)
 {
-    setValue(settingPatternDefaultSeamAllowance, UnitConvertor(value, StrToUnits(GetUnit()), Unit::Cm));
+    setCachedValue(settingPatternDefaultSeamAllowance, UnitConvertor(value, StrToUnits(GetUnit()), Unit::Cm));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1456,10 +1475,10 @@ double VCommonSettings::GetDefaultSeamAllowance()
     }
 
     bool ok = false;
-    double val = value(settingPatternDefaultSeamAllowance, -1).toDouble(&ok);
+    double val = cachedValue(settingPatternDefaultSeamAllowance, -1).toDouble(&ok);
     if (ok == false)
     {
-        qDebug()<< "Could not convert value"<<value(settingPatternDefaultSeamAllowance, 0)
+        qDebug()<< "Could not convert value"<<cachedValue(settingPatternDefaultSeamAllowance, 0)
                 << "to real. Return default value for default seam allowance is "
                 << defaultValue << ".";
         val = defaultValue;
@@ -1480,409 +1499,416 @@ double VCommonSettings::GetDefaultSeamAllowance()
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultSeamColor() const
 {
-   return value(settingDefaultSeamColor, "black").toString();
+   return cachedValue(settingDefaultSeamColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamColor(const QString &value)
 {
-    setValue(settingDefaultSeamColor, value);
+    setCachedValue(settingDefaultSeamColor, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultSeamLinetype() const
 {
-   return value(settingDefaultSeamLinetype, "solidLine").toString();
+   return cachedValue(settingDefaultSeamLinetype, "solidLine").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamLinetype(const QString &value)
 {
-    setValue(settingDefaultSeamLinetype, value);
+    setCachedValue(settingDefaultSeamLinetype, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultSeamLineweight() const
 {
-   return value(settingDefaultSeamLineweight, 1.20).toReal();
+   return cachedValue(settingDefaultSeamLineweight, 1.20).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamLineweight(const qreal &value)
 {
-    setValue(settingDefaultSeamLineweight, value);
+    setCachedValue(settingDefaultSeamLineweight, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutColor() const
 {
-   return value(settingDefaultCutColor, "black").toString();
+   return cachedValue(settingDefaultCutColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutColor(const QString &value)
 {
-    setValue(settingDefaultCutColor, value);
+    setCachedValue(settingDefaultCutColor, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutLinetype() const
 {
-   return value(settingDefaultCutLinetype, "solidLine").toString();
+   return cachedValue(settingDefaultCutLinetype, "solidLine").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutLinetype(const QString &value)
 {
-    setValue(settingDefaultCutLinetype, value);
+    setCachedValue(settingDefaultCutLinetype, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultCutLineweight() const
 {
-   return value(settingDefaultCutLineweight, 1.20).toReal();
+   return cachedValue(settingDefaultCutLineweight, 1.20).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutLineweight(const qreal &value)
 {
-    setValue(settingDefaultCutLineweight, value);
+    setCachedValue(settingDefaultCutLineweight, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultInternalColor() const
 {
-   return value(settingDefaultInternalColor, "black").toString();
+   return cachedValue(settingDefaultInternalColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalColor(const QString &value)
 {
-    setValue(settingDefaultInternalColor, value);
+    setCachedValue(settingDefaultInternalColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultInternalLinetype() const
 {
-   return value(settingDefaultInternalLinetype, "solidLine").toString();
+   return cachedValue(settingDefaultInternalLinetype, "solidLine").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalLinetype(const QString &value)
 {
-    setValue(settingDefaultInternalLinetype, value);
+    setCachedValue(settingDefaultInternalLinetype, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultInternalLineweight() const
 {
-   return value(settingDefaultInternalLineweight, 1.20).toReal();
+   return cachedValue(settingDefaultInternalLineweight, 1.20).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultInternalLineweight(const qreal &value)
 {
-    setValue(settingDefaultInternalLineweight, value);
+    setCachedValue(settingDefaultInternalLineweight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutoutColor() const
 {
-   return value(settingDefaultCutoutColor, "black").toString();
+   return cachedValue(settingDefaultCutoutColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutColor(const QString &value)
 {
-    setValue(settingDefaultCutoutColor, value);
+    setCachedValue(settingDefaultCutoutColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultCutoutLinetype() const
 {
-   return value(settingDefaultCutoutLinetype, "solidLine").toString();
+   return cachedValue(settingDefaultCutoutLinetype, "solidLine").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutLinetype(const QString &value)
 {
-    setValue(settingDefaultCutoutLinetype, value);
+    setCachedValue(settingDefaultCutoutLinetype, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultCutoutLineweight() const
 {
-   return value(settingDefaultCutoutLineweight, 1.20).toReal();
+   return cachedValue(settingDefaultCutoutLineweight, 1.20).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultCutoutLineweight(const qreal &value)
 {
-    setValue(settingDefaultCutoutLineweight, value);
+    setCachedValue(settingDefaultCutoutLineweight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showSeamAllowances() const
 {
-    return value(settingShowSeamAllowances, true).toBool();
+    return cachedValue(settingShowSeamAllowances, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowSeamAllowances(const bool &value)
 {
-    setValue(settingShowSeamAllowances, value);
+    setCachedValue(settingShowSeamAllowances, value);
+    emit styleChanged();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getDefaultSeamAllowanceVisibilty() const
 {
-    return value(settingDefaultSeamAllowanceVisibilty, true).toBool();
+    return cachedValue(settingDefaultSeamAllowanceVisibilty, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultSeamAllowanceVisibilty(const bool &value)
 {
-    setValue(settingDefaultSeamAllowanceVisibilty, value);
+    setCachedValue(settingDefaultSeamAllowanceVisibilty, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showGrainlines() const
 {
-    return value(settingShowGrainlines, true).toBool();
+    return cachedValue(settingShowGrainlines, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowGrainlines(const bool &value)
 {
-    setValue(settingShowGrainlines, value);
+    setCachedValue(settingShowGrainlines, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getDefaultGrainlineVisibilty() const
 {
-    return value(settingDefaultGrainlineVisibilty, true).toBool();
+    return cachedValue(settingDefaultGrainlineVisibilty, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultGrainlineVisibilty(const bool &value)
 {
-    setValue(settingDefaultGrainlineVisibilty, value);
+    setCachedValue(settingDefaultGrainlineVisibilty, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultGrainlineLength() const
 {
-   return value(settingDefaultGrainlineLength, 2).toReal();
+   return cachedValue(settingDefaultGrainlineLength, 2).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultGrainlineLength(const qreal &value)
 {
-    setValue(settingDefaultGrainlineLength, value);
+    setCachedValue(settingDefaultGrainlineLength, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultGrainlineColor() const
 {
-   return value(settingDefaultGrainlineColor, "black").toString();
+   return cachedValue(settingDefaultGrainlineColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultGrainlineColor(const QString &value)
 {
-    setValue(settingDefaultGrainlineColor, value);
+    setCachedValue(settingDefaultGrainlineColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultGrainlineLineweight() const
 {
-   return value(settingDefaultGrainlineLineweight, 0.25).toReal();
+   return cachedValue(settingDefaultGrainlineLineweight, 0.25).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultGrainlineLineweight(const qreal &value)
 {
-    setValue(settingDefaultGrainlineLineweight, value);
+    setCachedValue(settingDefaultGrainlineLineweight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showLabels() const
 {
-    return value(settingShowLabels, true).toBool();
+    return cachedValue(settingShowLabels, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowLabels(const bool &value)
 {
-    setValue(settingShowLabels, value);
+    setCachedValue(settingShowLabels, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showPatternLabels() const
 {
-    return value(settingShowPatternLabels, true).toBool();
+    return cachedValue(settingShowPatternLabels, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowPatternLabels(const bool &value)
 {
-    setValue(settingShowPatternLabels, value);
+    setCachedValue(settingShowPatternLabels, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::showPieceLabels() const
 {
-    return value(settingShowPieceLabels, true).toBool();
+    return cachedValue(settingShowPieceLabels, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowPieceLabels(const bool &value)
 {
-    setValue(settingShowPieceLabels, value);
+    setCachedValue(settingShowPieceLabels, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultLabelWidth() const
 {
-   return value(settingDefaultLabelWidth, 3).toReal();
+   return cachedValue(settingDefaultLabelWidth, 3).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLabelWidth(const qreal &value)
 {
-    setValue(settingDefaultLabelWidth, value);
+    setCachedValue(settingDefaultLabelWidth, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 qreal VCommonSettings::getDefaultLabelHeight() const
 {
-   return value(settingDefaultLabelHeight, 2).toReal();
+   return cachedValue(settingDefaultLabelHeight, 2).toReal();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLabelHeight(const qreal &value)
 {
-    setValue(settingDefaultLabelHeight, value);
+    setCachedValue(settingDefaultLabelHeight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::getDefaultLabelColor() const
 {
-   return value(settingDefaultLabelColor, "black").toString();
+   return cachedValue(settingDefaultLabelColor, "black").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setDefaultLabelColor(const QString &value)
 {
-    setValue(settingDefaultLabelColor, value);
+    setCachedValue(settingDefaultLabelColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QFont VCommonSettings::getLabelFont() const
 {
-    return qvariant_cast<QFont>(value(settingPatternLabelFont, QApplication::font()));
+    return qvariant_cast<QFont>(cachedValue(settingPatternLabelFont, QApplication::font()));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setLabelFont(const QFont &f)
 {
-    setValue(settingPatternLabelFont, f);
+    setCachedValue(settingPatternLabelFont, f);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QFont VCommonSettings::getGuiFont() const
 {
-    return qvariant_cast<QFont>(value(settingPatternGuiFont, QApplication::font()));
+    return qvariant_cast<QFont>(cachedValue(settingPatternGuiFont, QApplication::font()));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setGuiFont(const QFont &f)
 {
-    setValue(settingPatternGuiFont, f);
+    setCachedValue(settingPatternGuiFont, f);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QFont VCommonSettings::getPointNameFont() const
 {
-    return qvariant_cast<QFont>(value(settingPatternPointNameFont, QApplication::font()));
+    return qvariant_cast<QFont>(cachedValue(settingPatternPointNameFont, QApplication::font()));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameFont(const QFont &f)
 {
-    setValue(settingPatternPointNameFont, f);
+    setCachedValue(settingPatternPointNameFont, f);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getHidePointNames() const
 {
-    return value(settingGraphicsViewHidePointNames, true).toBool();
+    return cachedValue(settingGraphicsViewHidePointNames, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setHidePointNames(bool value)
 {
-    setValue(settingGraphicsViewHidePointNames, value);
+    setCachedValue(settingGraphicsViewHidePointNames, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowAxisOrigin() const
 {
-    return value(settingGraphicsViewShowAxisOrigin, true).toBool();
+    return cachedValue(settingGraphicsViewShowAxisOrigin, true).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowAxisOrigin(bool value)
 {
-    setValue(settingGraphicsViewShowAxisOrigin, value);
+    setCachedValue(settingGraphicsViewShowAxisOrigin, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::isWireframe() const
 {
-    return value(settingGraphicsViewWireframe, false).toBool();
+    return cachedValue(settingGraphicsViewWireframe, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setWireframe(bool value)
 {
-    setValue(settingGraphicsViewWireframe, value);
+    setCachedValue(settingGraphicsViewWireframe, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowControlPoints() const
 {
-    return value(settingGraphicsViewShowControlPoints, false).toBool();
+    return cachedValue(settingGraphicsViewShowControlPoints, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowControlPoints(bool value)
 {
-    setValue(settingGraphicsViewShowControlPoints, value);
+    setCachedValue(settingGraphicsViewShowControlPoints, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getShowAnchorPoints() const
 {
-    return value(settingGraphicsViewShowAnchorPoints, false).toBool();
+    return cachedValue(settingGraphicsViewShowAnchorPoints, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setShowAnchorPoints(bool value)
 {
-    setValue(settingGraphicsViewShowAnchorPoints, value);
+    setCachedValue(settingGraphicsViewShowAnchorPoints, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VCommonSettings::getUseToolColor() const
 {
-    return value(settingGraphicsUseToolColor, false).toBool();
+    return cachedValue(settingGraphicsUseToolColor, false).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setUseToolColor(bool value)
 {
-    setValue(settingGraphicsUseToolColor, value);
+    setCachedValue(settingGraphicsUseToolColor, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1891,7 +1917,7 @@ int VCommonSettings::getPointNameSize() const
     if (pointNameSize <= 0)
     {
         bool ok = false;
-        pointNameSize = value(settingGraphicsViewPointNameSize, 32).toInt(&ok);
+        pointNameSize = cachedValue(settingGraphicsViewPointNameSize, 32).toInt(&ok);
         if (not ok)
         {
             pointNameSize = 32;
@@ -1903,25 +1929,26 @@ int VCommonSettings::getPointNameSize() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setPointNameSize(int value)
 {
-    setValue(settingGraphicsViewPointNameSize, value);
+    setCachedValue(settingGraphicsViewPointNameSize, value);
     pointNameSize = value;
 }
 
 int VCommonSettings::getGuiFontSize() const
 {
-    return value(settingGraphicsViewGuiFontSize, 9).toInt();
+    return cachedValue(settingGraphicsViewGuiFontSize, 9).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::setGuiFontSize(int value)
 {
-    setValue(settingGraphicsViewGuiFontSize, value);
+    setCachedValue(settingGraphicsViewGuiFontSize, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetLabelDateFormat() const
 {
-    const QString format = value(settingLabelDateFormat, VCommonSettings::PredefinedDateFormats().first()).toString();
+    const QString format = cachedValue(settingLabelDateFormat,
+                                       VCommonSettings::PredefinedDateFormats().first()).toString();
     const QStringList allFormats = VCommonSettings::PredefinedDateFormats() + GetUserDefinedDateFormats();
 
     if (allFormats.contains(format))
@@ -1937,7 +1964,7 @@ QString VCommonSettings::GetLabelDateFormat() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetLabelDateFormat(const QString &format)
 {
-    setValue(settingLabelDateFormat, format);
+    setCachedValue(settingLabelDateFormat, format);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1969,19 +1996,20 @@ QStringList VCommonSettings::PredefinedDateFormats()
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VCommonSettings::GetUserDefinedDateFormats() const
 {
-    return value(settingLabelUserDateFormats, QStringList()).toStringList();
+    return cachedValue(settingLabelUserDateFormats, QStringList()).toStringList();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetUserDefinedDateFormats(const QStringList &formats)
 {
-    setValue(settingLabelUserDateFormats, ClearFormats(VCommonSettings::PredefinedDateFormats(), formats));
+    setCachedValue(settingLabelUserDateFormats, ClearFormats(VCommonSettings::PredefinedDateFormats(), formats));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VCommonSettings::GetLabelTimeFormat() const
 {
-    const QString format = value(settingLabelTimeFormat, VCommonSettings::PredefinedTimeFormats().first()).toString();
+    const QString format = cachedValue(settingLabelTimeFormat,
+                                       VCommonSettings::PredefinedTimeFormats().first()).toString();
     const QStringList allFormats = VCommonSettings::PredefinedTimeFormats() + GetUserDefinedTimeFormats();
 
     if (allFormats.contains(format))
@@ -1997,7 +2025,7 @@ QString VCommonSettings::GetLabelTimeFormat() const
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetLabelTimeFormat(const QString &format)
 {
-    setValue(settingLabelTimeFormat, format);
+    setCachedValue(settingLabelTimeFormat, format);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -2013,11 +2041,99 @@ QStringList VCommonSettings::PredefinedTimeFormats()
 //---------------------------------------------------------------------------------------------------------------------
 QStringList VCommonSettings::GetUserDefinedTimeFormats() const
 {
-    return value(settingLabelUserTimeFormats, QStringList()).toStringList();
+    return cachedValue(settingLabelUserTimeFormats, QStringList()).toStringList();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VCommonSettings::SetUserDefinedTimeFormats(const QStringList &formats)
 {
-    setValue(settingLabelUserTimeFormats, ClearFormats(VCommonSettings::PredefinedTimeFormats(), formats));
+    setCachedValue(settingLabelUserTimeFormats, ClearFormats(VCommonSettings::PredefinedTimeFormats(), formats));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReloadSnapshot load values from the backend again.
+ *
+ * Called by the watcher when the settings file was changed behind our back, for example by another instance.
+ * Our own writes also touch the file, but they are in the snapshot already, so styleChanged is emitted only
+ * if the reload brought a different value.
+ */
+void VCommonSettings::ReloadSnapshot()
+{
+    sync();
+    WatchSettingsFile(); // QSettings replaces the file on save, that drops it from the watcher
+
+    const std::shared_ptr<const Snapshot> previous = std::atomic_load(&snapshot);
+    std::atomic_store(&snapshot, std::shared_ptr<const Snapshot>());
+
+    if (not previous or *GetSnapshot() != *previous)
+    {
+        emit styleChanged();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief cachedValue return value for the key from the snapshot.
+ *
+ * The snapshot contains every key stored in the backend, so a missing key means the default value.
+ * @param key setting key.
+ * @param defaultValue value returned if the setting doesn't exist.
+ * @return value.
+ */
+QVariant VCommonSettings::cachedValue(const QString &key, const QVariant &defaultValue) const
+{
+    return GetSnapshot()->value(key, defaultValue);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief setCachedValue write value to the backend and to the snapshot.
+ * @param key setting key.
+ * @param value new value.
+ */
+void VCommonSettings::setCachedValue(const QString &key, const QVariant &value)
+{
+    QSettings::setValue(key, value);
+
+    const std::shared_ptr<const Snapshot> current = std::atomic_load(&snapshot);
+    if (current)
+    {
+        // Readers may hold the old copy, publish a new one instead of changing it in place.
+        std::shared_ptr<Snapshot> updated = std::make_shared<Snapshot>(*current);
+        updated->insert(key, value);
+        std::atomic_store(&snapshot, std::shared_ptr<const Snapshot>(updated));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+std::shared_ptr<const VCommonSettings::Snapshot> VCommonSettings::GetSnapshot() const
+{
+    std::shared_ptr<const Snapshot> current = std::atomic_load(&snapshot);
+    if (current)
+    {
+        return current;
+    }
+
+    // Built on first use, not in the constructor, subclasses register metatypes of their values first.
+    std::shared_ptr<Snapshot> loaded = std::make_shared<Snapshot>();
+    const QStringList keys = allKeys();
+    for (int i = 0; i < keys.size(); ++i)
+    {
+        loaded->insert(keys.at(i), QSettings::value(keys.at(i)));
+    }
+
+    current = loaded;
+    std::atomic_store(&snapshot, current);
+    return current;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VCommonSettings::WatchSettingsFile()
+{
+    const QString file = fileName();
+    if (not watcher->files().contains(file) and QFileInfo::exists(file))
+    {
+        watcher->addPath(file);
+    }
 }
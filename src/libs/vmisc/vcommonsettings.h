@@ -59,16 +59,22 @@
 #include <QSize>
 #include <QString>
 #include <QStringList>
+#include <QHash>
+#include <QVariant>
 #include <QtGlobal>
+#include <memory>
 
 #include "../vlayout/vbank.h"
 
+class QFileSystemWatcher;
+
 class VCommonSettings : public QSettings
 {
     Q_OBJECT
 public:
                          VCommonSettings(Format format, Scope scope, const QString &organization,
                                          const QString &application = QString(), QObject *parent = nullptr);
+                         VCommonSettings(const QString &fileName, Format format, QObject *parent = nullptr);
 
     static QString       SharePath(const QString &shareItem);
     static QString       MultisizeTablesPath();
@@ -442,8 +448,30 @@ class VCommonSettings : public QSettings
     QStringList          GetUserDefinedTimeFormats() const;
     void                 SetUserDefinedTimeFormats(const QStringList &formats);
 
+public slots:
+    void                 ReloadSnapshot();
+
+signals:
+    /** @brief styleChanged emitted when a setting that defines how pieces are drawn was changed. */
+    void                 styleChanged();
+
+protected:
+    QVariant             cachedValue(const QString &key, const QVariant &defaultValue = QVariant()) const;
+    void                 setCachedValue(const QString &key, const QVariant &value);
+
 private:
     Q_DISABLE_COPY(VCommonSettings)
+
+    typedef QHash<QString, QVariant> Snapshot;
+
+    /** @brief snapshot copy of all stored values. Getters read it without touching the settings backend. */
+    mutable std::shared_ptr<const Snapshot> snapshot;
+
+    /** @brief watcher reloads the snapshot when another instance changes the settings file. */
+    QFileSystemWatcher  *watcher;
+
+    std::shared_ptr<const Snapshot> GetSnapshot() const;
+    void                 WatchSettingsFile();
 };
 
 #endif // VCOMMONSETTINGS_H
@@ -0,0 +1,54 @@
+/***************************************************************************
+ **  @file   vfunctiontask.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VFUNCTIONTASK_H
+#define VFUNCTIONTASK_H
+
+#include <QRunnable>
+#include <QtGlobal>
+#include <functional>
+
+/**
+ * @brief The VFunctionTask class runs a function on a thread pool. The pool deletes the task when it is done.
+ */
+class VFunctionTask : public QRunnable
+{
+public:
+    explicit VFunctionTask(const std::function<void()> &task)
+        : QRunnable(),
+          task(task)
+    {
+        setAutoDelete(true);
+    }
+
+    virtual void run() Q_DECL_OVERRIDE
+    {
+        task();
+    }
+
+private:
+    Q_DISABLE_COPY(VFunctionTask)
+    std::function<void()> task;
+};
+
+#endif // VFUNCTIONTASK_H
@@ -27,6 +27,7 @@ HEADERS += \
     $$PWD/vseamlymesettings.h \
     $$PWD/debugbreak.h \
     $$PWD/vlockguard.h \
+    $$PWD/vfunctiontask.h \
     $$PWD/vsysexits.h \
     $$PWD/commandoptions.h \
     $$PWD/qxtcsvmodel.h \
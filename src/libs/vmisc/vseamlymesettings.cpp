@@ -71,35 +71,35 @@ VSeamlyMeSettings::VSeamlyMeSettings(Format format, Scope scope, const QString &
 //---------------------------------------------------------------------------------------------------------------------
 QByteArray VSeamlyMeSettings::getDataBaseGeometry() const
 {
-    return value(settingDataBaseGeometry).toByteArray();
+    return cachedValue(settingDataBaseGeometry).toByteArray();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSeamlyMeSettings::setDataBaseGeometry(const QByteArray &value)
 {
-    setValue(settingDataBaseGeometry, value);
+    setCachedValue(settingDataBaseGeometry, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSeamlyMeSettings::SetDefHeight(int value)
 {
-    setValue(settingDefHeight, value);
+    setCachedValue(settingDefHeight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VSeamlyMeSettings::GetDefHeight() const
 {
-    return value(settingDefHeight, 176).toInt();
+    return cachedValue(settingDefHeight, 176).toInt();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSeamlyMeSettings::SetDefSize(int value)
 {
-    setValue(settingDefSize, value);
+    setCachedValue(settingDefSize, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 int VSeamlyMeSettings::GetDefSize() const
 {
-    return value(settingDefSize, 50).toInt();
+    return cachedValue(settingDefSize, 50).toInt();
 }
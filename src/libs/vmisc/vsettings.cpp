@@ -121,13 +121,13 @@ VSettings::VSettings(Format format, Scope scope, const QString &organization, co
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetLabelLanguage() const
 {
-    return value(settingConfigurationLabelLanguage, QLocale().bcp47Name()).toString();
+    return cachedValue(settingConfigurationLabelLanguage, QLocale().bcp47Name()).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLabelLanguage(const QString &value)
 {
-    setValue(settingConfigurationLabelLanguage, value);
+    setCachedValue(settingConfigurationLabelLanguage, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -175,133 +175,133 @@ void VSettings::SetPathLayout(const QString &value)
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetGraphicalOutput() const
 {
-    return value(settingPatternGraphicalOutput, 1).toBool();
+    return cachedValue(settingPatternGraphicalOutput, 1).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetGraphicalOutput(const bool &value)
 {
-    setValue(settingPatternGraphicalOutput, value);
+    setCachedValue(settingPatternGraphicalOutput, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetServer() const
 {
-    return value(settingCommunityServer, "community.seamly2d-project.org").toString();
+    return cachedValue(settingCommunityServer, "community.seamly2d-project.org").toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetServer(const QString &value)
 {
-    setValue(settingCommunityServer, value);
+    setCachedValue(settingCommunityServer, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetServerSecure() const
 {
-    return value(settingCommunityServerSecure, 0).toBool();
+    return cachedValue(settingCommunityServerSecure, 0).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetServerSecure(const bool &value)
 {
-    setValue(settingCommunityServerSecure, value);
+    setCachedValue(settingCommunityServerSecure, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetProxy() const
 {
-    return value(settingCommunityUseProxy, 0).toBool();
+    return cachedValue(settingCommunityUseProxy, 0).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetProxy(const bool &value)
 {
-    setValue(settingCommunityUseProxy, value);
+    setCachedValue(settingCommunityUseProxy, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetProxyAddress() const
 {
-    return value(settingCommunityProxyAddress).toString();
+    return cachedValue(settingCommunityProxyAddress).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetProxyAddress(const QString &value)
 {
-    setValue(settingCommunityProxyAddress, value);
+    setCachedValue(settingCommunityProxyAddress, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetProxyPort() const
 {
-    return value(settingCommunityProxyPort).toString();
+    return cachedValue(settingCommunityProxyPort).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetProxyPort(const QString &value)
 {
-    setValue(settingCommunityProxyPort, value);
+    setCachedValue(settingCommunityProxyPort, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetProxyUser() const
 {
-    return value(settingCommunityProxyUser).toString();
+    return cachedValue(settingCommunityProxyUser).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetProxyUser(const QString &value)
 {
-    setValue(settingCommunityProxyUser, value);
+    setCachedValue(settingCommunityProxyUser, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetProxyPass() const
 {
-    return value(settingCommunityProxyPass).toString();
+    return cachedValue(settingCommunityProxyPass).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetProxyPass(const QString &value)
 {
-    setValue(settingCommunityProxyPass, value);
+    setCachedValue(settingCommunityProxyPass, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetUsername() const
 {
-    return value(settingCommunityUsername).toString();
+    return cachedValue(settingCommunityUsername).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetUsername(const QString &value)
 {
-    setValue(settingCommunityUsername, value);
+    setCachedValue(settingCommunityUsername, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetSavePassword() const
 {
-    return value(settingCommunitySavePassword, 0).toBool();
+    return cachedValue(settingCommunitySavePassword, 0).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetSavePassword(const bool &value)
 {
-    setValue(settingCommunitySavePassword, value);
+    setCachedValue(settingCommunitySavePassword, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QString VSettings::GetUserPassword() const
 {
-    return value(settingCommunityUserPassword).toString();
+    return cachedValue(settingCommunityUserPassword).toString();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetUserPassword(const QString &value)
 {
-    setValue(settingCommunityUserPassword, value);
+    setCachedValue(settingCommunityUserPassword, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -309,7 +309,7 @@ qreal VSettings::GetLayoutPaperHeight() const
 {
     const qreal def = UnitConvertor(1189/*A0*/, Unit::Mm, Unit::Px);
     bool ok = false;
-    const qreal height = value(settingLayoutPaperHeight, def).toDouble(&ok);
+    const qreal height = cachedValue(settingLayoutPaperHeight, def).toDouble(&ok);
     if (ok)
     {
         return height;
@@ -323,7 +323,7 @@ qreal VSettings::GetLayoutPaperHeight() const
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutPaperHeight(qreal value)
 {
-    setValue(settingLayoutPaperHeight, value);
+    setCachedValue(settingLayoutPaperHeight, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -331,7 +331,7 @@ qreal VSettings::GetLayoutPaperWidth() const
 {
     const qreal def = UnitConvertor(841/*A0*/, Unit::Mm, Unit::Px);
     bool ok = false;
-    const qreal width = value(settingLayoutPaperWidth, def).toDouble(&ok);
+    const qreal width = cachedValue(settingLayoutPaperWidth, def).toDouble(&ok);
     if (ok)
     {
         return width;
@@ -345,7 +345,7 @@ qreal VSettings::GetLayoutPaperWidth() const
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutPaperWidth(qreal value)
 {
-    setValue(settingLayoutPaperWidth, value);
+    setCachedValue(settingLayoutPaperWidth, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -353,7 +353,7 @@ qreal VSettings::GetLayoutShift() const
 {
     const qreal def = GetDefLayoutShift();
     bool ok = false;
-    const qreal shift = value(settingLayoutShift, def).toDouble(&ok);
+    const qreal shift = cachedValue(settingLayoutShift, def).toDouble(&ok);
     if (ok)
     {
         return shift;
@@ -373,7 +373,7 @@ qreal VSettings::GetDefLayoutShift()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutShift(qreal value)
 {
-    setValue(settingLayoutShift, value);
+    setCachedValue(settingLayoutShift, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -381,7 +381,7 @@ qreal VSettings::GetLayoutWidth() const
 {
     const qreal def = GetDefLayoutWidth();
     bool ok = false;
-    const qreal lWidth = value(settingLayoutWidth, def).toDouble(&ok);
+    const qreal lWidth = cachedValue(settingLayoutWidth, def).toDouble(&ok);
     if (ok)
     {
         return lWidth;
@@ -401,13 +401,13 @@ qreal VSettings::GetDefLayoutWidth()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutWidth(qreal value)
 {
-    setValue(settingLayoutWidth, value);
+    setCachedValue(settingLayoutWidth, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 QMarginsF VSettings::GetFields(const QMarginsF &def) const
 {
-    const QVariant val = value(settingFields, QVariant::fromValue(def));
+    const QVariant val = cachedValue(settingFields, QVariant::fromValue(def));
     if (val.canConvert<QMarginsF>())
     {
         return val.value<QMarginsF>();
@@ -418,7 +418,7 @@ QMarginsF VSettings::GetFields(const QMarginsF &def) const
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetFields(const QMarginsF &value)
 {
-    setValue(settingFields, QVariant::fromValue(value));
+    setCachedValue(settingFields, QVariant::fromValue(value));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -426,7 +426,7 @@ Cases VSettings::GetLayoutGroup() const
 {
     const Cases def = GetDefLayoutGroup();
     bool ok = false;
-    const int g = value(settingLayoutSorting, static_cast<int>(def)).toInt(&ok);
+    const int g = cachedValue(settingLayoutSorting, static_cast<int>(def)).toInt(&ok);
     if (ok)
     {
         if (g >= static_cast<int>(Cases::UnknownCase))
@@ -453,13 +453,13 @@ Cases VSettings::GetDefLayoutGroup()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutGroup(const Cases &value)
 {
-    setValue(settingLayoutSorting, static_cast<int>(value));
+    setCachedValue(settingLayoutSorting, static_cast<int>(value));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetLayoutRotate() const
 {
-    return value(settingLayoutRotate, GetDefLayoutRotate()).toBool();
+    return cachedValue(settingLayoutRotate, GetDefLayoutRotate()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -471,7 +471,7 @@ bool VSettings::GetDefLayoutRotate()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutRotate(bool value)
 {
-    setValue(settingLayoutRotate, value);
+    setCachedValue(settingLayoutRotate, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -479,7 +479,7 @@ int VSettings::GetLayoutRotationIncrease() const
 {
     const int def = GetDefLayoutRotationIncrease();
     bool ok = false;
-    const int r = value(settingLayoutRotationIncrease, def).toInt(&ok);
+    const int r = cachedValue(settingLayoutRotationIncrease, def).toInt(&ok);
     if (ok)
     {
         if (not (r >= 1 && r <= 180 && 360 % r == 0))
@@ -506,13 +506,13 @@ int VSettings::GetDefLayoutRotationIncrease()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutRotationIncrease(int value)
 {
-    setValue(settingLayoutRotationIncrease, value);
+    setCachedValue(settingLayoutRotationIncrease, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetLayoutAutoCrop() const
 {
-    return value(settingLayoutAutoCrop, GetDefLayoutAutoCrop()).toBool();
+    return cachedValue(settingLayoutAutoCrop, GetDefLayoutAutoCrop()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -524,13 +524,13 @@ bool VSettings::GetDefLayoutAutoCrop()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutAutoCrop(bool value)
 {
-    setValue(settingLayoutAutoCrop, value);
+    setCachedValue(settingLayoutAutoCrop, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetLayoutSaveLength() const
 {
-    return value(settingLayoutSaveLength, GetDefLayoutSaveLength()).toBool();
+    return cachedValue(settingLayoutSaveLength, GetDefLayoutSaveLength()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -542,13 +542,13 @@ bool VSettings::GetDefLayoutSaveLength()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutSaveLength(bool value)
 {
-    setValue(settingLayoutSaveLength, value);
+    setCachedValue(settingLayoutSaveLength, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetLayoutUnitePages() const
 {
-    return value(settingLayoutUnitePages, GetDefLayoutUnitePages()).toBool();
+    return cachedValue(settingLayoutUnitePages, GetDefLayoutUnitePages()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -560,13 +560,13 @@ bool VSettings::GetDefLayoutUnitePages()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetLayoutUnitePages(bool value)
 {
-    setValue(settingLayoutUnitePages, value);
+    setCachedValue(settingLayoutUnitePages, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetIgnoreAllFields() const
 {
-    return value(settingIgnoreFields, GetDefIgnoreAllFields()).toBool();
+    return cachedValue(settingIgnoreFields, GetDefIgnoreAllFields()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -578,13 +578,13 @@ bool VSettings::GetDefIgnoreAllFields()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetIgnoreAllFields(bool value)
 {
-    setValue(settingIgnoreFields, value);
+    setCachedValue(settingIgnoreFields, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetStripOptimization() const
 {
-    return value(settingStripOptimization, GetDefStripOptimization()).toBool();
+    return cachedValue(settingStripOptimization, GetDefStripOptimization()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -596,13 +596,13 @@ bool VSettings::GetDefStripOptimization()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetStripOptimization(bool value)
 {
-    setValue(settingStripOptimization, value);
+    setCachedValue(settingStripOptimization, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 quint8 VSettings::GetMultiplier() const
 {
-    return static_cast<quint8>(value(settingMultiplier, GetDefMultiplier()).toUInt());
+    return static_cast<quint8>(cachedValue(settingMultiplier, GetDefMultiplier()).toUInt());
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -614,13 +614,13 @@ quint8 VSettings::GetDefMultiplier()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::SetMultiplier(quint8 value)
 {
-    setValue(settingMultiplier, value);
+    setCachedValue(settingMultiplier, value);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
 bool VSettings::GetTextAsPaths() const
 {
-    return value(settingTextAsPaths, GetDefTextAsPaths()).toBool();
+    return cachedValue(settingTextAsPaths, GetDefTextAsPaths()).toBool();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -632,7 +632,7 @@ bool VSettings::GetDefTextAsPaths()
 //---------------------------------------------------------------------------------------------------------------------
 void VSettings::setTextAsPaths(bool value)
 {
-    setValue(settingTextAsPaths, value);
+    setCachedValue(settingTextAsPaths, value);
 }
 
 // settings for the tiled PDFs
@@ -648,7 +648,7 @@ QMarginsF VSettings::GetTiledPDFMargins(const Unit &unit) const
     // default value is 10mm. We save the margins in mm in the setting.
     const QMarginsF def = QMarginsF(10,10,10,10);
 
-    const QVariant val = value(settingTiledPDFMargins, QVariant::fromValue(def));
+    const QVariant val = cachedValue(settingTiledPDFMargins, QVariant::fromValue(def));
 
     if (val.canConvert<QMarginsF>())
     {
@@ -668,7 +668,7 @@ void VSettings::setTiledPDFMargins(const QMarginsF &value, const Unit &unit)
 {
     QMarginsF margins = UnitConvertor(value, unit, Unit::Mm);
 
-    setValue(settingTiledPDFMargins, QVariant::fromValue(margins));
+    setCachedValue(settingTiledPDFMargins, QVariant::fromValue(margins));
 }
 
 
@@ -682,7 +682,7 @@ qreal VSettings::getTiledPDFPaperHeight(const Unit &unit) const
 {
     const qreal def = 297 /*A4*/;
     bool ok = false;
-    const qreal height = value(settingTiledPDFPaperHeight, def).toDouble(&ok);
+    const qreal height = cachedValue(settingTiledPDFPaperHeight, def).toDouble(&ok);
     if (ok)
     {
         return UnitConvertor(height, Unit::Mm, unit);
@@ -701,7 +701,7 @@ qreal VSettings::getTiledPDFPaperHeight(const Unit &unit) const
  */
 void VSettings::setTiledPDFPaperHeight(qreal value, const Unit &unit)
 {
-    setValue(settingTiledPDFPaperHeight, UnitConvertor(value, unit, Unit::Mm));
+    setCachedValue(settingTiledPDFPaperHeight, UnitConvertor(value, unit, Unit::Mm));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -715,7 +715,7 @@ qreal VSettings::getTiledPDFPaperWidth(const Unit &unit) const
 
     const qreal def = 210 /*A4*/;
     bool ok = false;
-    const qreal width = value(settingTiledPDFPaperWidth, def).toDouble(&ok);
+    const qreal width = cachedValue(settingTiledPDFPaperWidth, def).toDouble(&ok);
 
     if (ok)
     {
@@ -735,7 +735,7 @@ qreal VSettings::getTiledPDFPaperWidth(const Unit &unit) const
  */
 void VSettings::setTiledPDFPaperWidth(qreal value, const Unit &unit)
 {
-    setValue(settingTiledPDFPaperWidth, UnitConvertor(value,unit, Unit::Mm));
+    setCachedValue(settingTiledPDFPaperWidth, UnitConvertor(value,unit, Unit::Mm));
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -743,7 +743,7 @@ PageOrientation VSettings::getTiledPDFOrientation() const
 {
     bool defaultValue = static_cast<bool>(PageOrientation::Portrait);
 
-    bool result = value(settingTiledPDFOrientation, defaultValue).toBool();
+    bool result = cachedValue(settingTiledPDFOrientation, defaultValue).toBool();
 
     return static_cast<PageOrientation>(result);
 }
@@ -753,5 +753,5 @@ void VSettings::setTiledPDFOrientation(PageOrientation value)
 {
     bool orientation = static_cast<bool> (value);
 
-    setValue(settingTiledPDFOrientation, orientation);
+    setCachedValue(settingTiledPDFOrientation, orientation);
 }
@@ -59,7 +59,10 @@
 #include <QMessageLogger>
 #include <QPaintEngineState>
 #include <QPainterPath>
+#include <QPair>
 #include <QPointF>
+#include <QRectF>
+#include <QSet>
 #include <QString>
 #include <QTextStream>
 #include <QVector>
@@ -108,11 +111,6 @@ VObjEngine::VObjEngine()
     , resolution(96)
     , transform()
 {
-    for (int i=0; i < MAX_POINTS; i++)
-    {
-        points[i].x = 0;
-        points[i].y = 0;
-    }
 }
 
 #if defined(Q_CC_INTEL)
@@ -194,64 +192,25 @@ void VObjEngine::drawPath(const QPainterPath &path)
         return;
     }
 
-    qint64 sq = Square(polygon);
+    const QVector<int> triangles = Triangulate(polygon);
+    if (triangles.isEmpty())
+    {
+        return;
+    }
 
     ++planeCount;
 	*stream << "o Plane." << QString("%1").arg(planeCount, 3, 10, QLatin1Char('0')) << '\n';
 
-    quint32 num_points = 0;
+    // Every vertex is written once, faces reference them by index.
+    drawPoints(polygon.constData(), polygon.size());
+    const int first = static_cast<int>(globalPointsCount) - polygon.size() + 1;
 
-    for (int i=0; i < polygon.count(); i++)
+    for (int i = 0; i < triangles.size(); i += 3)
     {
-        if ( num_points < MAX_POINTS )
-        {
-            points[num_points].x = polygon.at(i).x();
-            points[num_points].y = polygon.at(i).y();
-            num_points++;
-        }
+        *stream << "f " << first + triangles.at(i) << ' ' << first + triangles.at(i+1) << ' '
+                << first + triangles.at(i+2) << '\n';
     }
 
-    int offset = 0;
-    delaunay2d_t *res = delaunay2d_from(points, num_points);//Calculate faces
-
-    QPointF pf[MAX_POINTS];
-    bool skipFace=false;//Need skip first face
-
-    for (quint32 i = 0; i < res->num_faces; i++ )
-    {
-        if (offset == 0)
-        {
-            skipFace=true;
-        }
-        else
-        {
-            skipFace=false;
-        }
-        int num_verts = static_cast<int>(res->faces[offset]);
-        offset++;
-        for ( int j = 0; j < num_verts; j++ )
-        {
-            int p0 = static_cast<int>(res->faces[offset + j]);
-            pf[j] = QPointF(points[p0].x, points[p0].y);
-        }
-        if (skipFace == false )
-        {
-            QPolygonF face;
-            for ( int i = 0; i < num_verts; i++ )
-            {
-                face << QPointF(pf[i]);
-            }
-            QPolygonF united = polygon.united(face);
-            qint64 sqUnited = Square(united);
-            if (sqUnited <= sq)
-            {// This face incide our base polygon.
-                drawPolygon(pf, num_verts, QPaintEngine::OddEvenMode);
-            }
-        }
-        offset += num_verts;
-    }
-
-    delaunay2d_release(res);//Don't forget release data
 	*stream << "s off\n";
 }
 
@@ -353,57 +312,138 @@ void VObjEngine::setResolution(int value)
 //---------------------------------------------------------------------------------------------------------------------
 QPolygonF VObjEngine::MakePointsUnique(const QPolygonF &polygon) const
 {
-    QVector<QPointF> set;
+    QSet<QPair<qreal, qreal>> set;
+    set.reserve(polygon.size());
     QPolygonF uniquePolygon;
+    uniquePolygon.reserve(polygon.size());
     for (int i=0; i < polygon.count(); i++)
     {
-        if (set.contains(polygon.at(i)) == false)
+        const QPointF &p = polygon.at(i);
+        if (set.contains(qMakePair(p.x(), p.y())) == false)
         {
-            set.append(polygon.at(i));
-            uniquePolygon.append(polygon.at(i));
+            set.insert(qMakePair(p.x(), p.y()));
+            uniquePolygon.append(p);
         }
     }
     return uniquePolygon;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-qint64 VObjEngine::Square(const QPolygonF &poly) const
+/**
+ * @brief Triangulate splits a simple polygon into triangles by ear clipping.
+ *
+ * Only reflex vertices can lie inside a candidate ear, so only they are tested. Collinear vertices are dropped
+ * without a face. If the polygon self-intersects and no ear can be found the current vertex is clipped anyway, so the
+ * method always terminates with n - 2 or fewer triangles and never fails.
+ * @param polygon polygon without duplicate points.
+ * @return indexes into polygon, three per triangle, wound like the polygon.
+ */
+QVector<int> VObjEngine::Triangulate(const QPolygonF &polygon)
 {
-    QVector<qreal> x;
-    QVector<qreal> y;
+    QVector<int> triangles;
+    const int n = polygon.size();
+    if (n < 3)
+    {
+        return triangles;
+    }
+    triangles.reserve((n - 2) * 3);
 
-    int n = poly.count();
-    qreal s, res = 0;
-    qint64 sq = 0;
+    qreal area = 0;
+    for (int i = 0, j = n - 1; i < n; j = i++)
+    {
+        area += polygon.at(j).x() * polygon.at(i).y() - polygon.at(i).x() * polygon.at(j).y();
+    }
 
-    for (int i=0; i < n; i++)
+    if (qFuzzyIsNull(area))
     {
-        x.append(poly.at(i).x());
-        y.append(poly.at(i).y());
+        return triangles;
     }
 
-    // Calculation a polygon area through the sum of the areas of trapezoids
-    for (int i = 0; i < n; i++)
+    // Work in a frame where the polygon is counterclockwise, values near zero are treated as collinear.
+    const qreal orientation = area > 0 ? 1 : -1;
+    const QRectF rect = polygon.boundingRect();
+    const qreal eps = qMax(rect.width() * rect.height(), 1.0) * 1e-12;
+
+    auto Cross = [&polygon, orientation](int a, int b, int c)
     {
-        if (i == 0)
-        {
-            s = x.at(i)*(y.at(n-1) - y.at(i+1)); //if i == 0, then y[i-1] replace on y[n-1]
-            res += s;
-        }
-        else
+        const QPointF &pa = polygon.at(a);
+        const QPointF &pb = polygon.at(b);
+        const QPointF &pc = polygon.at(c);
+        return orientation * ((pb.x() - pa.x()) * (pc.y() - pa.y()) - (pb.y() - pa.y()) * (pc.x() - pa.x()));
+    };
+
+    QVector<int> prev(n);
+    QVector<int> next(n);
+    for (int i = 0; i < n; ++i)
+    {
+        prev[i] = (i + n - 1) % n;
+        next[i] = (i + 1) % n;
+    }
+
+    auto IsEar = [&](int a, int b, int c)
+    {
+        for (int p = next.at(c); p != a; p = next.at(p))
         {
-            if (i == n-1)
+            if (Cross(prev.at(p), p, next.at(p)) > eps)
             {
-                s = x.at(i)*(y.at(i-1) - y.at(0)); // if i == n-1, then y[i+1] replace on y[0]
-                res += s;
+                continue; // Convex vertex
             }
-            else
+
+            // Points on the border of the ear also reject it
+            if (Cross(a, b, p) >= -eps && Cross(b, c, p) >= -eps && Cross(c, a, p) >= -eps)
             {
-                s = x.at(i)*(y.at(i-1) - y.at(i+1));
-                res += s;
+                return false;
             }
         }
+        return true;
+    };
+
+    auto Remove = [&prev, &next](int v)
+    {
+        next[prev.at(v)] = next.at(v);
+        prev[next.at(v)] = prev.at(v);
+    };
+
+    int remaining = n;
+    int current = 0;
+    int stop = current;
+    while (remaining > 3)
+    {
+        const int a = prev.at(current);
+        const int c = next.at(current);
+        const qreal cross = Cross(a, current, c);
+
+        if (qAbs(cross) <= eps)
+        {// Degenerate corner, nothing to fill
+            Remove(current);
+            --remaining;
+            current = stop = c;
+            continue;
+        }
+
+        if (cross > 0 && IsEar(a, current, c))
+        {
+            triangles << a << current << c;
+            Remove(current);
+            --remaining;
+            current = stop = c;
+            continue;
+        }
+
+        current = c;
+        if (current == stop)
+        {// Full pass without an ear, the polygon is not simple
+            triangles << prev.at(current) << current << next.at(current);
+            Remove(current);
+            --remaining;
+            current = stop = next.at(current);
+        }
+    }
+
+    if (qAbs(Cross(prev.at(current), current, next.at(current))) > eps)
+    {
+        triangles << prev.at(current) << current << next.at(current);
     }
-    sq = qFloor(qAbs(res/2.0));
-    return sq;
+
+    return triangles;
 }
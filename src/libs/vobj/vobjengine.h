@@ -60,13 +60,10 @@
 #include <QSharedPointer>
 #include <QSize>
 #include <QtGlobal>
-
-#include "delaunay.h"
+#include <QVector>
 
 class QTextStream;
 
-#define MAX_POINTS      512
-
 class VObjEngine : public QPaintEngine
 {
 public:
@@ -93,19 +90,19 @@ class VObjEngine : public QPaintEngine
     int getResolution() const;
     void setResolution(int value);
 
+    static QVector<int> Triangulate(const QPolygonF &polygon);
+
 private:
     Q_DISABLE_COPY(VObjEngine)
     QSharedPointer<QTextStream> stream;
     quint32     globalPointsCount;
     QSharedPointer<QIODevice> outputDevice;
-    del_point2d_t    points[MAX_POINTS];
     quint32          planeCount;
     QSize            size;
     int              resolution;
     QTransform       transform;
 
     QPolygonF  MakePointsUnique(const QPolygonF &polygon)const;
-    qint64     Square(const QPolygonF &poly)const;
 };
 
 #endif // VOBJENGINE_H
@@ -51,15 +51,80 @@
 
 #include "calculator.h"
 
+#include <QCache>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QScopedPointer>
 #include <QStaticStringData>
 #include <QStringData>
 #include <QStringDataPtr>
 #include <QStringList>
+#include <QVector>
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmuparsererror.h"
 #include "variables/vinternalvariable.h"
+#include "vdependencygraph.h"
 #include <QSharedPointer>
+
+/**
+ * @brief The VCompiledFormula class keeps a parsed expression ready for evaluation.
+ *
+ * The parser binds variables to own storage, so evaluation only copies current values of the variables and runs the
+ * bytecode. An expression without variables keeps only its value.
+ */
+class VCompiledFormula
+{
+public:
+    VCompiledFormula()
+        : mutex(),
+          parser(),
+          names(),
+          positions(),
+          values(),
+          constant(false),
+          constantValue(0)
+    {}
+
+    QMutex                     mutex;
+    QScopedPointer<Calculator> parser;
+    QStringList                names;
+    QVector<int>               positions;
+    QVector<qreal>             values;
+    bool                       constant;
+    qreal                      constantValue;
+
+private:
+    Q_DISABLE_COPY(VCompiledFormula)
+};
+
+namespace
+{
+/** @brief Cache cost of a formula with variables, it keeps a whole parser. */
+const int compiledFormulaCost = 16;
+
+/** @brief Cache cost of a formula without variables, it keeps only the value. Must not be 0, or the entry is never
+ * evicted. */
+const int constantFormulaCost = 1;
+
+/** @brief Maximum cost of the cache, enough for 4096 compiled parsers. */
+const int maxCompiledFormulas = 4096 * compiledFormulaCost;
+
+//---------------------------------------------------------------------------------------------------------------------
+QMutex *FormulaCacheMutex()
+{
+    static QMutex mutex;
+    return &mutex;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QCache<QString, QSharedPointer<VCompiledFormula>> *FormulaCache()
+{
+    static QCache<QString, QSharedPointer<VCompiledFormula>> cache(maxCompiledFormulas);
+    return &cache;
+}
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief Calculator class wraper for QMuParser. Make easy initialization math parser.
@@ -93,7 +158,7 @@ Calculator::Calculator()
  * @param formula string of formula.
  * @return value of formula.
  */
-qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> *vars, const QString &formula)
+qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable>> &vars, const QString &formula)
 {
     // Parser doesn't know any variable on this stage. So, we just use variable factory that for each unknown variable
     // set value to 0.
@@ -139,16 +204,18 @@ qreal Calculator::EvalFormula(const QHash<QString, QSharedPointer<VInternalVaria
  * @param tokens all tokens (measurements names, variables with lengths) that parser have found in expression.
  * @param formula expression, need for throwing better error message.
  */
-void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars,
+void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > &vars,
                                const QMap<int, QString> &tokens, const QString &formula)
 {
     QMap<int, QString>::const_iterator i = tokens.constBegin();
     while (i != tokens.constEnd())
     {
         bool found = false;
-        if (vars->contains(i.value()))
+        if (vars.contains(i.value()))
         {
-            DefineVar(i.value(), vars->value(i.value())->GetValue());
+            qreal *value = vars.value(i.value())->GetValue();
+            DefineVar(i.value(), value);
+            VDependencyGraph::RecordVariableInput(i.value(), *value);
             found = true;
         }
 
@@ -164,3 +231,123 @@ void Calculator::InitVariables(const QHash<QString, QSharedPointer<VInternalVari
         ++i;
     }
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EvalCachedFormula calculate formula using shared cache of compiled expressions.
+ *
+ * Gives the same result as EvalFormula(), but each expression is tokenized and compiled only once. Next evaluations
+ * only rebind values of the variables and run the bytecode. Safe to call from several threads.
+ *
+ * @param vars list of variables.
+ * @param formula string of formula.
+ * @return value of formula.
+ */
+qreal Calculator::EvalCachedFormula(const QHash<QString, QSharedPointer<VInternalVariable> > &vars,
+                                    const QString &formula)
+{
+    QSharedPointer<VCompiledFormula> compiled;
+    {
+        QMutexLocker locker(FormulaCacheMutex());
+        if (QSharedPointer<VCompiledFormula> *cached = FormulaCache()->object(formula))
+        {
+            compiled = *cached;
+        }
+    }
+
+    if (compiled.isNull())
+    {
+        compiled = CompileFormula(formula);// Throws if the formula is invalid, such formulas are not cached
+
+        QMutexLocker locker(FormulaCacheMutex());
+        FormulaCache()->insert(formula, new QSharedPointer<VCompiledFormula>(compiled),
+                               compiled->constant ? constantFormulaCost : compiledFormulaCost);
+    }
+
+    if (compiled->constant)
+    {
+        return compiled->constantValue;
+    }
+
+    QMutexLocker locker(&compiled->mutex);
+    for (int i = 0; i < compiled->names.size(); ++i)
+    {
+        const QString &name = compiled->names.at(i);
+        auto var = vars.constFind(name);
+        if (var == vars.constEnd())
+        {
+            throw qmu::QmuParserError (qmu::ecUNASSIGNABLE_TOKEN, name, formula, compiled->positions.at(i));
+        }
+        compiled->values[i] = *var.value()->GetValue();
+        VDependencyGraph::RecordVariableInput(name, compiled->values.at(i));
+    }
+
+    return compiled->parser->Eval();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ClearFormulaCache drop all compiled expressions.
+ */
+void Calculator::ClearFormulaCache()
+{
+    QMutexLocker locker(FormulaCacheMutex());
+    FormulaCache()->clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CompileFormula parse formula and bind its variables to own storage of compiled expression.
+ * @param formula string of formula.
+ * @return compiled expression.
+ */
+QSharedPointer<VCompiledFormula> Calculator::CompileFormula(const QString &formula)
+{
+    QSharedPointer<VCompiledFormula> compiled(new VCompiledFormula());
+    compiled->parser.reset(new Calculator());
+    Calculator *cal = compiled->parser.data();
+
+    // Collect tokens the same way EvalFormula does.
+    cal->SetVarFactory(AddVariable, cal);
+    cal->SetExpr(formula);
+    const qreal result = cal->Eval();
+
+    QMap<int, QString> tokens = cal->GetTokens();
+    RemoveAll(tokens, QStringLiteral("-"));
+    for (int i = 0; i < builInFunctions.size(); ++i)
+    {
+        if (tokens.isEmpty())
+        {
+            break;
+        }
+        RemoveAll(tokens, builInFunctions.at(i));
+    }
+
+    if (tokens.isEmpty())
+    {
+        compiled->parser.reset();
+        compiled->constant = true;
+        compiled->constantValue = result;
+        return compiled;
+    }
+
+    QMap<int, QString>::const_iterator i = tokens.constBegin();
+    while (i != tokens.constEnd())
+    {
+        if (not compiled->names.contains(i.value()))
+        {
+            compiled->names.append(i.value());
+            compiled->positions.append(i.key());
+        }
+        ++i;
+    }
+
+    // Storage must not reallocate after variables were defined.
+    compiled->values.fill(0, compiled->names.size());
+    for (int j = 0; j < compiled->names.size(); ++j)
+    {
+        cal->DefineVar(compiled->names.at(j), &compiled->values[j]);
+    }
+
+    return compiled;
+}
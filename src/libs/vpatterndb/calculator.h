@@ -55,6 +55,7 @@
 #include <qcompilerdetection.h>
 #include <QHash>
 #include <QMap>
+#include <QSharedPointer>
 #include <QString>
 #include <QtGlobal>
 
@@ -62,6 +63,9 @@
 
 //class VInternalVariable;
 #include "variables/vinternalvariable.h"
+
+class VCompiledFormula;
+
 /**
  * @brief The Calculator class for calculation formula.
  *
@@ -86,11 +90,17 @@ class Calculator:public qmu::QmuFormulaBase
     Calculator();
     virtual ~Calculator() Q_DECL_EQ_DEFAULT;
 
-    qreal EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QString &formula);
+    qreal EvalFormula(const QHash<QString, QSharedPointer<VInternalVariable> > &vars, const QString &formula);
+
+    static qreal EvalCachedFormula(const QHash<QString, QSharedPointer<VInternalVariable> > &vars,
+                                   const QString &formula);
+    static void  ClearFormulaCache();
 private:
     Q_DISABLE_COPY(Calculator)
 
-    void InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > *vars, const QMap<int, QString> &tokens,
+    static QSharedPointer<VCompiledFormula> CompileFormula(const QString &formula);
+
+    void InitVariables(const QHash<QString, QSharedPointer<VInternalVariable> > &vars, const QMap<int, QString> &tokens,
                        const QString &formula);
 };
 
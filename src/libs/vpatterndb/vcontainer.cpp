@@ -149,7 +149,9 @@ VContainer::~VContainer()
 // cppcheck-suppress unusedFunction
 const QSharedPointer<VGObject> VContainer::GetGObject(quint32 id)const
 {
-    return GetObject(d->gObjects, id);
+    const QSharedPointer<VGObject> obj = GetObject(d->gObjects, id);
+    VDependencyGraph::RecordObjectInput(id);
+    return obj;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -169,7 +171,7 @@ const QSharedPointer<VGObject> VContainer::GetFakeGObject(quint32 id)
  * @return Object
  */
 template <typename key, typename val>
-const val VContainer::GetObject(const QHash<key, val> &obj, key id) const
+const val VContainer::GetObject(const VVersionedHash<key, val> &obj, key id) const
 {
     if (obj.contains(id))
     {
@@ -324,13 +326,16 @@ void VContainer::ClearCalculationGObjects()
     if (not d->gObjects.isEmpty()) //-V807
     {
         QVector<quint32> keys;
-        QHash<quint32, QSharedPointer<VGObject> >::iterator i;
-        for (i = d->gObjects.begin(); i != d->gObjects.end(); ++i)
         {
-            if (i.value()->getMode() == Draw::Calculation)
+            // Release the copy before removing, otherwise the objects are copied on the first write.
+            const QHash<quint32, QSharedPointer<VGObject> > gObjects = d->gObjects.hash();
+            QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
+            for (i = gObjects.constBegin(); i != gObjects.constEnd(); ++i)
             {
-                i.value().clear();
-                keys.append(i.key());
+                if (i.value()->getMode() == Draw::Calculation)
+                {
+                    keys.append(i.key());
+                }
             }
         }
         // We can't delete objects in previous loop it will destroy the iterator.
@@ -356,12 +361,16 @@ void VContainer::ClearVariables(const VarType &type)
         else
         {
             QVector<QString> keys;
-            QHash<QString, QSharedPointer<VInternalVariable> >::iterator i;
-            for (i = d->variables.begin(); i != d->variables.end(); ++i)
             {
-                if (i.value()->GetType() == type)
+                // Release the copy before removing, otherwise the variables are copied on the first write.
+                const QHash<QString, QSharedPointer<VInternalVariable> > variables = d->variables.hash();
+                QHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
+                for (i = variables.constBegin(); i != variables.constEnd(); ++i)
                 {
-                    keys.append(i.key());
+                    if (i.value()->GetType() == type)
+                    {
+                        keys.append(i.key());
+                    }
                 }
             }
 
@@ -497,12 +506,12 @@ void VContainer::RemovePiece(quint32 id)
  * @return id of object in container
  */
 template <typename key, typename val>
-quint32 VContainer::AddObject(QHash<key, val> &obj, val value)
+quint32 VContainer::AddObject(VVersionedHash<key, val> &obj, val value)
 {
     SCASSERT(value != nullptr)
     const quint32 id = getNextId();
     value->setId(id);
-    obj[id] = value;
+    obj.insert(id, value);
     return id;
 }
 
@@ -520,6 +529,7 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
     Q_ASSERT_X(id != NULL_ID, Q_FUNC_INFO, "id == 0"); //-V654 //-V712
     d->piecePaths->insert(id, path);
     UpdateId(id);
+    VDependencyGraph::RecordPiecePathOutput(id, path);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -529,7 +539,6 @@ void VContainer::UpdatePiecePath(quint32 id, const VPiecePath &path)
  */
 void VContainer::removeCustomVariable(const QString &name)
 {
-    d->variables[name].clear();
     d->variables.remove(name);
 }
 
@@ -613,8 +622,9 @@ const QMap<QString, QSharedPointer<T> > VContainer::DataVar(const VarType &type)
 {
     QMap<QString, QSharedPointer<T> > map;
     //Sorting QHash by id
+    const QHash<QString, QSharedPointer<VInternalVariable> > variables = d->variables.hash();
     QHash<QString, QSharedPointer<VInternalVariable> >::const_iterator i;
-    for (i = d->variables.constBegin(); i != d->variables.constEnd(); ++i)
+    for (i = variables.constBegin(); i != variables.constEnd(); ++i)
     {
         if (i.value()->GetType() == type)
         {
@@ -700,12 +710,17 @@ qreal *VContainer::rheight()
 
 //---------------------------------------------------------------------------------------------------------------------
 /**
- * @brief data container with datagObjects return container of gObjects
- * @return pointer on container of gObjects
+ * @brief data container with datagObjects return container of gObjects. A tool that reads all objects can't be skipped
+ * by the dependency graph.
+ *
+ * The hash is implicitly shared with the container. Keep it only as long as needed, a container written while a copy
+ * is alive has to copy all its objects.
+ * @return container of gObjects
  */
-const QHash<quint32, QSharedPointer<VGObject> > *VContainer::DataGObjects() const
+const QHash<quint32, QSharedPointer<VGObject> > VContainer::DataGObjects() const
 {
-    return &d->gObjects;
+    VDependencyGraph::RecordUntrackedInput();
+    return d->gObjects.hash();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -715,9 +730,23 @@ const QHash<quint32, VPiece> *VContainer::DataPieces() const
 }
 
 //---------------------------------------------------------------------------------------------------------------------
-const QHash<QString, QSharedPointer<VInternalVariable> > *VContainer::DataVariables() const
+/**
+ * @brief DataVariables return all variables. A tool that reads all variables can't be skipped by the dependency graph.
+ */
+const QHash<QString, QSharedPointer<VInternalVariable> > VContainer::DataVariables() const
+{
+    VDependencyGraph::RecordUntrackedInput();
+    return d->variables.hash();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief FormulaVariables return all variables for calculation of a formula. Calculator records each variable the
+ * formula uses, so the read is not untracked.
+ */
+const QHash<QString, QSharedPointer<VInternalVariable> > VContainer::FormulaVariables() const
 {
-    return &d->variables;
+    return d->variables.hash();
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -76,9 +76,11 @@
 #include "../vmisc/diagnostic.h"
 #include "variables.h"
 #include "variables/vinternalvariable.h"
+#include "vdependencygraph.h"
 #include "vpiece.h"
 #include "vpiecepath.h"
 #include "vtranslatevars.h"
+#include "vversionedhash.h"
 
 class VEllipticalArc;
 
@@ -92,8 +94,8 @@ class VContainerData : public QSharedData //-V690
 public:
 
     VContainerData(const VTranslateVars *trVars, const Unit *patternUnit)
-        : gObjects(QHash<quint32, QSharedPointer<VGObject> >()),
-          variables(QHash<QString, QSharedPointer<VInternalVariable> > ()),
+        : gObjects(),
+          variables(),
           pieces(QSharedPointer<QHash<quint32, VPiece>>(new QHash<quint32, VPiece>())),
           piecePaths(QSharedPointer<QHash<quint32, VPiecePath>>(new QHash<quint32, VPiecePath>())),
           trVars(trVars),
@@ -113,14 +115,14 @@ class VContainerData : public QSharedData //-V690
     virtual ~VContainerData();
 
     /**
-     * @brief gObjects graphicals objects of pattern.
+     * @brief gObjects graphicals objects of pattern. Copies share the data and only keep their version.
      */
-    QHash<quint32, QSharedPointer<VGObject> > gObjects;
+    VVersionedHash<quint32, QSharedPointer<VGObject> > gObjects;
 
     /**
      * @brief variables container for measurements, increments, lines lengths, lines angles, arcs lengths, curve lengths
      */
-    QHash<QString, QSharedPointer<VInternalVariable>> variables;
+    VVersionedHash<QString, QSharedPointer<VInternalVariable>> variables;
 
     QSharedPointer<QHash<quint32, VPiece>> pieces;
     QSharedPointer<QHash<quint32, VPiecePath>> piecePaths;
@@ -206,9 +208,10 @@ class VContainer
 
     void               removeCustomVariable(const QString& name);
 
-    const QHash<quint32, QSharedPointer<VGObject> >         *DataGObjects() const;
+    const QHash<quint32, QSharedPointer<VGObject> >         DataGObjects() const;
     const QHash<quint32, VPiece>                            *DataPieces() const;
-    const QHash<QString, QSharedPointer<VInternalVariable>> *DataVariables() const;
+    const QHash<QString, QSharedPointer<VInternalVariable>> DataVariables() const;
+    const QHash<QString, QSharedPointer<VInternalVariable>> FormulaVariables() const;
 
     const QMap<QString, QSharedPointer<VMeasurement> >  DataMeasurements() const;
     const QMap<QString, QSharedPointer<VIncrement> >    variablesData() const;
@@ -243,13 +246,13 @@ class VContainer
 
     template <typename key, typename val>
     // cppcheck-suppress functionStatic
-    const val GetObject(const QHash<key, val> &obj, key id) const;
+    const val GetObject(const VVersionedHash<key, val> &obj, key id) const;
 
     template <typename T>
     void UpdateObject(const quint32 &id, const QSharedPointer<T> &point);
 
     template <typename key, typename val>
-    static quint32 AddObject(QHash<key, val> &obj, val value);
+    static quint32 AddObject(VVersionedHash<key, val> &obj, val value);
 
     template <typename T>
     const QMap<QString, QSharedPointer<T> > DataVar(const VarType &type) const;
@@ -275,6 +278,7 @@ const QSharedPointer<T> VContainer::GeometricObject(const quint32 &id) const
     if (d->gObjects.contains(id))
     {
         gObj = d->gObjects.value(id);
+        VDependencyGraph::RecordObjectInput(id);
     }
     else
     {
@@ -309,6 +313,7 @@ QSharedPointer<T> VContainer::GetVariable(QString name) const
         {
             QSharedPointer<T> value = qSharedPointerDynamicCast<T>(d->variables.value(name));
             SCASSERT(value.isNull() == false)
+            VDependencyGraph::RecordVariableInput(name, *value->GetValue());
             return value;
         }
         catch (const std::bad_alloc &)
@@ -355,6 +360,7 @@ void VContainer::AddVariable(const QString& name, const QSharedPointer<T> &var)
     }
 
     uniqueNames.insert(name);
+    VDependencyGraph::RecordVariableOutput(name, var);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -384,6 +390,7 @@ void VContainer::UpdateGObject(quint32 id, const QSharedPointer<T> &obj)
     SCASSERT(not obj.isNull())
     UpdateObject(id, obj);
     uniqueNames.insert(obj->name());
+    VDependencyGraph::RecordObjectOutput(id, obj);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,399 @@
+/***************************************************************************
+ **  @file   vdependencygraph.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vdependencygraph.h"
+
+#include "../vmisc/def.h"
+#include "vcontainer.h"
+#include "../vgeometry/varc.h"
+#include "../vgeometry/vcubicbezier.h"
+#include "../vgeometry/vcubicbezierpath.h"
+#include "../vgeometry/vellipticalarc.h"
+#include "../vgeometry/vpointf.h"
+#include "../vgeometry/vspline.h"
+#include "../vgeometry/vsplinepath.h"
+#include "variables/varcradius.h"
+#include "variables/vcurveangle.h"
+#include "variables/vcurveclength.h"
+#include "variables/vcurvelength.h"
+#include "variables/vincrement.h"
+#include "variables/vlineangle.h"
+#include "variables/vlinelength.h"
+#include "variables/vmeasurement.h"
+
+namespace
+{
+/** @brief The graph that records the tool being calculated in this thread, if any. */
+thread_local VDependencyGraph *activeGraph = nullptr;
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T>
+QSharedPointer<T> CopyAs(const QSharedPointer<VGObject> &obj)
+{
+    return QSharedPointer<T>(new T(*obj.staticCast<T>()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CopyObject makes an own copy of a geometric object. Copies are cheap, the data is implicitly shared until one
+ * of them changes.
+ * @return null if the type of the object is not known.
+ */
+QSharedPointer<VGObject> CopyObject(const QSharedPointer<VGObject> &obj)
+{
+    switch (obj->getType())
+    {
+        case GOType::Point:
+            return CopyAs<VPointF>(obj);
+        case GOType::Arc:
+            return CopyAs<VArc>(obj);
+        case GOType::EllipticalArc:
+            return CopyAs<VEllipticalArc>(obj);
+        case GOType::Spline:
+            return CopyAs<VSpline>(obj);
+        case GOType::SplinePath:
+            return CopyAs<VSplinePath>(obj);
+        case GOType::CubicBezier:
+            return CopyAs<VCubicBezier>(obj);
+        case GOType::CubicBezierPath:
+            return CopyAs<VCubicBezierPath>(obj);
+        case GOType::Unknown:
+        default:
+            return QSharedPointer<VGObject>();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename T>
+QSharedPointer<VInternalVariable> CopyVariableAs(const QSharedPointer<VInternalVariable> &var)
+{
+    return QSharedPointer<VInternalVariable>(new T(*var.staticCast<T>()));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CopyVariable makes an own copy of a variable.
+ * @return null if the type of the variable is not known.
+ */
+QSharedPointer<VInternalVariable> CopyVariable(const QSharedPointer<VInternalVariable> &var)
+{
+    switch (var->GetType())
+    {
+        case VarType::Measurement:
+            return CopyVariableAs<VMeasurement>(var);
+        case VarType::Increment:
+            return CopyVariableAs<VIncrement>(var);
+        case VarType::LineLength:
+            return CopyVariableAs<VLengthLine>(var);
+        case VarType::CurveLength:
+            return CopyVariableAs<VCurveLength>(var);
+        case VarType::CurveCLength:
+            return CopyVariableAs<VCurveCLength>(var);
+        case VarType::LineAngle:
+            return CopyVariableAs<VLineAngle>(var);
+        case VarType::CurveAngle:
+            return CopyVariableAs<VCurveAngle>(var);
+        case VarType::ArcRadius:
+            return CopyVariableAs<VArcRadius>(var);
+        case VarType::Unknown:
+        default:
+            return QSharedPointer<VInternalVariable>();
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDependencyGraph::VToolNode::VToolNode()
+    : signature(0),
+      untracked(false),
+      objectInputs(),
+      variableInputs(),
+      objectOutputs(),
+      variableOutputs(),
+      pathOutputs()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+VDependencyGraph::VDependencyGraph()
+    : nodes(),
+      changedObjects(),
+      current(),
+      currentId(NULL_ID)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::Clear()
+{
+    AbortTool();
+    nodes.clear();
+    changedObjects.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BeginPass starts new calculation of the pattern. Nothing is changed yet.
+ */
+void VDependencyGraph::BeginPass()
+{
+    changedObjects.clear();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VDependencyGraph::Count() const
+{
+    return nodes.size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsUpToDate check if the last result of a tool is still valid.
+ * @param id tool id.
+ * @param signature signature of the tool's element, changes when the tool's options change.
+ * @param data container in the state the tool sees it now.
+ * @return true if outputs of the tool can be replayed instead of calculating the tool.
+ */
+bool VDependencyGraph::IsUpToDate(quint32 id, quint64 signature, const VContainer *data) const
+{
+    SCASSERT(data != nullptr)
+
+    auto node = nodes.constFind(id);
+    if (node == nodes.constEnd() || node->signature != signature)
+    {
+        return false;
+    }
+
+    const QHash<quint32, QSharedPointer<VGObject>> objects = data->DataGObjects();
+    for (int i = 0; i < node->objectInputs.size(); ++i)
+    {
+        const quint32 input = node->objectInputs.at(i);
+        if (changedObjects.contains(input) || not objects.contains(input))
+        {
+            return false;
+        }
+    }
+
+    const QHash<QString, QSharedPointer<VInternalVariable>> variables = data->DataVariables();
+    for (int i = 0; i < node->variableInputs.size(); ++i)
+    {
+        const QPair<QString, qreal> &input = node->variableInputs.at(i);
+        auto var = variables.constFind(input.first);
+        if (var == variables.constEnd() || *var.value()->GetValue() != input.second)
+        {
+            return false;
+        }
+    }
+
+    // Replay only into empty slots. Existing objects and variables are updated in place, that needs the real tool.
+    for (int i = 0; i < node->objectOutputs.size(); ++i)
+    {
+        if (objects.contains(node->objectOutputs.at(i).first))
+        {
+            return false;
+        }
+    }
+
+    for (int i = 0; i < node->variableOutputs.size(); ++i)
+    {
+        if (variables.contains(node->variableOutputs.at(i).first))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief Replay put the last outputs of an up to date tool back into the container.
+ */
+void VDependencyGraph::Replay(quint32 id, VContainer *data) const
+{
+    SCASSERT(data != nullptr)
+
+    auto node = nodes.constFind(id);
+    if (node == nodes.constEnd())
+    {
+        return;
+    }
+
+    // The container gets own copies, changes to them must not reach the record or the previous pass
+    for (int i = 0; i < node->objectOutputs.size(); ++i)
+    {
+        data->UpdateGObject(node->objectOutputs.at(i).first, CopyObject(node->objectOutputs.at(i).second));
+    }
+
+    for (int i = 0; i < node->variableOutputs.size(); ++i)
+    {
+        data->AddVariable(node->variableOutputs.at(i).first, CopyVariable(node->variableOutputs.at(i).second));
+    }
+
+    for (int i = 0; i < node->pathOutputs.size(); ++i)
+    {
+        data->UpdatePiecePath(node->pathOutputs.at(i).first, node->pathOutputs.at(i).second);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief BeginTool start recording inputs and outputs of a tool. Only one tool per thread can be recorded at a time.
+ */
+void VDependencyGraph::BeginTool(quint32 id, quint64 signature)
+{
+    current = VToolNode();
+    current.signature = signature;
+    currentId = id;
+    activeGraph = this;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief EndTool finish recording. The tool's objects count as changed for the rest of the pass. A tool that read
+ * something the graph can't follow is not kept, it is calculated every time.
+ */
+void VDependencyGraph::EndTool()
+{
+    if (activeGraph != this)
+    {
+        return;
+    }
+    activeGraph = nullptr;
+
+    // Drop repeated inputs, tools often read the same object several times.
+    QVector<quint32> objectInputs;
+    QSet<quint32> seenObjects;
+    for (int i = 0; i < current.objectInputs.size(); ++i)
+    {
+        const quint32 input = current.objectInputs.at(i);
+        if (not seenObjects.contains(input))
+        {
+            seenObjects.insert(input);
+            objectInputs.append(input);
+        }
+    }
+    current.objectInputs = objectInputs;
+
+    for (int i = 0; i < current.objectOutputs.size(); ++i)
+    {
+        changedObjects.insert(current.objectOutputs.at(i).first);
+    }
+
+    if (current.untracked)
+    {
+        nodes.remove(currentId);
+    }
+    else
+    {
+        nodes.insert(currentId, current);
+    }
+    current = VToolNode();
+    currentId = NULL_ID;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief AbortTool stop recording after an error. The tool will be calculated next time.
+ */
+void VDependencyGraph::AbortTool()
+{
+    if (activeGraph == this)
+    {
+        activeGraph = nullptr;
+        nodes.remove(currentId);
+    }
+    current = VToolNode();
+    currentId = NULL_ID;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::RecordObjectInput(quint32 id)
+{
+    if (activeGraph != nullptr)
+    {
+        activeGraph->current.objectInputs.append(id);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::RecordVariableInput(const QString &name, qreal value)
+{
+    if (activeGraph != nullptr)
+    {
+        activeGraph->current.variableInputs.append(qMakePair(name, value));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RecordUntrackedInput the tool read the whole set of objects or variables, its real inputs are not known.
+ */
+void VDependencyGraph::RecordUntrackedInput()
+{
+    if (activeGraph != nullptr)
+    {
+        activeGraph->current.untracked = true;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief RecordObjectOutput remember a copy of the object, so changes through the container's pointer do not reach the
+ * record.
+ */
+void VDependencyGraph::RecordObjectOutput(quint32 id, const QSharedPointer<VGObject> &obj)
+{
+    if (activeGraph != nullptr)
+    {
+        const QSharedPointer<VGObject> copy = CopyObject(obj);
+        if (copy.isNull())
+        {
+            activeGraph->current.untracked = true;
+            return;
+        }
+        activeGraph->current.objectOutputs.append(qMakePair(id, copy));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::RecordVariableOutput(const QString &name, const QSharedPointer<VInternalVariable> &var)
+{
+    if (activeGraph != nullptr)
+    {
+        const QSharedPointer<VInternalVariable> copy = CopyVariable(var);
+        if (copy.isNull())
+        {
+            activeGraph->current.untracked = true;
+            return;
+        }
+        activeGraph->current.variableOutputs.append(qMakePair(name, copy));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void VDependencyGraph::RecordPiecePathOutput(quint32 id, const VPiecePath &path)
+{
+    if (activeGraph != nullptr)
+    {
+        activeGraph->current.pathOutputs.append(qMakePair(id, path));
+    }
+}
@@ -0,0 +1,101 @@
+/***************************************************************************
+ **  @file   vdependencygraph.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VDEPENDENCYGRAPH_H
+#define VDEPENDENCYGRAPH_H
+
+#include <QHash>
+#include <QPair>
+#include <QSet>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vgeometry/vgobject.h"
+#include "variables/vinternalvariable.h"
+#include "vpiecepath.h"
+
+class VContainer;
+
+/**
+ * @brief The VDependencyGraph class remembers what each tool read from and wrote to VContainer.
+ *
+ * While a tool is recorded VContainer reports every object and variable the tool reads (its inputs) and every object,
+ * variable and piece path it writes (its outputs). Inputs link the tool to the tools that produced them, so together
+ * the records form the dependency graph of the pattern.
+ *
+ * On the next lite parse a tool whose element has not changed and whose inputs were not recalculated in this pass is
+ * up to date. Copies of its outputs are put back into the container instead of calculating the tool again. A
+ * recalculated tool marks its objects as changed, and that makes every tool downstream recalculate too.
+ *
+ * A tool that reads all objects or variables at once (VContainer::DataGObjects(), VContainer::DataVariables()) has no
+ * known inputs. It is never skipped.
+ */
+class VDependencyGraph
+{
+public:
+    VDependencyGraph();
+
+    void Clear();
+    void BeginPass();
+    int  Count() const;
+
+    bool IsUpToDate(quint32 id, quint64 signature, const VContainer *data) const;
+    void Replay(quint32 id, VContainer *data) const;
+
+    void BeginTool(quint32 id, quint64 signature);
+    void EndTool();
+    void AbortTool();
+
+    static void RecordObjectInput(quint32 id);
+    static void RecordVariableInput(const QString &name, qreal value);
+    static void RecordUntrackedInput();
+    static void RecordObjectOutput(quint32 id, const QSharedPointer<VGObject> &obj);
+    static void RecordVariableOutput(const QString &name, const QSharedPointer<VInternalVariable> &var);
+    static void RecordPiecePathOutput(quint32 id, const VPiecePath &path);
+
+private:
+    Q_DISABLE_COPY(VDependencyGraph)
+
+    struct VToolNode
+    {
+        VToolNode();
+
+        quint64                                               signature;
+        /** @brief untracked the inputs are not known, the tool can't be skipped. */
+        bool                                                  untracked;
+        QVector<quint32>                                      objectInputs;
+        QVector<QPair<QString, qreal>>                        variableInputs;
+        QVector<QPair<quint32, QSharedPointer<VGObject>>>     objectOutputs;
+        QVector<QPair<QString, QSharedPointer<VInternalVariable>>> variableOutputs;
+        QVector<QPair<quint32, VPiecePath>>                   pathOutputs;
+    };
+
+    QHash<quint32, VToolNode> nodes;
+    QSet<quint32>             changedObjects;
+    VToolNode                 current;
+    quint32                   currentId;
+};
+
+#endif // VDEPENDENCYGRAPH_H
@@ -263,9 +263,8 @@ void VFormula::Eval()
     {
         try
         {
-            QScopedPointer<Calculator> cal(new Calculator());
             QString expression = qApp->TrVars()->FormulaFromUser(formula, qApp->Settings()->GetOsSeparator());
-            const qreal result = cal->EvalFormula(data->DataVariables(), expression);
+            const qreal result = Calculator::EvalCachedFormula(data->FormulaVariables(), expression);
 
             if (qIsInf(result) || qIsNaN(result))
             {
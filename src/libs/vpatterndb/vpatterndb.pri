@@ -21,6 +21,7 @@ SOURCES += \
     $$PWD/vpiece.cpp \
     $$PWD/vpiecenode.cpp \
     $$PWD/vpiecepath.cpp \
+    $$PWD/vdependencygraph.cpp \
     $$PWD/floatItemData/vpiecelabeldata.cpp \
     $$PWD/floatItemData/vpatternlabeldata.cpp \
     $$PWD/floatItemData/vgrainlinedata.cpp \
@@ -32,6 +33,7 @@ SOURCES += \
 
 HEADERS += \
     $$PWD/vcontainer.h \
+    $$PWD/vversionedhash.h \
     $$PWD/stable.h \
     $$PWD/calculator.h \
     $$PWD/variables.h \
@@ -64,6 +66,7 @@ HEADERS += \
     $$PWD/vpiecenode_p.h \
     $$PWD/vpiecepath.h \
     $$PWD/vpiecepath_p.h \
+    $$PWD/vdependencygraph.h \
     $$PWD/floatItemData/vpiecelabeldata.h \
     $$PWD/floatItemData/vpatternlabeldata.h \
     $$PWD/floatItemData/vgrainlinedata.h \
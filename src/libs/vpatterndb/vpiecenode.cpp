@@ -72,8 +72,7 @@ qreal EvalFormula(const VContainer *data, QString formula)
         {
             // Replace line return character with spaces for calc if exist
             formula.replace("\n", " ");
-            QScopedPointer<Calculator> cal(new Calculator());
-            const qreal result = cal->EvalFormula(data->DataVariables(), formula);
+            const qreal result = Calculator::EvalCachedFormula(data->FormulaVariables(), formula);
 
             if (qIsInf(result) || qIsNaN(result))
             {
@@ -57,10 +57,12 @@
 //---------------------------------------------------------------------------------------------------------------------
 VTranslateMeasurements::VTranslateMeasurements()
     :measurements(QMap<QString, qmu::QmuTranslation>()),
+      measurementsToUser(),
       guiTexts(QMap<QString, qmu::QmuTranslation>()),
       descriptions(QMap<QString, qmu::QmuTranslation>()),
       numbers(QMap<QString, QString>()),
-      formulas(QMap<QString, QString>())
+      formulas(QMap<QString, QString>()),
+      measurementsFromUser()
 {
     InitMeasurements();
 }
@@ -81,16 +83,12 @@ VTranslateMeasurements::~VTranslateMeasurements()
 bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int position, const QString &token,
                                                   int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = measurements.constBegin();
-    while (i != measurements.constEnd())
+    auto i = measurementsFromUser.constFind(token);
+    if (i != measurementsFromUser.constEnd())
     {
-        if (token == i.value().translate())
-        {
-            newFormula.replace(position, token.length(), i.key());
-            bias = token.length() - i.key().length();
-            return true;
-        }
-        ++i;
+        newFormula.replace(position, token.length(), i.value());
+        bias = token.length() - i.value().length();
+        return true;
     }
     return false;
 }
@@ -98,14 +96,7 @@ bool VTranslateMeasurements::MeasurementsFromUser(QString &newFormula, int posit
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateMeasurements::MToUser(const QString &measurement) const
 {
-    if (measurements.contains(measurement))
-    {
-        return measurements.value(measurement).translate();
-    }
-    else
-    {
-        return measurement;
-    }
+    return measurementsToUser.value(measurement, measurement);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -184,6 +175,39 @@ void VTranslateMeasurements::InitMeasurements()
     InitGroupO(); // Men & Tailoring
     InitGroupP(); // Historical & Specialty
     InitGroupQ(); // Patternmaking measurements
+
+    InitTranslationIndexes(measurements, measurementsToUser, measurementsFromUser);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief InitTranslationIndexes translate all names once for current locale.
+ *
+ * Formula translation looks names up in these hashes instead of translating every known name for each token. If
+ * two names have the same translation the first one in map order wins, like the former linear search.
+ * @param translations internal name -> translation.
+ * @param toUser [out] internal name -> translated name.
+ * @param fromUser [out] translated name -> internal name.
+ */
+void VTranslateMeasurements::InitTranslationIndexes(const QMap<QString, qmu::QmuTranslation> &translations,
+                                                    QHash<QString, QString> &toUser, QHash<QString, QString> &fromUser)
+{
+    toUser.clear();
+    fromUser.clear();
+    toUser.reserve(translations.size());
+    fromUser.reserve(translations.size());
+
+    auto i = translations.constBegin();
+    while (i != translations.constEnd())
+    {
+        const QString translated = i.value().translate();
+        toUser.insert(i.key(), translated);
+        if (not fromUser.contains(translated))
+        {
+            fromUser.insert(translated, i.key());
+        }
+        ++i;
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -52,6 +52,7 @@
 #ifndef VTRANSLATEMEASUREMENTS_H
 #define VTRANSLATEMEASUREMENTS_H
 
+#include <QHash>
 #include <QMap>
 #include <QString>
 #include <QtGlobal>
@@ -77,6 +78,12 @@ class VTranslateMeasurements
 protected:
     QMap<QString, qmu::QmuTranslation> measurements;
 
+    /** @brief measurementsToUser internal name -> translated name for current locale. */
+    QHash<QString, QString> measurementsToUser;
+
+    static void InitTranslationIndexes(const QMap<QString, qmu::QmuTranslation> &translations,
+                                       QHash<QString, QString> &toUser, QHash<QString, QString> &fromUser);
+
 private:
     Q_DISABLE_COPY(VTranslateMeasurements)
     QMap<QString, qmu::QmuTranslation> guiTexts;
@@ -84,6 +91,9 @@ class VTranslateMeasurements
     QMap<QString, QString> numbers;
     QMap<QString, QString> formulas;
 
+    /** @brief measurementsFromUser translated name -> internal name for current locale. */
+    QHash<QString, QString> measurementsFromUser;
+
     void InitGroupA(); // Direct Height
     void InitGroupB(); // Direct Width
     void InitGroupC(); // Indentation
@@ -78,7 +78,12 @@ VTranslateVars::VTranslateVars()
       functions(QMap<QString, qmu::QmuTranslation>()),
       postfixOperators(QMap<QString, qmu::QmuTranslation>()),
       placeholders(QMap<QString, qmu::QmuTranslation>()),
-      stDescriptions(QMap<QString, qmu::QmuTranslation>())
+      stDescriptions(QMap<QString, qmu::QmuTranslation>()),
+      translatedVariables(),
+      functionsToUser(),
+      functionsFromUser(),
+      postfixOperatorsToUser(),
+      postfixOperatorsFromUser()
 {
     InitPatternMakingSystems();
     InitVariables();
@@ -427,6 +432,16 @@ void VTranslateVars::InitVariables()
                                                 "Do not add symbol _ to the end of the name"));
     variables.insert(c2LengthSplPath, translate("VTranslateVars", "C2LengthSplPath",
                                                 "Do not add symbol _ to the end of the name"));
+
+    // Variables are prefixes, they can't be found by hash. Translate them once at least.
+    translatedVariables.clear();
+    translatedVariables.reserve(variables.size());
+    auto i = variables.constBegin();
+    while (i != variables.constEnd())
+    {
+        translatedVariables.append(qMakePair(i.key(), i.value().translate()));
+        ++i;
+    }
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -467,6 +482,8 @@ void VTranslateVars::InitFunctions()
     functions.insert(avg_F, translate("VTranslateVars", "avg", "mean value of all arguments"));
     functions.insert(fmod_F, translate("VTranslateVars", "fmod",
                                        "Returns the floating-point remainder of numer/denom (rounded towards zero)"));
+
+    InitTranslationIndexes(functions, functionsToUser, functionsFromUser);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -475,6 +492,8 @@ void VTranslateVars::InitPostfixOperators()
     postfixOperators.insert(cm_Oprt, translate("VTranslateVars", "cm", "centimeter"));
     postfixOperators.insert(mm_Oprt, translate("VTranslateVars", "mm", "millimeter"));
     postfixOperators.insert(in_Oprt, translate("VTranslateVars", "in", "inch"));
+
+    InitTranslationIndexes(postfixOperators, postfixOperatorsToUser, postfixOperatorsFromUser);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -582,30 +601,23 @@ void VTranslateVars::BiasTokens(int position, int bias, QMap<int, QString> &toke
  */
 bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
-    const QString currentLengthTr = variables.value(currentLength).translate();
-    const QString currentSeamAllowanceTr = variables.value(currentSeamAllowance).translate();
-
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = variables.constBegin();
-    while (i != variables.constEnd())
+    for (auto &var : translatedVariables)
     {
-        const qmu::QmuTranslation &var = i.value();
-        const QString varTr = var.translate();
+        const QString &varTr = var.second;
 
-        if (token.indexOf(varTr) == 0)
+        if (token.startsWith(varTr))
         {
-            if ((varTr == currentLengthTr || varTr == currentSeamAllowanceTr) && token != varTr)
+            if ((var.first == currentLength || var.first == currentSeamAllowance) && token != varTr)
             {
-                ++i;
                 continue;
             }
 
-            newFormula.replace(position, varTr.length(), i.key());
+            newFormula.replace(position, varTr.length(), var.first);
             QString newToken = token;
-            newToken.replace(0, varTr.length(), i.key());
+            newToken.replace(0, varTr.length(), var.first);
             bias = token.length() - newToken.length();
             return true;
         }
-        ++i;
     }
     return false;
 }
@@ -621,16 +633,12 @@ bool VTranslateVars::VariablesFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::PostfixOperatorsFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = postfixOperators.constBegin();
-    while (i != postfixOperators.constEnd())
+    auto i = postfixOperatorsFromUser.constFind(token);
+    if (i != postfixOperatorsFromUser.constEnd())
     {
-        if (token == i.value().translate())
-        {
-            newFormula.replace(position, token.length(), i.key());
-            bias = token.length() - i.key().length();
-            return true;
-        }
-        ++i;
+        newFormula.replace(position, token.length(), i.value());
+        bias = token.length() - i.value().length();
+        return true;
     }
     return false;
 }
@@ -646,16 +654,12 @@ bool VTranslateVars::PostfixOperatorsFromUser(QString &newFormula, int position,
  */
 bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = functions.constBegin();
-    while (i != functions.constEnd())
+    auto i = functionsFromUser.constFind(token);
+    if (i != functionsFromUser.constEnd())
     {
-        if (token == i.value().translate())
-        {
-            newFormula.replace(position, token.length(), i.key());
-            bias = token.length() - i.key().length();
-            return true;
-        }
-        ++i;
+        newFormula.replace(position, token.length(), i.value());
+        bias = token.length() - i.value().length();
+        return true;
     }
     return false;
 }
@@ -671,25 +675,22 @@ bool VTranslateVars::FunctionsFromUser(QString &newFormula, int position, const
  */
 bool VTranslateVars::VariablesToUser(QString &newFormula, int position, const QString &token, int &bias) const
 {
-    QMap<QString, qmu::QmuTranslation>::const_iterator i = variables.constBegin();
-    while (i != variables.constEnd())
+    for (auto &var : translatedVariables)
     {
-        if (token.indexOf( i.key() ) == 0)
+        if (token.startsWith(var.first))
         {
-            if ((i.key() == currentLength || i.key() == currentSeamAllowance) && token != i.key())
+            if ((var.first == currentLength || var.first == currentSeamAllowance) && token != var.first)
             {
-                ++i;
                 continue;
             }
 
-            newFormula.replace(position, i.key().length(), i.value().translate());
+            newFormula.replace(position, var.first.length(), var.second);
 
             QString newToken = token;
-            newToken.replace(0, i.key().length(), i.value().translate());
+            newToken.replace(0, var.first.length(), var.second);
             bias = token.length() - newToken.length();
             return true;
         }
-        ++i;
     }
     return false;
 }
@@ -761,19 +762,22 @@ QString VTranslateVars::PlaceholderFromUserText(QString text) const
 //---------------------------------------------------------------------------------------------------------------------
 QString VTranslateVars::VarToUser(const QString &var) const
 {
-    if (measurements.contains(var))
+    auto i = measurementsToUser.constFind(var);
+    if (i != measurementsToUser.constEnd())
     {
-        return measurements.value(var).translate();
+        return i.value();
     }
 
-    if (functions.contains(var))
+    i = functionsToUser.constFind(var);
+    if (i != functionsToUser.constEnd())
     {
-        return functions.value(var).translate();
+        return i.value();
     }
 
-    if (postfixOperators.contains(var))
+    i = postfixOperatorsToUser.constFind(var);
+    if (i != postfixOperatorsToUser.constEnd())
     {
-        return postfixOperators.value(var).translate();
+        return i.value();
     }
 
     return InternalVarToUser(var);
@@ -828,7 +832,7 @@ QString VTranslateVars::PMSystemBook(const QString &code) const
 // cppcheck-suppress unusedFunction
 QString VTranslateVars::PostfixOperator(const QString &name) const
 {
-    return postfixOperators.value(name).translate();
+    return postfixOperatorsToUser.value(name);
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -991,10 +995,11 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
     QList<QString> tValues = tokens.values();
     for (int i = 0; i < tKeys.size(); ++i)
     {
-        if (measurements.contains(tValues.at(i)))
+        auto translated = measurementsToUser.constFind(tValues.at(i));
+        if (translated != measurementsToUser.constEnd())
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), measurements.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - measurements.value(tValues.at(i)).translate().length();
+            newFormula.replace(tKeys.at(i), tValues.at(i).length(), translated.value());
+            int bias = tValues.at(i).length() - translated.value().length();
             if (bias != 0)
             {// Translated token has different length than original. Position next tokens need to be corrected.
                 CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
@@ -1004,10 +1009,11 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
             continue;
         }
 
-        if (functions.contains(tValues.at(i)))
+        translated = functionsToUser.constFind(tValues.at(i));
+        if (translated != functionsToUser.constEnd())
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), functions.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - functions.value(tValues.at(i)).translate().length();
+            newFormula.replace(tKeys.at(i), tValues.at(i).length(), translated.value());
+            int bias = tValues.at(i).length() - translated.value().length();
             if (bias != 0)
             {// Translated token has different length than original. Position next tokens need to be corrected.
                 CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
@@ -1017,10 +1023,11 @@ QString VTranslateVars::FormulaToUser(const QString &formula, bool osSeparator)
             continue;
         }
 
-        if (postfixOperators.contains(tValues.at(i)))
+        translated = postfixOperatorsToUser.constFind(tValues.at(i));
+        if (translated != postfixOperatorsToUser.constEnd())
         {
-            newFormula.replace(tKeys.at(i), tValues.at(i).length(), postfixOperators.value(tValues.at(i)).translate());
-            int bias = tValues.at(i).length() - postfixOperators.value(tValues.at(i)).translate().length();
+            newFormula.replace(tKeys.at(i), tValues.at(i).length(), translated.value());
+            int bias = tValues.at(i).length() - translated.value().length();
             if (bias != 0)
             {// Translated token has different length than original. Position next tokens need to be corrected.
                 CorrectionsPositions(tKeys.at(i), bias, tokens, numbers);
@@ -53,6 +53,8 @@
 #define VTRANSLATEVARS_H
 
 #include <qcompilerdetection.h>
+#include <QPair>
+#include <QVector>
 #include <QtGlobal>
 
 #include "vtranslatemeasurements.h"
@@ -104,6 +106,13 @@ class VTranslateVars : public VTranslateMeasurements
     QMap<QString, qmu::QmuTranslation> placeholders;
     QMap<QString, qmu::QmuTranslation> stDescriptions;
 
+    /** @brief translatedVariables pairs internal prefix, translated prefix in map order for current locale. */
+    QVector<QPair<QString, QString>>   translatedVariables;
+    QHash<QString, QString>            functionsToUser;
+    QHash<QString, QString>            functionsFromUser;
+    QHash<QString, QString>            postfixOperatorsToUser;
+    QHash<QString, QString>            postfixOperatorsFromUser;
+
     void InitPatternMakingSystems();
     void InitVariables();
     void InitFunctions();
@@ -0,0 +1,312 @@
+/***************************************************************************
+ **  @file   vversionedhash.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VVERSIONEDHASH_H
+#define VVERSIONEDHASH_H
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QPair>
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <memory>
+
+#include "../vmisc/def.h"
+
+/**
+ * @brief The VVersionedHash class is a hash whose copies are cheap version handles.
+ *
+ * All copies share one store. The store keeps the newest values (head) and a per key log of changes, so a copy
+ * only remembers the version it was made at. Reading at the newest version is a plain hash lookup, reading an older
+ * version is a binary search in the key's log. Writing through an older handle starts a new store from that
+ * version, other handles never see the change.
+ *
+ * Values must be shared pointers, a null value marks a removed key in the log.
+ *
+ * hash() returns values by value. At the newest version it is an implicitly shared copy of head, a caller that keeps it
+ * across a write makes the write copy the whole hash. Nothing of head is cached in the handle, so copies of a handle
+ * never hold head alive.
+ */
+template <typename Key, typename T>
+class VVersionedHash
+{
+public:
+    VVersionedHash();
+    VVersionedHash(const VVersionedHash &other);
+
+    bool contains(const Key &key) const;
+    T    value(const Key &key) const;
+    bool isEmpty() const;
+    int  size() const;
+
+    QHash<Key, T> hash() const;
+
+    void insert(const Key &key, const T &value);
+    void remove(const Key &key);
+    void clear();
+
+private:
+    VVersionedHash &operator=(const VVersionedHash &) Q_DECL_EQ_DELETE;
+
+    typedef QPair<quint32, T> Change;
+
+    struct Store
+    {
+        Store()
+            : head(),
+              base(),
+              log(),
+              logSize(0),
+              headVersion(0)
+        {}
+
+        /** @brief head values at headVersion. */
+        QHash<Key, T> head;
+        /** @brief base values at version 0. */
+        QHash<Key, T> base;
+        /** @brief log changes since base, sorted by version for each key. */
+        QHash<Key, QVector<Change>> log;
+        int     logSize;
+        quint32 headVersion;
+    };
+
+    std::shared_ptr<Store> store;
+    quint32 version;
+
+    /** @brief materialized values of an older version, built on first request. Never a copy of head. */
+    mutable std::shared_ptr<const QHash<Key, T>> materialized;
+    mutable QMutex materializeMutex;
+
+    bool IsHead() const;
+    T    ValueAt(const Key &key, bool *found) const;
+    QHash<Key, T> Materialize() const;
+    void PrepareWrite();
+    void Rebase(const QHash<Key, T> &values);
+    void Log(const Key &key, const T &value);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+VVersionedHash<Key, T>::VVersionedHash()
+    : store(std::make_shared<Store>()),
+      version(0),
+      materialized(),
+      materializeMutex()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+VVersionedHash<Key, T>::VVersionedHash(const VVersionedHash &other)
+    : store(other.store),
+      version(other.version),
+      materialized(),
+      materializeMutex()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+bool VVersionedHash<Key, T>::contains(const Key &key) const
+{
+    if (IsHead())
+    {
+        return store->head.contains(key);
+    }
+
+    bool found = false;
+    ValueAt(key, &found);
+    return found;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+T VVersionedHash<Key, T>::value(const Key &key) const
+{
+    if (IsHead())
+    {
+        return store->head.value(key);
+    }
+
+    bool found = false;
+    return ValueAt(key, &found);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+bool VVersionedHash<Key, T>::isEmpty() const
+{
+    return IsHead() ? store->head.isEmpty() : hash().isEmpty();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+int VVersionedHash<Key, T>::size() const
+{
+    return IsHead() ? store->head.size() : hash().size();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief hash returns all values at this version. Writes through any handle never change the returned hash. At the
+ * newest version it shares head. An older version is built once and kept until the handle itself writes.
+ */
+template <typename Key, typename T>
+QHash<Key, T> VVersionedHash<Key, T>::hash() const
+{
+    if (IsHead())
+    {
+        return store->head;
+    }
+
+    QMutexLocker locker(&materializeMutex);
+    if (not materialized)
+    {
+        materialized = std::make_shared<const QHash<Key, T>>(Materialize());
+    }
+    return *materialized;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::insert(const Key &key, const T &value)
+{
+    SCASSERT(not value.isNull())
+    PrepareWrite();
+    store->head.insert(key, value);
+    Log(key, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::remove(const Key &key)
+{
+    PrepareWrite();
+    if (store->head.remove(key) > 0)
+    {
+        Log(key, T());
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::clear()
+{
+    store = std::make_shared<Store>();
+    version = 0;
+    materialized.reset();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+bool VVersionedHash<Key, T>::IsHead() const
+{
+    return version == store->headVersion;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+T VVersionedHash<Key, T>::ValueAt(const Key &key, bool *found) const
+{
+    const auto changes = store->log.constFind(key);
+    if (changes != store->log.constEnd())
+    {
+        const quint32 at = version;
+        auto next = std::upper_bound(changes.value().constBegin(), changes.value().constEnd(), at,
+                                     [](quint32 v, const Change &change) { return v < change.first; });
+        if (next != changes.value().constBegin())
+        {
+            const T &value = (next - 1)->second;
+            *found = not value.isNull();
+            return value;
+        }
+    }
+
+    const auto baseValue = store->base.constFind(key);
+    *found = baseValue != store->base.constEnd();
+    return *found ? baseValue.value() : T();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+QHash<Key, T> VVersionedHash<Key, T>::Materialize() const
+{
+    QHash<Key, T> values = store->base;
+    for (auto i = store->log.constBegin(); i != store->log.constEnd(); ++i)
+    {
+        bool found = false;
+        const T value = ValueAt(i.key(), &found);
+        if (found)
+        {
+            values.insert(i.key(), value);
+        }
+        else
+        {
+            values.remove(i.key());
+        }
+    }
+    return values;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::PrepareWrite()
+{
+    if (not IsHead())
+    {
+        // Somebody wrote after this version, continue from a store of our own.
+        const QHash<Key, T> values = hash();
+        materialized.reset();
+        Rebase(values);
+        return;
+    }
+
+    if (store->logSize > qMax(store->head.size(), 64))
+    {
+        // Keep the log proportional to the data. Older handles keep the old store alive.
+        Rebase(store->head);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::Rebase(const QHash<Key, T> &values)
+{
+    std::shared_ptr<Store> fresh = std::make_shared<Store>();
+    fresh->base = values;
+    fresh->head = values;
+    store = fresh;
+    version = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+template <typename Key, typename T>
+void VVersionedHash<Key, T>::Log(const Key &key, const T &value)
+{
+    ++store->headVersion;
+    store->log[key].append(qMakePair(store->headVersion, value));
+    ++store->logSize;
+    version = store->headVersion;
+}
+
+#endif // VVERSIONEDHASH_H
@@ -205,7 +205,7 @@ void DialogEditWrongFormula::ValChanged(int row)
         const QString name = qApp->TrVars()->VarFromUser(item->text());
         const QSharedPointer<VMeasurement> measurements = data->GetVariable<VMeasurement>(name);
         const QString desc = (measurements->GetGuiText() == "") ? "" : QString("\nDescription: %1").arg(measurements->GetGuiText());
-        setDescription(item->text(), *data->DataVariables()->value(name)->GetValue(),
+        setDescription(item->text(), *data->DataVariables().value(name)->GetValue(),
                        UnitsToStr(qApp->patternUnit(), true), tr("Measurement"), desc);
         return;
     }
@@ -213,7 +213,7 @@ void DialogEditWrongFormula::ValChanged(int row)
     {
         const QSharedPointer<VIncrement> variables = data->GetVariable<VIncrement>(item->text());
         const QString desc =(variables->GetDescription() == "") ? "" : QString("\nDescription: %1").arg(variables->GetDescription());
-        setDescription(item->text(), *data->DataVariables()->value(item->text())->GetValue(),
+        setDescription(item->text(), *data->DataVariables().value(item->text())->GetValue(),
                        UnitsToStr(qApp->patternUnit(), true), tr("Custom Variable"), desc);
         return;
     }
@@ -259,7 +259,7 @@ void DialogTool::FillComboBoxSplines(QComboBox *box) const
     const auto objs = data->DataGObjects();
     QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
-    for (i = objs->constBegin(); i != objs->constEnd(); ++i)
+    for (i = objs.constBegin(); i != objs.constEnd(); ++i)
     {
         if (i.key() != toolId)
         {
@@ -283,7 +283,7 @@ void DialogTool::FillComboBoxSplinesPath(QComboBox *box) const
     const auto objs = data->DataGObjects();
     QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
-    for (i = objs->constBegin(); i != objs->constEnd(); ++i)
+    for (i = objs.constBegin(); i != objs.constEnd(); ++i)
     {
         if (i.key() != toolId)
         {
@@ -305,7 +305,7 @@ void DialogTool::FillComboBoxCurves(QComboBox *box) const
     const auto objs = data->DataGObjects();
     QMap<QString, quint32> list;
     QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
-    for (i = objs->constBegin(); i != objs->constEnd(); ++i)
+    for (i = objs.constBegin(); i != objs.constEnd(); ++i)
     {
         if (i.key() != toolId)
         {
@@ -1398,10 +1398,10 @@ void DialogTool::FillCombo(QComboBox *box, GOType gType, FillComboBox rule, cons
     SCASSERT(box != nullptr)
     box->blockSignals(true);
 
-    const QHash<quint32, QSharedPointer<VGObject> > *objs = data->DataGObjects();
+    const QHash<quint32, QSharedPointer<VGObject> > objs = data->DataGObjects();
     QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
     QMap<QString, quint32> list;
-    for (i = objs->constBegin(); i != objs->constEnd(); ++i)
+    for (i = objs.constBegin(); i != objs.constEnd(); ++i)
     {
         if (rule == FillComboBox::NoChildren)
         {
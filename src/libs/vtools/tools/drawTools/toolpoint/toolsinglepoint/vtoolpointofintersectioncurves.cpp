@@ -190,12 +190,7 @@ QPointF VToolPointOfIntersectionCurves::FindPoint(const QVector<QPointF> &curve1
         return QPointF();
     }
 
-    QVector<QPointF> intersections;
-    for ( auto i = 0; i < curve1Points.count()-1; ++i )
-    {
-        intersections << VAbstractCurve::CurveIntersectLine(curve2Points,
-                                                            QLineF(curve1Points.at(i), curve1Points.at(i+1)));
-    }
+    const QVector<QPointF> intersections = VAbstractCurve::CurvesIntersection(curve1Points, curve2Points);
 
     if (intersections.isEmpty())
     {
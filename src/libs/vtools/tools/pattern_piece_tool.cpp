@@ -67,6 +67,7 @@
 #include "../vgeometry/vpointf.h"
 #include "../vgeometry/vspline.h"
 #include "../vgeometry/vsplinepath.h"
+#include "../vmisc/vcommonsettings.h"
 #include "../vpatterndb/vpiecenode.h"
 #include "../vpatterndb/vpiecepath.h"
 #include "../vpatterndb/calculator.h"
@@ -77,6 +78,7 @@
 #include "../undocommands/addpiece.h"
 #include "../undocommands/deletepiece.h"
 #include "../undocommands/movepiece.h"
+#include "../undocommands/savepiecefloatitems.h"
 #include "../undocommands/savepieceoptions.h"
 #include "../undocommands/togglepieceinlayout.h"
 #include "../undocommands/toggle_piecelock.h"
@@ -623,6 +625,23 @@ void PatternPieceTool::updatePieceDetails()
     UpdatePatternLabel();
     UpdateGrainline();
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateFloatItems takes the piece label, pattern label and grainline data from piece and redraws them
+ * without reparsing the pattern.
+ */
+void PatternPieceTool::updateFloatItems(const VPiece &piece)
+{
+    VPiece current = VAbstractTool::data.GetPiece(m_id);
+    current.GetPatternPieceData() = piece.GetPatternPieceData();
+    current.GetPatternInfo() = piece.GetPatternInfo();
+    current.GetGrainlineGeometry() = piece.GetGrainlineGeometry();
+    VAbstractTool::data.UpdatePiece(m_id, current);
+
+    updatePieceDetails();
+    update();
+}
 //---------------------------------------------------------------------------------------------------------------------
 /**
  * @brief UpdateLabel updates the text label, making it just big enough for the text to fit it
@@ -723,9 +742,8 @@ void PatternPieceTool::saveMovePiece(const QPointF &ptPos)
     VPiece newPiece = oldPiece;
     newPiece.GetPatternPieceData().SetPos(ptPos);
 
-    SavePieceOptions *moveCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *moveCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     moveCommand->setText(tr("move pattern piece label"));
-    connect(moveCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(moveCommand);
 }
 
@@ -744,9 +762,8 @@ void PatternPieceTool::saveResizePiece(qreal dLabelW, int iFontSize)
     newPiece.GetPatternPieceData().SetLabelHeight(QString().setNum(height));
     newPiece.GetPatternPieceData().SetFontSize(iFontSize);
 
-    SavePieceOptions *resizeCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *resizeCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     resizeCommand->setText(tr("resize pattern piece label"));
-    connect(resizeCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(resizeCommand);
 }
 
@@ -766,9 +783,8 @@ void PatternPieceTool::savePieceRotation(qreal dRot)
     line.setAngle(-dRot);
     newPiece.GetPatternPieceData().SetRotation(QString().setNum(line.angle()));
 
-    SavePieceOptions *rotateCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *rotateCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     rotateCommand->setText(tr("rotate pattern piece label"));
-    connect(rotateCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(rotateCommand);
 }
 
@@ -783,9 +799,8 @@ void PatternPieceTool::SaveMovePattern(const QPointF &ptPos)
     VPiece newPiece = oldPiece;
     newPiece.GetPatternInfo().SetPos(ptPos);
 
-    SavePieceOptions *moveCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *moveCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     moveCommand->setText(tr("move pattern info label"));
-    connect(moveCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(moveCommand);
 }
 
@@ -804,9 +819,8 @@ void PatternPieceTool::SaveResizePattern(qreal dLabelW, int iFontSize)
     newPiece.GetPatternInfo().SetLabelHeight(QString().setNum(height));
     newPiece.GetPatternInfo().SetFontSize(iFontSize);
 
-    SavePieceOptions *resizeCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *resizeCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     resizeCommand->setText(tr("resize pattern info label"));
-    connect(resizeCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(resizeCommand);
 }
 
@@ -824,9 +838,8 @@ void PatternPieceTool::SaveRotationPattern(qreal dRot)
     line.setAngle(-dRot);
     newPiece.GetPatternInfo().SetRotation(QString().setNum(line.angle()));
 
-    SavePieceOptions *rotateCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *rotateCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     rotateCommand->setText(tr("rotate pattern info label"));
-    connect(rotateCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(rotateCommand);
 }
 
@@ -839,9 +852,8 @@ void PatternPieceTool::SaveMoveGrainline(const QPointF &ptPos)
     newPiece.GetGrainlineGeometry().SetPos(ptPos);
     qDebug() << "******* new grainline pos" << ptPos;
 
-    SavePieceOptions *moveCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *moveCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     moveCommand->setText(tr("move grainline"));
-    connect(moveCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(moveCommand);
 }
 
@@ -854,9 +866,8 @@ void PatternPieceTool::SaveResizeGrainline(qreal dLength)
     dLength = FromPixel(dLength, *VDataTool::data.GetPatternUnit());
     newPiece.GetGrainlineGeometry().SetPos(m_grainLine->pos());
     newPiece.GetGrainlineGeometry().SetLength(QString().setNum(dLength));
-    SavePieceOptions *resizeCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *resizeCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     resizeCommand->setText(tr("resize grainline"));
-    connect(resizeCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(resizeCommand);
 }
 
@@ -868,9 +879,8 @@ void PatternPieceTool::SaveRotateGrainline(qreal dRot, const QPointF &ptPos)
 
     newPiece.GetGrainlineGeometry().SetRotation(QString().setNum(qRadiansToDegrees(dRot)));
     newPiece.GetGrainlineGeometry().SetPos(ptPos);
-    SavePieceOptions *rotateCommand = new SavePieceOptions(oldPiece, newPiece, doc, m_id);
+    SavePieceFloatItems *rotateCommand = new SavePieceFloatItems(oldPiece, newPiece, doc, m_id);
     rotateCommand->setText(tr("rotate grainline"));
-    connect(rotateCommand, &SavePieceOptions::NeedLiteParsing, doc, &VAbstractPattern::LiteParseTree);
     qApp->getUndoStack()->push(rotateCommand);
 }
 
@@ -880,61 +890,84 @@ void PatternPieceTool::SaveRotateGrainline(qreal dRot, const QPointF &ptPos)
  */
 void PatternPieceTool::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
-    QColor  color;
-    QString lineType;
-    qreal   lineWeight;
+    const qreal scale = sceneScale(scene());
+    if (not m_style.isValid || not VFuzzyComparePossibleNulls(m_style.sceneScale, scale))
+    {
+        updateStyle(scale);
+    }
+
+    if (m_style.showSeamAllowances)
+    {
+        // Fill pattern must not follow zoom, only the brush transformation depends on the painter.
+        QBrush brush = m_style.brush;
+        brush.setTransform(painter->combinedTransform().inverted());
+        m_seamLine->setBrush(brush);
+        this->setBrush(brush);
+    }
+
+    if ((m_dataLabel->IsIdle() == false
+            || m_patternInfo->IsIdle() == false
+            || m_grainLine->IsIdle() == false) && not isSelected())
+    {
+        setSelected(true);
+    }
+    QGraphicsPathItem::paint(painter, option, widget);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief invalidateStyle drop cached pens and brush, next paint will read settings and the piece again.
+ */
+void PatternPieceTool::invalidateStyle()
+{
+    m_style.isValid = false;
+    update();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief updateStyle read settings and the piece once and set pens of the cut line, seam line and notches.
+ * @param scale current scene scale.
+ */
+void PatternPieceTool::updateStyle(qreal scale)
+{
+    const VCommonSettings *settings = qApp->Settings();
 
     //set cutline pen
-    color      = QColor(qApp->Settings()->getDefaultCutColor());
-    lineType   = qApp->Settings()->getDefaultCutLinetype();
-    lineWeight = ToPixel(qApp->Settings()->getDefaultCutLineweight(), Unit::Mm);
+    QColor  color      = QColor(settings->getDefaultCutColor());
+    QString lineType   = settings->getDefaultCutLinetype();
+    qreal   lineWeight = ToPixel(settings->getDefaultCutLineweight(), Unit::Mm);
 
-    m_cutLine->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
-                           lineTypeToPenStyle(lineType), Qt::RoundCap, Qt::RoundJoin));
+    m_cutLine->setPen(QPen(color, scaleWidth(lineWeight, scale), lineTypeToPenStyle(lineType), Qt::RoundCap,
+                           Qt::RoundJoin));
     m_cutLine->setZValue(-10);
 
     //set seamline pen
-    const VPiece piece = VAbstractTool::data.GetPiece(m_id);
-
-    if (qApp->Settings()->showSeamAllowances())
+    m_style.showSeamAllowances = settings->showSeamAllowances();
+    if (m_style.showSeamAllowances)
     {
+        const VPiece piece = VAbstractTool::data.GetPiece(m_id);
+
         if (piece.IsSeamAllowance() && !piece.IsSeamAllowanceBuiltIn())
         {
-            color      = QColor(qApp->Settings()->getDefaultSeamColor());
-            lineType   = qApp->Settings()->getDefaultSeamLinetype();
-            lineWeight = ToPixel(qApp->Settings()->getDefaultSeamLineweight(), Unit::Mm);
-        }
-        else
-        {
-            color      = QColor(qApp->Settings()->getDefaultCutColor());
-            lineType   = qApp->Settings()->getDefaultCutLinetype();
-            lineWeight = ToPixel(qApp->Settings()->getDefaultCutLineweight(), Unit::Mm);
+            color      = QColor(settings->getDefaultSeamColor());
+            lineType   = settings->getDefaultSeamLinetype();
+            lineWeight = ToPixel(settings->getDefaultSeamLineweight(), Unit::Mm);
         }
 
-        m_seamLine->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
-                                lineTypeToPenStyle(lineType), Qt::RoundCap, Qt::RoundJoin));
+        m_seamLine->setPen(QPen(color, scaleWidth(lineWeight, scale), lineTypeToPenStyle(lineType), Qt::RoundCap,
+                                Qt::RoundJoin));
 
-        QBrush brush = QBrush(QColor(piece.getColor()));
-        brush.setStyle(static_cast<Qt::BrushStyle>(fills().indexOf(QRegExp(piece.getFill()))));
-        brush.setTransform(brush.transform().scale(150.0, 150.0));
-        brush.setTransform(painter->combinedTransform().inverted());
-        m_seamLine->setBrush(brush);
-        this->setBrush(brush);
+        m_style.brush = QBrush(QColor(piece.getColor()));
+        m_style.brush.setStyle(static_cast<Qt::BrushStyle>(fills().indexOf(QRegExp(piece.getFill()))));
     }
 
     //set notches pen
-    color = QColor(qApp->Settings()->getDefaultNotchColor());
-    m_notches->setPen(QPen(color, scaleWidth(lineWeight, sceneScale(scene())),
-                           Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
-
+    color = QColor(settings->getDefaultNotchColor());
+    m_notches->setPen(QPen(color, scaleWidth(lineWeight, scale), Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin));
 
-    if ((m_dataLabel->IsIdle() == false
-            || m_patternInfo->IsIdle() == false
-            || m_grainLine->IsIdle() == false) && not isSelected())
-    {
-        setSelected(true);
-    }
-    QGraphicsPathItem::paint(painter, option, widget);
+    m_style.sceneScale = scale;
+    m_style.isValid = true;
 }
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -1446,6 +1479,7 @@ PatternPieceTool::PatternPieceTool(VAbstractPattern *doc, VContainer *data, cons
     , m_patternInfo(new VTextGraphicsItem(this))
     , m_grainLine(new VGrainlineItem(this))
     , m_notches(new QGraphicsPathItem(this))
+    , m_style()
 {
     VPiece piece = data->GetPiece(id);
     initializeNodes(piece, scene);
@@ -1481,6 +1515,7 @@ PatternPieceTool::PatternPieceTool(VAbstractPattern *doc, VContainer *data, cons
 
     connect(m_pieceScene, &VMainGraphicsScene::DimensionsChanged, this, &PatternPieceTool::updatePieceDetails);
     connect(m_pieceScene, &VMainGraphicsScene::LanguageChanged,   this, &PatternPieceTool::retranslateUi);
+    connect(qApp->Settings(), &VCommonSettings::styleChanged,     this, &PatternPieceTool::invalidateStyle);
 
     updatePieceDetails();
 }
@@ -1506,6 +1541,7 @@ void PatternPieceTool::UpdateExcludeState()
 //---------------------------------------------------------------------------------------------------------------------
 void PatternPieceTool::RefreshGeometry()
 {
+    m_style.isValid = false;
     this->setFlag(QGraphicsItem::ItemSendsGeometryChanges, false);
     m_cutLine->setFlag(QGraphicsItem::ItemStacksBehindParent, true);
 
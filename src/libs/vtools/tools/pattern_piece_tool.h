@@ -115,6 +115,7 @@ class PatternPieceTool : public VInteractiveTool, public QGraphicsPathItem
     static void AddGrainline(VAbstractPattern *doc, QDomElement &domElement, const VPiece &piece);
 
     void                 RefreshGeometry();
+    void                 updateFloatItems(const VPiece &piece);
 
     virtual int          type() const Q_DECL_OVERRIDE {return Type;}
     enum                 { Type = UserType + static_cast<int>(Tool::Piece)};
@@ -143,6 +144,7 @@ public slots:
     void                 UpdatePatternLabel();
     void                 UpdateGrainline();
     void                 editPieceProperties();
+    void                 invalidateStyle();
 
 protected slots:
     void                 saveMovePiece(const QPointF &ptPos);
@@ -186,11 +188,22 @@ protected slots:
     VGrainlineItem        *m_grainLine;
     QGraphicsPathItem     *m_notches;
 
+    /** @brief PieceStyle pens and brush used by paint(), rebuilt only when settings, the piece or the zoom change. */
+    struct PieceStyle
+    {
+        bool   isValid{false};
+        qreal  sceneScale{0};
+        bool   showSeamAllowances{false};
+        QBrush brush{};
+    };
+    PieceStyle             m_style;
+
                            PatternPieceTool(VAbstractPattern *doc, VContainer *data, const quint32 &id,
                                               const Source &typeCreation, VMainGraphicsScene *scene,
                                               const QString &blockName, QGraphicsItem * parent = nullptr);
 
     void                  UpdateExcludeState();
+    void                  updateStyle(qreal scale);
     VPieceItem::MoveTypes FindLabelGeometry(const VPatternLabelData &labelData, qreal &rotationAngle, qreal &labelWidth,
                                             qreal &labelHeight, QPointF &pos);
 
@@ -1614,6 +1614,7 @@ void UnionTool::AddToModeling(const QDomElement &domElement)
     if (not modeling.isNull())
     {
         modeling.appendChild(domElement);
+        doc->RegisterElement(domElement);
     }
     else
     {
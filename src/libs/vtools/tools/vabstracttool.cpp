@@ -185,8 +185,7 @@ qreal VAbstractTool::CheckFormula(const quint32 &toolId, QString &formula, VCont
     qreal result = 0;
     try
     {
-        QScopedPointer<Calculator> cal(new Calculator());
-        result = cal->EvalFormula(data->DataVariables(), formula);
+        result = Calculator::EvalCachedFormula(data->FormulaVariables(), formula);
 
         if (qIsInf(result) || qIsNaN(result))
         {
@@ -222,7 +221,7 @@ qreal VAbstractTool::CheckFormula(const quint32 &toolId, QString &formula, VCont
                              * parsing here. */
                             delete dialog;
                             QScopedPointer<Calculator> cal1(new Calculator());
-                            result = cal1->EvalFormula(data->DataVariables(), formula);
+                            result = cal1->EvalFormula(data->FormulaVariables(), formula);
 
                             if (qIsInf(result) || qIsNaN(result))
                             {
@@ -501,10 +500,10 @@ const QStringList VAbstractTool::fills()
 // cppcheck-suppress unusedFunction
 QMap<QString, quint32> VAbstractTool::PointsList() const
 {
-    const QHash<quint32, QSharedPointer<VGObject> > *objs = data.DataGObjects();
+    const QHash<quint32, QSharedPointer<VGObject> > objs = data.DataGObjects();
     QMap<QString, quint32> list;
     QHash<quint32, QSharedPointer<VGObject> >::const_iterator i;
-    for (i = objs->constBegin(); i != objs->constEnd(); ++i)
+    for (i = objs.constBegin(); i != objs.constEnd(); ++i)
     {
         if (i.key() != m_id)
         {
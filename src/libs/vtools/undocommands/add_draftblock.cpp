@@ -85,6 +85,7 @@ void AddDraftBlock::undo()
         QDomElement rootElement = doc->documentElement();
         QDomElement draftBlock = doc->getDraftBlockElement(draftBlockName);
         rootElement.removeChild(draftBlock);
+        doc->UnregisterElement(draftBlock);
         emit NeedFullParsing();
     }
 }
@@ -102,6 +103,7 @@ void AddDraftBlock::redo()
     QDomElement rootElement = doc->documentElement();
 
     rootElement.appendChild(xml);
+    doc->RegisterElement(xml);
 
     RedoFullParsing();
 }
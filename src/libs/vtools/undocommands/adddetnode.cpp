@@ -86,6 +86,7 @@ void AddDetNode::undo()
                 qCDebug(vUndo, "Can't delete node.");
                 return;
             }
+            doc->UnregisterElement(domElement);
         }
         else
         {
@@ -109,6 +110,7 @@ void AddDetNode::redo()
     if (not modeling.isNull())
     {
         modeling.appendChild(xml);
+        doc->RegisterElement(xml);
     }
     else
     {
@@ -94,6 +94,7 @@ void AddGroup::undo()
                 qCDebug(vUndo, "Can't delete group.");
                 return;
             }
+            doc->UnregisterElement(group);
             emit UpdateGroups();
         }
         else
@@ -129,6 +130,7 @@ void AddGroup::redo()
     if (not groups.isNull())
     {
         groups.appendChild(xml);
+        doc->RegisterElement(xml);
         doc->ParseGroups(groups);
         emit UpdateGroups();
     }
@@ -85,6 +85,7 @@ void AddPiece::undo()
                 qCDebug(vUndo, "Can't delete node");
                 return;
             }
+            doc->UnregisterElement(domElement);
 
             DecrementReferences(m_piece.GetPath().GetNodes());
             DecrementReferences(m_piece.GetCustomSARecords());
@@ -114,6 +115,7 @@ void AddPiece::redo()
     if (not pieces.isNull())
     {
         pieces.appendChild(xml);
+        doc->RegisterElement(xml);
     }
     else
     {
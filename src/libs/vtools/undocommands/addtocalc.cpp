@@ -87,6 +87,7 @@ void AddToCalc::undo()
                 qCDebug(vUndo, "Can't delete node.");
                 return;
             }
+            doc->UnregisterElement(domElement);
         }
         else
         {
@@ -132,6 +133,7 @@ void AddToCalc::redo()
                 return;
             }
         }
+        doc->RegisterElement(xml);
     }
     else
     {
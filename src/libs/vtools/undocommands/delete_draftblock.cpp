@@ -106,6 +106,7 @@ void DeleteDraftBlock::undo()
         Q_ASSERT_X(not block.isNull(), Q_FUNC_INFO, "Couldn't' find tag draft block");
         rootElement.insertBefore(draftBlock, block);
     }
+    doc->RegisterElement(draftBlock);
 
     emit NeedFullParsing();
     doc->changeActiveDraftBlock(draftBlockName);
@@ -119,5 +120,6 @@ void DeleteDraftBlock::redo()
     QDomElement rootElement = doc->documentElement();
     const QDomElement draftBlock = doc->getDraftBlockElement(draftBlockName);
     rootElement.removeChild(draftBlock);
+    doc->UnregisterElement(draftBlock);
     emit NeedFullParsing();
 }
@@ -119,6 +119,7 @@ void DeletePiece::redo()
     if (domElement.isElement())
     {
         m_parentNode.removeChild(domElement);
+        doc->UnregisterElement(domElement);
 
         // Union delete two old pieces and create one new.
         // So when UnionDetail delete piece we can't use FullParsing. So we hide piece on scene directly.
@@ -94,5 +94,6 @@ void DelTool::redo()
     doc->setCurrentDraftBlock(activeBlockName);//Without this user will not see this change
     QDomElement domElement = doc->NodeById(nodeId);
     parentNode.removeChild(domElement);
+    doc->UnregisterElement(domElement);
     emit NeedFullParsing();
 }
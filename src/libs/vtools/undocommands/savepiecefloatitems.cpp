@@ -0,0 +1,127 @@
+/***************************************************************************
+ **  @file   savepiecefloatitems.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "savepiecefloatitems.h"
+
+#include <QDomElement>
+#include <QUndoCommand>
+
+#include "../ifc/xml/vabstractpattern.h"
+#include "../vmisc/logging.h"
+#include "../vmisc/def.h"
+#include "../tools/pattern_piece_tool.h"
+#include "vundocommand.h"
+
+namespace
+{
+typedef void (*WriteFloatItem)(VAbstractPattern *doc, QDomElement &domElement, const VPiece &piece);
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ReplaceFloatItem rewrites one label or grainline element of a piece, keeping its place among the children.
+ */
+void ReplaceFloatItem(VAbstractPattern *doc, QDomElement &domElement, const QString &tag, WriteFloatItem write,
+                      const VPiece &piece)
+{
+    const QDomElement oldItem = domElement.firstChildElement(tag);
+    write(doc, domElement, piece);
+
+    if (not oldItem.isNull())
+    {
+        domElement.insertBefore(domElement.lastChildElement(tag), oldItem);
+        domElement.removeChild(oldItem);
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+SavePieceFloatItems::SavePieceFloatItems(const VPiece &oldPiece, const VPiece &newPiece, VAbstractPattern *doc,
+                                         quint32 id, QUndoCommand *parent)
+    : VUndoCommand(QDomElement(), doc, parent)
+    , m_oldPiece(oldPiece)
+    , m_newPiece(newPiece)
+{
+    setText(tr("save piece labels"));
+    nodeId = id;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+SavePieceFloatItems::~SavePieceFloatItems()
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SavePieceFloatItems::undo()
+{
+    qCDebug(vUndo, "Undo.");
+    doCmd(m_oldPiece);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SavePieceFloatItems::redo()
+{
+    qCDebug(vUndo, "Redo.");
+    doCmd(m_newPiece);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool SavePieceFloatItems::mergeWith(const QUndoCommand *command)
+{
+    const SavePieceFloatItems *saveCommand = static_cast<const SavePieceFloatItems *>(command);
+    SCASSERT(saveCommand != nullptr);
+    const quint32 id = saveCommand->pieceId();
+
+    if (id != nodeId)
+    {
+        return false;
+    }
+
+    m_newPiece = saveCommand->getNewPiece();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int SavePieceFloatItems::id() const
+{
+    return static_cast<int>(UndoCommand::SavePieceFloatItems);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SavePieceFloatItems::doCmd(const VPiece &piece)
+{
+    QDomElement domElement = doc->elementById(nodeId, VAbstractPattern::TagPiece);
+    if (not domElement.isElement())
+    {
+        qCDebug(vUndo, "Can't find piece with id = %u.", nodeId);
+        return;
+    }
+
+    ReplaceFloatItem(doc, domElement, VAbstractPattern::TagData, &PatternPieceTool::AddPatternPieceData, piece);
+    ReplaceFloatItem(doc, domElement, VAbstractPattern::TagPatternInfo, &PatternPieceTool::AddPatternInfo, piece);
+    ReplaceFloatItem(doc, domElement, VAbstractPattern::TagGrainline, &PatternPieceTool::AddGrainline, piece);
+
+    PatternPieceTool *tool = qobject_cast<PatternPieceTool*>(VAbstractPattern::getTool(nodeId));
+    if (tool != nullptr)
+    {
+        tool->updateFloatItems(piece);
+    }
+}
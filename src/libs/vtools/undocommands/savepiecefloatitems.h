@@ -0,0 +1,74 @@
+/***************************************************************************
+ **  @file   savepiecefloatitems.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef SAVEPIECEFLOATITEMS_H
+#define SAVEPIECEFLOATITEMS_H
+
+#include <QtGlobal>
+
+#include "vpiece.h"
+#include "vundocommand.h"
+
+/**
+ * @brief The SavePieceFloatItems class saves piece label, pattern label and grainline geometry.
+ *
+ * Only the label and grainline elements of the piece are rewritten and only the owning tool is refreshed, so
+ * moving a label does not reparse the pattern.
+ */
+class SavePieceFloatItems : public VUndoCommand
+{
+public:
+                  SavePieceFloatItems(const VPiece &oldPiece, const VPiece &newPiece, VAbstractPattern *doc,
+                                      quint32 id, QUndoCommand *parent = nullptr);
+
+    virtual      ~SavePieceFloatItems();
+
+    virtual void  undo() Q_DECL_OVERRIDE;
+    virtual void  redo() Q_DECL_OVERRIDE;
+    virtual bool  mergeWith(const QUndoCommand *command) Q_DECL_OVERRIDE;
+    virtual int   id() const Q_DECL_OVERRIDE;
+    quint32       pieceId() const;
+    VPiece        getNewPiece() const;
+
+private:
+    Q_DISABLE_COPY(SavePieceFloatItems)
+
+    const VPiece  m_oldPiece;
+    VPiece        m_newPiece;
+
+    void          doCmd(const VPiece &piece);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+inline quint32 SavePieceFloatItems::pieceId() const
+{
+    return nodeId;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+inline VPiece SavePieceFloatItems::getNewPiece() const
+{
+    return m_newPiece;
+}
+
+#endif // SAVEPIECEFLOATITEMS_H
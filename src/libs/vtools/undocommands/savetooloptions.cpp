@@ -80,6 +80,8 @@ void SaveToolOptions::undo()
     if (domElement.isElement())
     {
         domElement.parentNode().replaceChild(oldXml, domElement);
+        doc->UnregisterElement(domElement);
+        doc->RegisterElement(oldXml);
 
         emit NeedLiteParsing(Document::LiteParse);
     }
@@ -99,6 +101,8 @@ void SaveToolOptions::redo()
     if (domElement.isElement())
     {
         domElement.parentNode().replaceChild(newXml, domElement);
+        doc->UnregisterElement(domElement);
+        doc->RegisterElement(newXml);
 
         emit NeedLiteParsing(Document::LiteParse);
     }
@@ -28,6 +28,7 @@ HEADERS += \
     $$PWD/deletepiece.h \
     $$PWD/movepiece.h \
     $$PWD/savepieceoptions.h \
+    $$PWD/savepiecefloatitems.h \
     $$PWD/togglepieceinlayout.h \
     $$PWD/savepiecepathoptions.h
 
@@ -58,5 +59,6 @@ SOURCES += \
     $$PWD/deletepiece.cpp \
     $$PWD/movepiece.cpp \
     $$PWD/savepieceoptions.cpp \
+    $$PWD/savepiecefloatitems.cpp \
     $$PWD/togglepieceinlayout.cpp \
     $$PWD/savepiecepathoptions.cpp
@@ -74,6 +74,7 @@ enum class UndoCommand: char { AddDraftBlock,
                                MoveSPoint,
                                SaveToolOptions,
                                SavePieceOptions,
+                               SavePieceFloatItems,
                                SavePiecePathOptions,
                                MovePiece,
                                deleteTool,
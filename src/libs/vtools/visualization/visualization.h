@@ -81,9 +81,9 @@ class Visualization : public QObject
     void                   SetMode(const Mode &value);
 
     static qreal           FindLength(const QString &expression, const QHash<QString,
-                                      QSharedPointer<VInternalVariable> > *vars);
+                                      QSharedPointer<VInternalVariable> > &vars);
     static qreal           FindVal(const QString &expression, const QHash<QString,
-                                   QSharedPointer<VInternalVariable> > *vars);
+                                   QSharedPointer<VInternalVariable> > &vars);
 
     QString                CurrentToolTip() const {return toolTip;}
 
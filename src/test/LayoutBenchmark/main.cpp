@@ -0,0 +1,198 @@
+/***************************************************************************
+ **  @file   main.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QDir>
+#include <QFile>
+#include <QJsonDocument>
+#include <QStringList>
+#include <QtGlobal>
+#include <cstdio>
+
+#include "vlayoutbenchmark.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void benchmarkMessageOutput(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    QByteArray localMsg = msg.toLocal8Bit();
+    switch (type)
+    {
+        case QtDebugMsg:
+        case QtInfoMsg:
+        case QtWarningMsg:
+            fprintf(stderr, "%s\n", localMsg.constData());
+            break;
+        case QtCriticalMsg:
+            fprintf(stderr, "Critical: %s (%s:%i, %s)\n", localMsg.constData(), context.file, context.line,
+                    context.function);
+            break;
+        case QtFatalMsg:
+            fprintf(stderr, "Fatal: %s (%s:%i, %s)\n", localMsg.constData(), context.file, context.line,
+                    context.function);
+            abort();
+        default:
+            break;
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(QStringLiteral("LayoutBenchmark"));
+    qInstallMessageHandler(benchmarkMessageOutput);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("Runs the layout generator over a corpus of piece sets and "
+                                                    "prints the wall time, tried placements, sheet count and fabric "
+                                                    "utilisation as JSON."));
+    parser.addHelpOption();
+    parser.addPositionalArgument(QStringLiteral("corpus"), QStringLiteral("Corpus files. By default all files "
+                                                                          "from the checked-in corpus."),
+                                 QStringLiteral("[corpus...]"));
+
+    const QCommandLineOption repeatOption(QStringList() << QStringLiteral("r") << QStringLiteral("repeat"),
+                                          QStringLiteral("Run each case <count> times and report the fastest run."),
+                                          QStringLiteral("count"), QStringLiteral("3"));
+    parser.addOption(repeatOption);
+
+    const QCommandLineOption attemptsOption(QStringList() << QStringLiteral("a") << QStringLiteral("attempts"),
+                                            QStringLiteral("Comma separated multi-start attempt counts. Attempt i "
+                                                           "uses seed i."),
+                                            QStringLiteral("list"), QStringLiteral("1,4"));
+    parser.addOption(attemptsOption);
+
+    const QCommandLineOption engineOption(QStringList() << QStringLiteral("e") << QStringLiteral("engine"),
+                                          QStringLiteral("Comma separated placement engines: edge, nfp. Each engine "
+                                                         "gets its own results."),
+                                          QStringLiteral("list"), QStringLiteral("edge,nfp"));
+    parser.addOption(engineOption);
+
+    const QCommandLineOption outputOption(QStringList() << QStringLiteral("o") << QStringLiteral("output"),
+                                          QStringLiteral("Write the report to <file> instead of stdout."),
+                                          QStringLiteral("file"));
+    parser.addOption(outputOption);
+
+    parser.process(app);
+
+    QStringList files = parser.positionalArguments();
+    if (files.isEmpty())
+    {
+        const QDir corpus(QStringLiteral(CORPUSDIR));
+        const QStringList entries = corpus.entryList(QStringList() << QStringLiteral("*.json"), QDir::Files,
+                                                     QDir::Name);
+        for (int i = 0; i < entries.size(); ++i)
+        {
+            files.append(corpus.absoluteFilePath(entries.at(i)));
+        }
+    }
+
+    VLayoutBenchmark benchmark;
+    benchmark.SetRepeat(parser.value(repeatOption).toInt());
+
+    QVector<int> attempts;
+    const QStringList attemptsList = parser.value(attemptsOption).split(QLatin1Char(','), QString::SkipEmptyParts);
+    for (int i = 0; i < attemptsList.size(); ++i)
+    {
+        bool ok = false;
+        const int value = attemptsList.at(i).trimmed().toInt(&ok);
+        if (not ok || value < 1)
+        {
+            qCritical() << "Invalid attempt count:" << attemptsList.at(i);
+            return 1;
+        }
+        attempts.append(value);
+    }
+    benchmark.SetAttempts(attempts);
+
+    QVector<LayoutEngine> engines;
+    const QStringList engineList = parser.value(engineOption).split(QLatin1Char(','), QString::SkipEmptyParts);
+    for (int i = 0; i < engineList.size(); ++i)
+    {
+        const QString name = engineList.at(i).trimmed();
+        if (name == VLayoutBenchmark::EngineName(LayoutEngine::EdgeToEdge))
+        {
+            engines.append(LayoutEngine::EdgeToEdge);
+        }
+        else if (name == VLayoutBenchmark::EngineName(LayoutEngine::NoFitPolygon))
+        {
+            engines.append(LayoutEngine::NoFitPolygon);
+        }
+        else
+        {
+            qCritical() << "Invalid engine:" << engineList.at(i);
+            return 1;
+        }
+    }
+
+    if (engines.isEmpty())
+    {
+        qCritical() << "No engines.";
+        return 1;
+    }
+    benchmark.SetEngines(engines);
+
+    if (files.isEmpty())
+    {
+        qCritical() << "No corpus files.";
+        return 1;
+    }
+
+    for (int i = 0; i < files.size(); ++i)
+    {
+        if (not benchmark.LoadCorpus(files.at(i)))
+        {
+            return 1;
+        }
+    }
+
+    const QJsonObject results = benchmark.Run();
+    const QByteArray report = QJsonDocument(results).toJson(QJsonDocument::Indented);
+
+    if (parser.isSet(outputOption))
+    {
+        QFile file(parser.value(outputOption));
+        if (not file.open(QIODevice::WriteOnly | QIODevice::Truncate) || file.write(report) != report.size())
+        {
+            qCritical() << "Can't write report to" << file.fileName() << ":" << file.errorString();
+            return 1;
+        }
+    }
+    else
+    {
+        fwrite(report.constData(), 1, static_cast<size_t>(report.size()), stdout);
+    }
+
+    // The report is still written, a layout that changes between runs fails the benchmark
+    if (not VLayoutBenchmark::IsStable(results))
+    {
+        qCritical() << "Layouts differ between runs of the same case.";
+        return 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,387 @@
+/***************************************************************************
+ **  @file   vlayoutbenchmark.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "vlayoutbenchmark.h"
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QMarginsF>
+#include <QPointF>
+#include <QRectF>
+#include <QStringList>
+#include <QThread>
+#include <QTransform>
+#include <QtDebug>
+
+#include "../vlayout/vbank.h"
+#include "../vlayout/vlayoutdef.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vposition.h"
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+qreal PolygonArea(const QVector<QPointF> &points)
+{
+    qreal sum = 0;
+    for (int i = 0; i < points.size(); ++i)
+    {
+        const QPointF &p1 = points.at(i);
+        const QPointF &p2 = points.at((i + 1) % points.size());
+        sum += p1.x() * p2.y() - p2.x() * p1.y();
+    }
+    return qAbs(sum / 2.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString LayoutStateName(LayoutErrors state)
+{
+    switch (state)
+    {
+        case LayoutErrors::NoError:
+            return QStringLiteral("NoError");
+        case LayoutErrors::PrepareLayoutError:
+            return QStringLiteral("PrepareLayoutError");
+        case LayoutErrors::ProcessStoped:
+            return QStringLiteral("ProcessStoped");
+        case LayoutErrors::EmptyPaperError:
+            return QStringLiteral("EmptyPaperError");
+    }
+    return QStringLiteral("Unknown");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LayoutSignature describes where every piece of a layout ended up, equal layouts have equal signatures.
+ */
+QStringList LayoutSignature(const QVector<QVector<VLayoutPiece>> &sheets)
+{
+    QStringList signature(QString::number(sheets.size()));
+    for (int i = 0; i < sheets.size(); ++i)
+    {
+        const QVector<VLayoutPiece> &pieces = sheets.at(i);
+        for (int j = 0; j < pieces.size(); ++j)
+        {
+            const QTransform m = pieces.at(j).getTransform();
+            const QStringList values = QStringList() << QString::number(i) << pieces.at(j).GetName()
+                                                     << QString::number(m.m11(), 'g', 12)
+                                                     << QString::number(m.m12(), 'g', 12)
+                                                     << QString::number(m.m21(), 'g', 12)
+                                                     << QString::number(m.m22(), 'g', 12)
+                                                     << QString::number(m.dx(), 'g', 12)
+                                                     << QString::number(m.dy(), 'g', 12)
+                                                     << QString::number(pieces.at(j).isMirror() ? 1 : 0);
+            signature.append(values.join(QLatin1Char(' ')));
+        }
+    }
+    return signature;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutBenchmark::VLayoutBenchmark()
+    : sets(),
+      repeat(3),
+      attempts({1, 4}),
+      engines({LayoutEngine::EdgeToEdge, LayoutEngine::NoFitPolygon})
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief LoadCorpus reads one piece set. Coordinates are in pixels, the same units the layout works with.
+ * @return false if the file can't be read or has no usable pieces.
+ */
+bool VLayoutBenchmark::LoadCorpus(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        qCritical() << tr("Can't open corpus file '%1': %2").arg(fileName, file.errorString());
+        return false;
+    }
+
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError || not document.isObject())
+    {
+        qCritical() << tr("Corpus file '%1' is not a valid JSON object: %2").arg(fileName, error.errorString());
+        return false;
+    }
+
+    const QJsonObject object = document.object();
+
+    PieceSet set;
+    set.name = object.value(QStringLiteral("name")).toString(QFileInfo(fileName).completeBaseName());
+    set.description = object.value(QStringLiteral("description")).toString();
+    set.paperWidth = object.value(QStringLiteral("paperWidth")).toDouble();
+    set.paperHeight = object.value(QStringLiteral("paperHeight")).toDouble();
+    set.layoutWidth = object.value(QStringLiteral("layoutWidth")).toDouble();
+
+    if (set.paperWidth <= 0 || set.paperHeight <= 0)
+    {
+        qCritical() << tr("Corpus file '%1' has invalid paper size.").arg(fileName);
+        return false;
+    }
+
+    const QJsonArray pieces = object.value(QStringLiteral("pieces")).toArray();
+    for (int i = 0; i < pieces.size(); ++i)
+    {
+        const QJsonObject pieceObject = pieces.at(i).toObject();
+        const QJsonArray pointsArray = pieceObject.value(QStringLiteral("points")).toArray();
+
+        QVector<QPointF> points;
+        points.reserve(pointsArray.size());
+        for (int j = 0; j < pointsArray.size(); ++j)
+        {
+            const QJsonArray point = pointsArray.at(j).toArray();
+            points.append(QPointF(point.at(0).toDouble(), point.at(1).toDouble()));
+        }
+
+        if (points.size() < 3)
+        {
+            qCritical() << tr("Piece %1 in corpus file '%2' doesn't have shape.").arg(i).arg(fileName);
+            return false;
+        }
+
+        VLayoutPiece piece;
+        piece.SetCountourPoints(points);
+        piece.SetName(pieceObject.value(QStringLiteral("name")).toString());
+        set.pieces.append(piece);
+        set.netArea += PolygonArea(points);
+    }
+
+    if (set.pieces.isEmpty())
+    {
+        qCritical() << tr("Corpus file '%1' has no pieces.").arg(fileName);
+        return false;
+    }
+
+    sets.append(set);
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int VLayoutBenchmark::GetRepeat() const
+{
+    return repeat;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetRepeat sets how many times each case runs. The report keeps the fastest run to reduce noise.
+ */
+void VLayoutBenchmark::SetRepeat(int value)
+{
+    repeat = qMax(1, value);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<int> VLayoutBenchmark::GetAttempts() const
+{
+    return attempts;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetAttempts sets the multi-start attempt counts to run every set with. Attempt i shuffles the pieces with
+ * seed i, so each count stands for a fixed list of seeds.
+ */
+void VLayoutBenchmark::SetAttempts(const QVector<int> &value)
+{
+    attempts = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<LayoutEngine> VLayoutBenchmark::GetEngines() const
+{
+    return engines;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief SetEngines sets the placement engines to run every set with. Each engine gets its own results.
+ */
+void VLayoutBenchmark::SetEngines(const QVector<LayoutEngine> &value)
+{
+    engines = value;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString VLayoutBenchmark::EngineName(LayoutEngine engine)
+{
+    switch (engine)
+    {
+        case LayoutEngine::EdgeToEdge:
+            return QStringLiteral("edge");
+        case LayoutEngine::NoFitPolygon:
+            return QStringLiteral("nfp");
+    }
+    return QStringLiteral("unknown");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QJsonObject VLayoutBenchmark::Run() const
+{
+    QJsonArray results;
+    for (int i = 0; i < sets.size(); ++i)
+    {
+        for (int e = 0; e < engines.size(); ++e)
+        {
+            for (int j = 0; j < attempts.size(); ++j)
+            {
+                results.append(RunSet(sets.at(i), engines.at(e), attempts.at(j)));
+            }
+        }
+    }
+
+    QJsonObject report;
+    report.insert(QStringLiteral("benchmark"), QStringLiteral("layout"));
+    report.insert(QStringLiteral("qtVersion"), QString(qVersion()));
+    report.insert(QStringLiteral("threads"), QThread::idealThreadCount());
+    report.insert(QStringLiteral("repeat"), repeat);
+    report.insert(QStringLiteral("results"), results);
+    return report;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IsStable checks that every case of a report gave the same layout in all repeats.
+ */
+bool VLayoutBenchmark::IsStable(const QJsonObject &report)
+{
+    const QJsonArray results = report.value(QStringLiteral("results")).toArray();
+    for (int i = 0; i < results.size(); ++i)
+    {
+        if (not results.at(i).toObject().value(QStringLiteral("stable")).toBool())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QJsonObject VLayoutBenchmark::RunSet(const PieceSet &set, LayoutEngine engine, int attemptCount) const
+{
+    QJsonArray times;
+    qint64 bestTime = -1;
+    quint64 candidates = 0;
+    LayoutErrors state = LayoutErrors::NoError;
+    QVector<QVector<VLayoutPiece>> sheets;
+    QStringList firstLayout;
+    bool stable = true;
+
+    for (int run = 0; run < repeat; ++run)
+    {
+        VLayoutGenerator generator;
+        generator.setPieces(set.pieces);
+        generator.SetLayoutWidth(set.layoutWidth);
+        generator.SetCaseType(Cases::CaseDesc);
+        generator.SetPaperWidth(set.paperWidth);
+        generator.SetPaperHeight(set.paperHeight);
+        generator.SetPrinterFields(false, QMarginsF());
+        generator.SetShift(0);
+        generator.SetRotate(true);
+        generator.SetRotationIncrease(180);
+        generator.SetAutoCrop(false);
+        generator.SetSaveLength(true);
+        generator.SetUnitePages(false);
+        generator.SetStripOptimization(false);
+        generator.SetEngine(engine);
+        generator.SetAttempts(attemptCount);
+        generator.SetTimeBudget(0);
+
+        VPosition::ResetCheckedCandidates();
+
+        QElapsedTimer timer;
+        timer.start();
+        generator.Generate();
+        const qint64 elapsed = timer.elapsed();
+
+        times.append(elapsed);
+
+        const QStringList layout = LayoutSignature(generator.getAllPieces());
+        if (run == 0)
+        {
+            firstLayout = layout;
+        }
+        else if (layout != firstLayout)
+        {
+            qCritical() << tr("Set '%1', engine %2, %3 attempts: run %4 gave a different layout than run 1.")
+                           .arg(set.name, EngineName(engine)).arg(attemptCount).arg(run + 1);
+            stable = false;
+        }
+
+        if (bestTime < 0 || elapsed < bestTime)
+        {
+            bestTime = elapsed;
+            candidates = VPosition::CheckedCandidates();
+            state = generator.State();
+            sheets = generator.getAllPieces();
+        }
+    }
+
+    // The used length of a sheet ends at the lowest piece, the rest of the roll stays available
+    qreal markerLength = 0;
+    for (int i = 0; i < sheets.size(); ++i)
+    {
+        qreal sheetLength = 0;
+        const QVector<VLayoutPiece> &pieces = sheets.at(i);
+        for (int j = 0; j < pieces.size(); ++j)
+        {
+            sheetLength = qMax(sheetLength, pieces.at(j).LayoutBoundingRect().bottom());
+        }
+        markerLength += qMin(sheetLength, set.paperHeight);
+    }
+
+    const qreal usedArea = set.paperWidth * markerLength;
+    const qreal sheetsArea = set.paperWidth * set.paperHeight * sheets.size();
+
+    QJsonArray seeds;
+    for (int i = 0; i < attemptCount; ++i)
+    {
+        seeds.append(i);
+    }
+
+    QJsonObject result;
+    result.insert(QStringLiteral("set"), set.name);
+    result.insert(QStringLiteral("description"), set.description);
+    result.insert(QStringLiteral("pieces"), set.pieces.size());
+    result.insert(QStringLiteral("engine"), EngineName(engine));
+    result.insert(QStringLiteral("attempts"), attemptCount);
+    result.insert(QStringLiteral("seeds"), seeds);
+    result.insert(QStringLiteral("state"), LayoutStateName(state));
+    result.insert(QStringLiteral("stable"), stable);
+    result.insert(QStringLiteral("wallTimeMs"), bestTime);
+    result.insert(QStringLiteral("wallTimesMs"), times);
+    result.insert(QStringLiteral("candidates"), static_cast<double>(candidates));
+    result.insert(QStringLiteral("sheets"), sheets.size());
+    result.insert(QStringLiteral("markerLength"), markerLength);
+    result.insert(QStringLiteral("utilisation"), usedArea > 0 ? set.netArea / usedArea : 0.0);
+    result.insert(QStringLiteral("sheetUtilisation"), sheetsArea > 0 ? set.netArea / sheetsArea : 0.0);
+    return result;
+}
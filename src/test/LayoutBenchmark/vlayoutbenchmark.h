@@ -0,0 +1,100 @@
+/***************************************************************************
+ **  @file   vlayoutbenchmark.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef VLAYOUTBENCHMARK_H
+#define VLAYOUTBENCHMARK_H
+
+#include <QCoreApplication>
+#include <QJsonObject>
+#include <QString>
+#include <QVector>
+#include <QtGlobal>
+
+#include "../vlayout/vlayoutdef.h"
+#include "../vlayout/vlayoutpiece.h"
+
+/**
+ * @brief The VLayoutBenchmark class runs VLayoutGenerator over a corpus of piece sets with fixed settings and
+ * reports wall time, tried placements, sheet count and fabric utilisation as JSON, one result per engine.
+ *
+ * The layout must not depend on thread timing, so every repeat of a case has to give the same sheets with the same
+ * pieces in the same places. A case that does not is reported as unstable.
+ *
+ * A corpus file describes one piece set: paper size, layout width and piece contours in pixels.
+ */
+class VLayoutBenchmark
+{
+    Q_DECLARE_TR_FUNCTIONS(VLayoutBenchmark)
+public:
+    VLayoutBenchmark();
+
+    bool LoadCorpus(const QString &fileName);
+
+    int  GetRepeat() const;
+    void SetRepeat(int value);
+
+    QVector<int> GetAttempts() const;
+    void         SetAttempts(const QVector<int> &value);
+
+    QVector<LayoutEngine> GetEngines() const;
+    void                  SetEngines(const QVector<LayoutEngine> &value);
+
+    QJsonObject Run() const;
+
+    static bool    IsStable(const QJsonObject &report);
+    static QString EngineName(LayoutEngine engine);
+
+private:
+    Q_DISABLE_COPY(VLayoutBenchmark)
+
+    struct PieceSet
+    {
+        PieceSet()
+            : name(),
+              description(),
+              paperWidth(0),
+              paperHeight(0),
+              layoutWidth(0),
+              pieces(),
+              netArea(0)
+        {}
+
+        QString               name;
+        QString               description;
+        qreal                 paperWidth;
+        qreal                 paperHeight;
+        qreal                 layoutWidth;
+        QVector<VLayoutPiece> pieces;
+        /** @brief netArea the area of all piece contours without the layout allowance. */
+        qreal                 netArea;
+    };
+
+    QVector<PieceSet>     sets;
+    int                   repeat;
+    QVector<int>          attempts;
+    QVector<LayoutEngine> engines;
+
+    QJsonObject RunSet(const PieceSet &set, LayoutEngine engine, int attemptCount) const;
+};
+
+#endif // VLAYOUTBENCHMARK_H
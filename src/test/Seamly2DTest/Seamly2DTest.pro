@@ -49,7 +49,22 @@ SOURCES += \
     tst_vpointf.cpp \
     tst_readval.cpp \
     tst_vtranslatevars.cpp \
-    tst_vabstractpiece.cpp
+    tst_vabstractpiece.cpp \
+    tst_vnfpposition.cpp \
+    tst_calculator.cpp \
+    tst_vdomdocument.cpp \
+    tst_vcommonsettings.cpp \
+    tst_vcontainer.cpp \
+    tst_vtiledraster.cpp \
+    tst_vlayoutgenerator.cpp \
+    tst_vcontour.cpp \
+    tst_vtextmanager.cpp \
+    tst_vbatchexport.cpp \
+    tst_vobjengine.cpp \
+    tst_vlayoutsheet.cpp \
+    tst_vdependencygraph.cpp \
+    tst_vdxfpaintdevice.cpp \
+    tst_vpatternconverter.cpp
 
 *msvc*:SOURCES += stable.cpp
 
@@ -75,7 +90,26 @@ HEADERS += \
     tst_vpointf.h \
     tst_readval.h \
     tst_vtranslatevars.h \
-    tst_vabstractpiece.h
+    tst_vabstractpiece.h \
+    tst_vnfpposition.h \
+    tst_calculator.h \
+    tst_vdomdocument.h \
+    tst_vcommonsettings.h \
+    tst_vcontainer.h \
+    tst_vtiledraster.h \
+    tst_vlayoutgenerator.h \
+    tst_vcontour.h \
+    tst_vtextmanager.h \
+    tst_vbatchexport.h \
+    tst_vobjengine.h \
+    tst_vlayoutsheet.h \
+    tst_vdependencygraph.h \
+    tst_vdxfpaintdevice.h \
+    tst_vpatternconverter.h
+
+# Job lists of batch export are part of the application, build them from its sources
+SOURCES += $$PWD/../../app/seamly2d/core/vbatchexport.cpp
+HEADERS += $$PWD/../../app/seamly2d/core/vbatchexport.h
 
 include(warnings.pri)
 
@@ -151,6 +185,15 @@ DEPENDPATH += $$PWD/../../libs/vgeometry
 win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/vgeometry.lib
 else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vgeometry/$${DESTDIR}/libvgeometry.a
 
+# VDxf static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vdxf/$${DESTDIR}/ -lvdxf
+
+INCLUDEPATH += $$PWD/../../libs/vdxf
+DEPENDPATH += $$PWD/../../libs/vdxf
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vdxf/$${DESTDIR}/vdxf.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vdxf/$${DESTDIR}/libvdxf.a
+
 # VLayout static library
 unix|win32: LIBS += -L$$OUT_PWD/../../libs/vlayout/$${DESTDIR} -lvlayout
 
@@ -160,6 +203,15 @@ DEPENDPATH += $$PWD/../../libs/vlayout
 win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vlayout/$${DESTDIR}/vlayout.lib
 else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vlayout/$${DESTDIR}/libvlayout.a
 
+# VObj static library
+unix|win32: LIBS += -L$$OUT_PWD/../../libs/vobj/$${DESTDIR}/ -lvobj
+
+INCLUDEPATH += $$PWD/../../libs/vobj
+DEPENDPATH += $$PWD/../../libs/vobj
+
+win32:!win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vobj/$${DESTDIR}/vobj.lib
+else:unix|win32-g++: PRE_TARGETDEPS += $$OUT_PWD/../../libs/vobj/$${DESTDIR}/libvobj.a
+
 # QMuParser library
 unix|win32: LIBS += -L$${OUT_PWD}/../../libs/qmuparser/$${DESTDIR} -lqmuparser
 
@@ -72,6 +72,21 @@
 #include "tst_vpointf.h"
 #include "tst_readval.h"
 #include "tst_vtranslatevars.h"
+#include "tst_vnfpposition.h"
+#include "tst_calculator.h"
+#include "tst_vdomdocument.h"
+#include "tst_vcommonsettings.h"
+#include "tst_vcontainer.h"
+#include "tst_vtiledraster.h"
+#include "tst_vlayoutgenerator.h"
+#include "tst_vcontour.h"
+#include "tst_vtextmanager.h"
+#include "tst_vbatchexport.h"
+#include "tst_vobjengine.h"
+#include "tst_vlayoutsheet.h"
+#include "tst_vdependencygraph.h"
+#include "tst_vdxfpaintdevice.h"
+#include "tst_vpatternconverter.h"
 
 #include "../vmisc/def.h"
 #include "../qmuparser/qmudef.h"
@@ -159,6 +174,21 @@ int main(int argc, char** argv)
     ASSERT_TEST(new TST_VPointF());
     ASSERT_TEST(new TST_ReadVal());
     ASSERT_TEST(new TST_VTranslateVars());
+    ASSERT_TEST(new TST_VNfpPosition());
+    ASSERT_TEST(new TST_Calculator());
+    ASSERT_TEST(new TST_VDomDocument());
+    ASSERT_TEST(new TST_VCommonSettings());
+    ASSERT_TEST(new TST_VContainer());
+    ASSERT_TEST(new TST_VTiledRaster());
+    ASSERT_TEST(new TST_VLayoutGenerator());
+    ASSERT_TEST(new TST_VContour());
+    ASSERT_TEST(new TST_VTextManager());
+    ASSERT_TEST(new TST_VBatchExport());
+    ASSERT_TEST(new TST_VObjEngine());
+    ASSERT_TEST(new TST_VLayoutSheet());
+    ASSERT_TEST(new TST_VDependencyGraph());
+    ASSERT_TEST(new TST_VDxfPaintDevice());
+    ASSERT_TEST(new TST_VPatternConverter());
 
     return status;
 }
@@ -0,0 +1,127 @@
+/***************************************************************************
+ **  @file   tst_calculator.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_calculator.h"
+#include "../vpatterndb/calculator.h"
+#include "../qmuparser/qmuparsererror.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+class TestVariable : public VInternalVariable
+{
+public:
+    TestVariable(const QString &name, qreal value)
+        : VInternalVariable()
+    {
+        SetName(name);
+        SetValue(value);
+    }
+
+    void SetTestValue(qreal value)
+    {
+        SetValue(value);
+    }
+};
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_Calculator::TST_Calculator(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::init()
+{
+    Calculator::ClearFormulaCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::CachedFormula_data() const
+{
+    QTest::addColumn<QString>("formula");
+
+    QTest::newRow("Number") << "2.5";
+    QTest::newRow("Constant expression") << "2+3*4";
+    QTest::newRow("Unary minus") << "-(1.5+#a)";
+    QTest::newRow("Variables") << "#a*2+#b";
+    QTest::newRow("Repeated variable") << "#a*#a-#a/2";
+    QTest::newRow("Built-in function") << "sqrt(#b)+max(#a;#b)";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::CachedFormula() const
+{
+    QFETCH(QString, formula);
+
+    QHash<QString, QSharedPointer<VInternalVariable> > vars;
+    vars.insert(QStringLiteral("#a"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#a"), 3)));
+    vars.insert(QStringLiteral("#b"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#b"), 16)));
+
+    Calculator cal;
+    const qreal expected = cal.EvalFormula(vars, formula);
+
+    // First call compiles the expression, second one uses the cache
+    QCOMPARE(Calculator::EvalCachedFormula(vars, formula), expected);
+    QCOMPARE(Calculator::EvalCachedFormula(vars, formula), expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::CachedFormulaRebindsValues() const
+{
+    const QString formula = QStringLiteral("#a*2+#b");
+
+    auto *a = new TestVariable(QStringLiteral("#a"), 3);
+    QHash<QString, QSharedPointer<VInternalVariable> > vars;
+    vars.insert(QStringLiteral("#a"), QSharedPointer<VInternalVariable>(a));
+    vars.insert(QStringLiteral("#b"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#b"), 1)));
+
+    QCOMPARE(Calculator::EvalCachedFormula(vars, formula), 7.0);
+
+    a->SetTestValue(10);
+    QCOMPARE(Calculator::EvalCachedFormula(vars, formula), 21.0);
+
+    // Other container with the same names
+    QHash<QString, QSharedPointer<VInternalVariable> > otherVars;
+    otherVars.insert(QStringLiteral("#a"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#a"), 0)));
+    otherVars.insert(QStringLiteral("#b"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#b"), 5)));
+    QCOMPARE(Calculator::EvalCachedFormula(otherVars, formula), 5.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_Calculator::CachedFormulaUnknownVariable() const
+{
+    const QString formula = QStringLiteral("#a+#c");
+
+    QHash<QString, QSharedPointer<VInternalVariable> > vars;
+    vars.insert(QStringLiteral("#a"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#a"), 1)));
+    vars.insert(QStringLiteral("#c"), QSharedPointer<VInternalVariable>(new TestVariable(QStringLiteral("#c"), 2)));
+
+    QCOMPARE(Calculator::EvalCachedFormula(vars, formula), 3.0);
+
+    vars.remove(QStringLiteral("#c"));
+    QVERIFY_EXCEPTION_THROWN(Calculator::EvalCachedFormula(vars, formula), qmu::QmuParserError);
+}
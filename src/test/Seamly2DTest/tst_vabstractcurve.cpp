@@ -191,3 +191,29 @@ void TST_VAbstractCurve::isPointOnCurve() const
     bool result = VAbstractCurve::isPointOnCurve(points, point);
     QCOMPARE(result, expectedResult);
 }
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VAbstractCurve::CurvesIntersection() const
+{
+    // Zigzag crossing a wave many times, the kernel must find the same crossings as brute force in the same order
+    QVector<QPointF> curve1;
+    QVector<QPointF> curve2;
+    for (int i = 0; i <= 100; ++i)
+    {
+        curve1.append(QPointF(i * 10, (i % 2 == 0) ? 0 : 50));
+        curve2.append(QPointF(i * 10 + 3, 25 + 20 * qSin(i / 5.0)));
+    }
+
+    QVector<QPointF> expected;
+    for (int i = 0; i < curve1.size() - 1; ++i)
+    {
+        expected += VAbstractCurve::CurveIntersectLine(curve2, QLineF(curve1.at(i), curve1.at(i + 1)));
+    }
+
+    const QVector<QPointF> result = VAbstractCurve::CurvesIntersection(curve1, curve2);
+    QVERIFY(not expected.isEmpty());
+    QCOMPARE(result, expected);
+
+    QVERIFY(VAbstractCurve::CurvesIntersection(curve1, QVector<QPointF>{QPointF(0, 100), QPointF(1000, 100)})
+            .isEmpty());
+}
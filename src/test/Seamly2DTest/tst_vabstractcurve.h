@@ -63,6 +63,7 @@ class TST_VAbstractCurve : public AbstractTest
 private slots:
     void isPointOnCurve_data() const;
     void isPointOnCurve() const;
+    void CurvesIntersection() const;
 };
 
 #endif // TST_VABSTRACTCURVE_H
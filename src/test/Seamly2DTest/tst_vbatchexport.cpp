@@ -0,0 +1,296 @@
+/***************************************************************************
+ **  @file   tst_vbatchexport.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vbatchexport.h"
+#include "../../app/seamly2d/core/vbatchexport.h"
+#include "../ifc/exception/vexception.h"
+
+#include <QTemporaryDir>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QString WriteList(const QTemporaryDir &dir, const QByteArray &content)
+{
+    const QString fileName = dir.filePath(QStringLiteral("jobs.json"));
+    QFile file(fileName);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        file.write(content);
+    }
+    return fileName;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VExportJob Job(const QString &pattern, const QString &measurements, const QString &basename)
+{
+    VExportJob job;
+    job.pattern = pattern;
+    job.arguments << QStringLiteral("--mfile") << measurements << QStringLiteral("--basename") << basename;
+    return job;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList BaseNames(const QVector<QVector<VExportJob>> &shards)
+{
+    QStringList names;
+    for (auto &shard : shards)
+    {
+        for (auto &job : shard)
+        {
+            names.append(job.arguments.last());
+        }
+    }
+    names.sort();
+    return names;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VBatchExport::TST_VBatchExport(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReadArray() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString fileName = WriteList(dir, "["
+        "{\"pattern\": \"shirt.val\", \"basename\": \"shirt_40\", \"gsize\": 40, \"text2paths\": true},"
+        "{\"pattern\": \"skirt.val\", \"basename\": \"skirt\", \"text2paths\": false, \"arguments\": [\"-f\", \"2\"]}"
+        "]");
+
+    const QVector<VExportJob> jobs = VBatchExport::ReadJobs(fileName);
+    QCOMPARE(jobs.size(), 2);
+
+    QCOMPARE(jobs.at(0).pattern, QStringLiteral("shirt.val"));
+    QCOMPARE(jobs.at(0).arguments, QStringList() << "--basename" << "shirt_40" << "--gsize" << "40" << "--text2paths");
+
+    // False flags are left out, raw arguments are passed as is
+    QCOMPARE(jobs.at(1).pattern, QStringLiteral("skirt.val"));
+    QCOMPARE(jobs.at(1).arguments, QStringList() << "-f" << "2" << "--basename" << "skirt");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReadDefaults() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString fileName = WriteList(dir, "{"
+        "\"defaults\": {\"format\": 1, \"destination\": \"out\"},"
+        "\"jobs\": ["
+        "    {\"pattern\": \"shirt.val\", \"basename\": \"shirt\"},"
+        "    {\"pattern\": \"shirt.val\", \"basename\": \"shirt_svg\", \"format\": 0}"
+        "]}");
+
+    const QVector<VExportJob> jobs = VBatchExport::ReadJobs(fileName);
+    QCOMPARE(jobs.size(), 2);
+    QCOMPARE(jobs.at(0).arguments, QStringList() << "--basename" << "shirt" << "--destination" << "out"
+                                                 << "--format" << "1");
+    // A job overrides the defaults
+    QCOMPARE(jobs.at(1).arguments, QStringList() << "--basename" << "shirt_svg" << "--destination" << "out"
+                                                 << "--format" << "0");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReadWrittenJobs() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QVector<VExportJob> jobs = QVector<VExportJob>() << Job("shirt.val", "standard.vst", "shirt")
+                                                           << Job("skirt.val", "my.vit", "skirt");
+    const QString fileName = dir.filePath(QStringLiteral("written.json"));
+    VBatchExport::WriteJobs(fileName, jobs);
+
+    const QVector<VExportJob> read = VBatchExport::ReadJobs(fileName);
+    QCOMPARE(read.size(), jobs.size());
+    for (int i = 0; i < jobs.size(); ++i)
+    {
+        QCOMPARE(read.at(i).pattern, jobs.at(i).pattern);
+        QCOMPARE(read.at(i).arguments, jobs.at(i).arguments);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReadInvalid_data() const
+{
+    QTest::addColumn<QByteArray>("content");
+
+    QTest::newRow("Not JSON") << QByteArray("[{\"pattern\": ");
+    QTest::newRow("Job is not an object") << QByteArray("[\"shirt.val\"]");
+    QTest::newRow("No pattern") << QByteArray("[{\"basename\": \"shirt\"}]");
+    QTest::newRow("Unsupported value") << QByteArray("[{\"pattern\": \"shirt.val\", \"basename\": [\"shirt\"]}]");
+    QTest::newRow("Bad job in defaults form") << QByteArray("{\"jobs\": [{\"pattern\": \"a.val\"}, 5]}");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReadInvalid() const
+{
+    QFETCH(QByteArray, content);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QString fileName = WriteList(dir, content);
+    QVERIFY_EXCEPTION_THROWN(VBatchExport::ReadJobs(fileName), VException);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::SplitJobs_data() const
+{
+    QTest::addColumn<int>("jobs");
+    QTest::addColumn<int>("patterns");
+    QTest::addColumn<int>("workers");
+    QTest::addColumn<int>("shards");
+    QTest::addColumn<int>("maxShard");
+
+    QTest::newRow("No jobs") << 0 << 1 << 4 << 1 << 0;
+    QTest::newRow("One worker") << 7 << 3 << 1 << 1 << 7;
+    QTest::newRow("More workers than jobs") << 3 << 3 << 8 << 3 << 1;
+    QTest::newRow("One pattern is cut in chunks") << 12 << 1 << 4 << 4 << 3;
+    QTest::newRow("Equal patterns") << 12 << 4 << 4 << 4 << 3;
+    QTest::newRow("Uneven") << 10 << 2 << 3 << 3 << 4;
+    QTest::newRow("Zero workers") << 5 << 1 << 0 << 1 << 5;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::SplitJobs() const
+{
+    QFETCH(int, jobs);
+    QFETCH(int, patterns);
+    QFETCH(int, workers);
+    QFETCH(int, shards);
+    QFETCH(int, maxShard);
+
+    // Jobs of one pattern follow each other
+    QVector<VExportJob> list;
+    for (int i = 0; i < jobs; ++i)
+    {
+        const int pattern = i * patterns / qMax(1, jobs);
+        list.append(Job(QString("p%1.val").arg(pattern), "m.vst", QString("job%1").arg(i, 3, 10, QChar('0'))));
+    }
+
+    const QVector<QVector<VExportJob>> split = VBatchExport::SplitJobs(list, workers);
+    QCOMPARE(split.size(), shards);
+
+    int biggest = 0;
+    for (auto &shard : split)
+    {
+        biggest = qMax(biggest, shard.size());
+    }
+    QCOMPARE(biggest, maxShard);
+
+    // Every job is exported exactly once
+    QStringList expected;
+    for (auto &job : list)
+    {
+        expected.append(job.arguments.last());
+    }
+    expected.sort();
+    QCOMPARE(BaseNames(split), expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::SplitKeepsPatternsTogether() const
+{
+    // Two patterns with two measurements each, every pair needs its own load
+    const QVector<VExportJob> list = QVector<VExportJob>() << Job("a.val", "1.vst", "a1") << Job("a.val", "1.vst", "a2")
+                                                           << Job("a.val", "2.vst", "a3") << Job("a.val", "2.vst", "a4")
+                                                           << Job("b.val", "1.vst", "b1") << Job("b.val", "1.vst", "b2")
+                                                           << Job("b.val", "2.vst", "b3") << Job("b.val", "2.vst", "b4");
+
+    const QVector<QVector<VExportJob>> split = VBatchExport::SplitJobs(list, 4);
+    QCOMPARE(split.size(), 4);
+    for (auto &shard : split)
+    {
+        QCOMPARE(shard.size(), 2);
+        QCOMPARE(shard.at(0).pattern, shard.at(1).pattern);
+        QCOMPARE(shard.at(0).arguments.at(1), shard.at(1).arguments.at(1));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::WithGradation_data() const
+{
+    QTest::addColumn<QStringList>("arguments");
+    QTest::addColumn<QString>("size");
+    QTest::addColumn<QString>("height");
+    QTest::addColumn<QStringList>("expected");
+
+    const QStringList base = QStringList() << "--basename" << "shirt";
+
+    QTest::newRow("Job sets nothing, gets loaded gradation")
+            << base << "40" << "170" << (QStringList(base) << "--gsize" << "40" << "--gheight" << "170");
+    QTest::newRow("Job sets both")
+            << (QStringList(base) << "--gsize" << "52" << "--gheight" << "188") << "40" << "170"
+            << (QStringList(base) << "--gsize" << "52" << "--gheight" << "188");
+    QTest::newRow("Job sets size only")
+            << (QStringList(base) << "--gsize" << "52") << "40" << "170"
+            << (QStringList(base) << "--gsize" << "52" << "--gheight" << "170");
+    QTest::newRow("Short and joined forms")
+            << (QStringList(base) << "-x" << "52" << "--gheight=188") << "40" << "170"
+            << (QStringList(base) << "-x" << "52" << "--gheight=188");
+    QTest::newRow("Pattern without gradation") << base << "" << "" << base;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::WithGradation() const
+{
+    QFETCH(QStringList, arguments);
+    QFETCH(QString, size);
+    QFETCH(QString, height);
+    QFETCH(QStringList, expected);
+
+    QCOMPARE(VBatchExport::WithGradation(arguments, size, height), expected);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VBatchExport::ReusedPatternDoesNotInheritGradation() const
+{
+    // Both jobs use the same loaded pattern, the second one must not keep the size of the first one
+    const QVector<VExportJob> list = QVector<VExportJob>()
+            << Job("shirt.val", "standard.vst", "shirt_52")
+            << Job("shirt.val", "standard.vst", "shirt_default");
+    QStringList first = list.at(0).arguments;
+    first << "--gsize" << "52";
+
+    const QString loadedSize = "40";
+    const QString loadedHeight = "170";
+
+    const QStringList firstArguments = VBatchExport::WithGradation(first, loadedSize, loadedHeight);
+    const QStringList secondArguments = VBatchExport::WithGradation(list.at(1).arguments, loadedSize, loadedHeight);
+
+    QVERIFY(firstArguments.contains("52"));
+    QCOMPARE(secondArguments.at(secondArguments.indexOf("--gsize") + 1), loadedSize);
+    QCOMPARE(secondArguments.at(secondArguments.indexOf("--gheight") + 1), loadedHeight);
+}
@@ -0,0 +1,118 @@
+/***************************************************************************
+ **  @file   tst_vcommonsettings.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vcommonsettings.h"
+#include "../vmisc/vcommonsettings.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QString SettingsFile(const QTemporaryDir &dir)
+{
+    return dir.path() + QStringLiteral("/tst_vcommonsettings.conf");
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VCommonSettings::TST_VCommonSettings(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VCommonSettings::SnapshotFollowsWrites() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    VCommonSettings settings(SettingsFile(dir), QSettings::IniFormat);
+    settings.setDefaultCutColor(QStringLiteral("red"));
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("red"));
+
+    QSignalSpy spy(&settings, &VCommonSettings::styleChanged);
+    settings.setDefaultCutColor(QStringLiteral("blue"));
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("blue"));
+
+    // Value reached the backend too
+    settings.sync();
+    QSettings backend(SettingsFile(dir), QSettings::IniFormat);
+    QCOMPARE(backend.value(QStringLiteral("pattern/defaultCutColor")).toString(), QStringLiteral("blue"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VCommonSettings::SnapshotReload() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    VCommonSettings settings(SettingsFile(dir), QSettings::IniFormat);
+    settings.setDefaultCutColor(QStringLiteral("red"));
+    settings.sync();
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("red")); // Snapshot is built on the first read
+
+    {
+        QSettings backend(SettingsFile(dir), QSettings::IniFormat);
+        backend.setValue(QStringLiteral("pattern/defaultCutColor"), QStringLiteral("green"));
+        backend.sync();
+    }
+
+    // Change behind our back is invisible until reload
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("red"));
+
+    QSignalSpy spy(&settings, &VCommonSettings::styleChanged);
+    settings.ReloadSnapshot();
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("green"));
+    QCOMPARE(spy.count(), 1);
+
+    // Nothing changed since, reload must not repaint
+    settings.ReloadSnapshot();
+    QCOMPARE(spy.count(), 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VCommonSettings::ExternalChangeReloads() const
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    {
+        QSettings backend(SettingsFile(dir), QSettings::IniFormat);
+        backend.setValue(QStringLiteral("pattern/defaultCutColor"), QStringLiteral("red"));
+        backend.sync();
+    }
+
+    VCommonSettings settings(SettingsFile(dir), QSettings::IniFormat);
+    QCOMPARE(settings.getDefaultCutColor(), QStringLiteral("red"));
+
+    // Another instance writes the same file
+    {
+        QSettings backend(SettingsFile(dir), QSettings::IniFormat);
+        backend.setValue(QStringLiteral("pattern/defaultCutColor"), QStringLiteral("green"));
+        backend.sync();
+    }
+
+    QTRY_COMPARE(settings.getDefaultCutColor(), QStringLiteral("green"));
+}
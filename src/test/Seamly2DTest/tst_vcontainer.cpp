@@ -0,0 +1,202 @@
+/***************************************************************************
+ **  @file   tst_vcontainer.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vcontainer.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vgeometry/vpointf.h"
+
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void AddIncrement(VContainer &data, const QString &name, qreal value)
+{
+    data.AddVariable(name, new VIncrement(&data, name, 0, value, QString::number(value), true));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool HasObject(const VContainer &data, quint32 id)
+{
+    try
+    {
+        data.GetGObject(id);
+        return true;
+    }
+    catch (const VExceptionBadId &)
+    {
+        return false;
+    }
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VContainer::TST_VContainer(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContainer::SnapshotKeepsVersion() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    const quint32 first = data.AddGObject(new VPointF(10, 10, "A", 0, 0));
+    AddIncrement(data, "#a", 1);
+
+    const VContainer snapshot(data);
+
+    const quint32 second = data.AddGObject(new VPointF(20, 20, "B", 0, 0));
+    data.RemoveVariable("#a");
+    AddIncrement(data, "#b", 2);
+
+    QVERIFY(HasObject(snapshot, first));
+    QVERIFY(not HasObject(snapshot, second));
+    QCOMPARE(snapshot.DataGObjects().size(), 1);
+    QVERIFY(snapshot.DataVariables().contains("#a"));
+    QVERIFY(not snapshot.DataVariables().contains("#b"));
+    QCOMPARE(*snapshot.GetVariable<VIncrement>("#a")->GetValue(), 1.0);
+
+    QVERIFY(HasObject(data, first));
+    QVERIFY(HasObject(data, second));
+    QCOMPARE(data.DataGObjects().size(), 2);
+    QVERIFY(not data.DataVariables().contains("#a"));
+    QVERIFY(data.DataVariables().contains("#b"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContainer::WriteToOldSnapshot() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    AddIncrement(data, "#a", 1);
+
+    VContainer snapshot(data);
+    AddIncrement(data, "#b", 2);
+
+    // The snapshot is behind the latest version now, its changes must not leak into data.
+    AddIncrement(snapshot, "#c", 3);
+    snapshot.RemoveVariable("#a");
+
+    QCOMPARE(snapshot.DataVariables().size(), 1);
+    QVERIFY(snapshot.DataVariables().contains("#c"));
+
+    QCOMPARE(data.DataVariables().size(), 2);
+    QVERIFY(data.DataVariables().contains("#a"));
+    QVERIFY(data.DataVariables().contains("#b"));
+    QVERIFY(not data.DataVariables().contains("#c"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContainer::SnapshotAfterCompaction() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+
+    // Replacing a variable over and over grows the change log past the data and forces compaction.
+    QVector<VContainer> snapshots;
+    for (int i = 0; i < 300; ++i)
+    {
+        AddIncrement(data, QString("#v%1").arg(i), i);
+        if (i > 0)
+        {
+            data.RemoveVariable(QString("#v%1").arg(i - 1));
+        }
+        snapshots.append(data);
+    }
+
+    for (int i = 0; i < snapshots.size(); ++i)
+    {
+        const QHash<QString, QSharedPointer<VInternalVariable>> variables = snapshots.at(i).DataVariables();
+        QCOMPARE(variables.size(), 1);
+        QVERIFY(variables.contains(QString("#v%1").arg(i)));
+        QCOMPARE(*snapshots.at(i).GetVariable<VIncrement>(QString("#v%1").arg(i))->GetValue(), qreal(i));
+    }
+    QCOMPARE(data.DataVariables().size(), 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContainer::SiblingWriteKeepsHash() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    const quint32 first = data.AddGObject(new VPointF(10, 10, "A", 0, 0));
+    AddIncrement(data, "#a", 1);
+
+    // Both handles are at the latest version, the hashes must not follow writes of the sibling.
+    const QHash<quint32, QSharedPointer<VGObject>> objects = data.DataGObjects();
+    const QHash<QString, QSharedPointer<VInternalVariable>> variables = data.DataVariables();
+
+    VContainer sibling(data);
+    const quint32 second = sibling.AddGObject(new VPointF(20, 20, "B", 0, 0));
+    sibling.RemoveVariable("#a");
+    AddIncrement(sibling, "#b", 2);
+
+    QCOMPARE(objects.size(), 1);
+    QVERIFY(objects.contains(first));
+    QVERIFY(not objects.contains(second));
+
+    QCOMPARE(variables.size(), 1);
+    QVERIFY(variables.contains("#a"));
+    QVERIFY(not variables.contains("#b"));
+
+    QCOMPARE(sibling.DataGObjects().size(), 2);
+    QCOMPARE(sibling.DataVariables().size(), 1);
+    QVERIFY(sibling.DataVariables().contains("#b"));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContainer::ToolCopyKeepsHeadShared() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    const quint32 first = data.AddGObject(new VPointF(10, 10, "A", 0, 0));
+    AddIncrement(data, "#a", 1);
+
+    // Stored values move only if the hash is copied on write
+    const QSharedPointer<VGObject> *object = &data.DataGObjects().constFind(first).value();
+    const QSharedPointer<VInternalVariable> *variable = &data.DataVariables().constFind("#a").value();
+
+    // Every tool keeps a copy of the container and both are read during parsing
+    const VContainer tool(data);
+    QCOMPARE(tool.DataGObjects().size(), 1);
+    QCOMPARE(data.FormulaVariables().size(), 1);
+
+    // The next tool writes, that detaches the container data but must not copy the hashes
+    data.AddGObject(new VPointF(20, 20, "B", 0, 0));
+    AddIncrement(data, "#b", 2);
+
+    QCOMPARE(&data.DataGObjects().constFind(first).value(), object);
+    QCOMPARE(&data.DataVariables().constFind("#a").value(), variable);
+
+    QCOMPARE(tool.DataGObjects().size(), 1);
+    QCOMPARE(tool.DataVariables().size(), 1);
+    QCOMPARE(data.DataGObjects().size(), 2);
+    QCOMPARE(data.DataVariables().size(), 2);
+}
@@ -0,0 +1,157 @@
+/***************************************************************************
+ **  @file   tst_vcontour.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vcontour.h"
+#include "../vlayout/vcontour.h"
+
+#include <QPainterPath>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QPointF> Rect(qreal x, qreal y, qreal width, qreal height)
+{
+    return QVector<QPointF>() << QPointF(x, y) << QPointF(x + width, y) << QPointF(x + width, y + height)
+                              << QPointF(x, y + height);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ConcaveContour a sheet contour with a notch, like the contour after placing a few pieces.
+ */
+QVector<QPointF> ConcaveContour()
+{
+    return QVector<QPointF>() << QPointF(0, 0) << QPointF(300, 0) << QPointF(300, 200) << QPointF(200, 200)
+                              << QPointF(200, 80) << QPointF(100, 80) << QPointF(100, 200) << QPointF(0, 200);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ZigzagContour a contour with many edges, so the edges index has many cells.
+ */
+QVector<QPointF> ZigzagContour()
+{
+    QVector<QPointF> points;
+    points << QPointF(0, 0);
+    for (int i = 0; i <= 100; ++i)
+    {
+        points << QPointF(i * 10, i % 2 == 0 ? 100 : 140);
+    }
+    points << QPointF(1000, 0);
+    return points;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPainterPath ClosedPath(const QVector<QPointF> &points)
+{
+    QPainterPath path;
+    path.setFillRule(Qt::WindingFill);
+    path.moveTo(points.at(0));
+    for (int i = 1; i < points.size(); ++i)
+    {
+        path.lineTo(points.at(i));
+    }
+    path.lineTo(points.at(0));
+    return path;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+VContour MakeContour(const QVector<QPointF> &points)
+{
+    VContour contour(2000, 1000);
+    contour.SetContour(points);
+    return contour;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VContour::TST_VContour(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VContour::IntersectsAsPainterPath_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("contour");
+    QTest::addColumn<QVector<QPointF>>("polygon");
+
+    const QVector<QPointF> concave = ConcaveContour();
+    QTest::newRow("Crossing an edge") << concave << Rect(250, 150, 100, 100);
+    QTest::newRow("Crossing the notch") << concave << Rect(120, 60, 60, 40);
+    QTest::newRow("Inside the notch") << concave << Rect(120, 100, 60, 60);
+    QTest::newRow("Touching an edge from outside") << concave << Rect(300, 50, 50, 50);
+    QTest::newRow("Touching the notch bottom") << concave << Rect(120, 80, 60, 60);
+    QTest::newRow("Touching a vertex") << concave << Rect(300, 200, 40, 40);
+    QTest::newRow("Sharing a whole edge") << concave << Rect(0, 200, 100, 50);
+    QTest::newRow("Contained by the contour") << concave << Rect(20, 20, 40, 40);
+    QTest::newRow("Containing the contour") << concave << Rect(-50, -50, 400, 300);
+    QTest::newRow("Far away") << concave << Rect(600, 600, 10, 10);
+    QTest::newRow("Below the contour") << concave << Rect(0, 210, 300, 50);
+
+    const QVector<QPointF> zigzag = ZigzagContour();
+    QTest::newRow("Zigzag, crossing teeth") << zigzag << Rect(400, 120, 100, 60);
+    QTest::newRow("Zigzag, between teeth") << zigzag << (QVector<QPointF>() << QPointF(515, 135) << QPointF(518, 128)
+                                                                            << QPointF(522, 128) << QPointF(525, 135));
+    QTest::newRow("Zigzag, under all teeth") << zigzag << Rect(0, 150, 1000, 40);
+    QTest::newRow("Zigzag, inside") << zigzag << Rect(200, 20, 500, 60);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectsAsPainterPath checks that the indexed test gives the same answer as QPainterPath::intersects().
+ */
+void TST_VContour::IntersectsAsPainterPath() const
+{
+    QFETCH(QVector<QPointF>, contour);
+    QFETCH(QVector<QPointF>, polygon);
+
+    const VContour gContour = MakeContour(contour);
+    QCOMPARE(gContour.Intersects(polygon), gContour.ContourPath().intersects(ClosedPath(polygon)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief IntersectsAsPainterPathSweep moves a small square over the concave contour with a step that hits edges and
+ * vertexes exactly and compares both tests in each position.
+ */
+void TST_VContour::IntersectsAsPainterPathSweep() const
+{
+    const VContour gContour = MakeContour(ConcaveContour());
+    const QPainterPath gPath = gContour.ContourPath();
+
+    for (int x = -40; x <= 320; x += 20)
+    {
+        for (int y = -40; y <= 220; y += 20)
+        {
+            const QVector<QPointF> polygon = Rect(x, y, 20, 20);
+            QVERIFY2(gContour.Intersects(polygon) == gPath.intersects(ClosedPath(polygon)),
+                     qUtf8Printable(QString("Different answers for the square at (%1, %2).").arg(x).arg(y)));
+        }
+    }
+}
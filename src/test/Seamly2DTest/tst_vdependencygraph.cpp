@@ -0,0 +1,400 @@
+/***************************************************************************
+ **  @file   tst_vdependencygraph.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vdependencygraph.h"
+#include "../ifc/xml/vabstractpattern.h"
+#include "../vpatterndb/calculator.h"
+#include "../vpatterndb/vcontainer.h"
+#include "../vpatterndb/vdependencygraph.h"
+#include "../vpatterndb/variables/vincrement.h"
+#include "../vgeometry/vpointf.h"
+#include "../vtools/tools/drawTools/toolpoint/toolsinglepoint/vtoolbasepoint.h"
+#include "../vtools/tools/drawTools/toolpoint/toolsinglepoint/toollinepoint/vtoolendline.h"
+
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+const quint32 baseId = 1;  // Base point, no inputs
+const quint32 childId = 2; // Point from the base point and #a
+
+//---------------------------------------------------------------------------------------------------------------------
+void AddIncrement(VContainer &data, const QString &name, qreal value)
+{
+    data.AddVariable(name, new VIncrement(&data, name, 0, value, QString::number(value), true));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CalculatePoint works as the lite parse does for one tool: replay the tool if it is up to date, else calculate
+ * it. The point is placed at the input point shifted by the formula.
+ * @return true if the tool was calculated.
+ */
+bool CalculatePoint(VDependencyGraph &graph, VContainer &data, quint32 id, quint64 signature, quint32 input,
+                    const QString &formula, bool readAll = false)
+{
+    if (graph.IsUpToDate(id, signature, &data))
+    {
+        graph.Replay(id, &data);
+        return false;
+    }
+
+    graph.BeginTool(id, signature);
+    qreal x = 0;
+    if (input != NULL_ID)
+    {
+        x = data.GeometricObject<VPointF>(input)->x();
+    }
+    if (readAll)
+    {
+        x += data.DataGObjects().size() + data.DataVariables().size();
+    }
+    x += Calculator::EvalCachedFormula(data.FormulaVariables(), formula);
+    data.UpdateGObject(id, new VPointF(x, 0, QString("P%1").arg(id), 0, 0));
+    graph.EndTool();
+    return true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal PointX(const VContainer &data, quint32 id)
+{
+    return data.GeometricObject<VPointF>(id)->x();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The TestPattern class parses the calculation block of its first draft block through
+ * VAbstractPattern::ParseCalculationTool, as VPattern does, with real tools in lite parse mode.
+ */
+class TestPattern : public VAbstractPattern
+{
+public:
+    explicit TestPattern(VContainer *data);
+
+    virtual void    CreateEmptyFile() Q_DECL_OVERRIDE {}
+    virtual void    IncrementReferens(quint32 id) const Q_DECL_OVERRIDE {Q_UNUSED(id)}
+    virtual void    DecrementReferens(quint32 id) const Q_DECL_OVERRIDE {Q_UNUSED(id)}
+    virtual QString GenerateLabel(const LabelType &type, const QString &reservedName = QString())const Q_DECL_OVERRIDE;
+    virtual QString GenerateSuffix(const QString &type) const Q_DECL_OVERRIDE;
+    virtual void    UpdateToolData(const quint32 &id, VContainer *data) Q_DECL_OVERRIDE;
+    virtual void    LiteParseTree(const Document &parse) Q_DECL_OVERRIDE;
+
+    /** @brief calculated ids of the tools calculated by the last parse, the rest were replayed. */
+    QVector<quint32> calculated;
+
+private:
+    Q_DISABLE_COPY(TestPattern)
+    VContainer *data;
+
+    void ParsePoint(const QDomElement &domElement, const Document &parse);
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+TestPattern::TestPattern(VContainer *data)
+    : VAbstractPattern(),
+      calculated(),
+      data(data)
+{}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString TestPattern::GenerateLabel(const LabelType &type, const QString &reservedName) const
+{
+    Q_UNUSED(type)
+    Q_UNUSED(reservedName)
+    return QString();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QString TestPattern::GenerateSuffix(const QString &type) const
+{
+    Q_UNUSED(type)
+    return QString();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TestPattern::UpdateToolData(const quint32 &id, VContainer *data)
+{
+    Q_UNUSED(id)
+    Q_UNUSED(data)
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TestPattern::LiteParseTree(const Document &parse)
+{
+    VContainer::ClearUniqueNames();
+    data->ClearVariables(VarType::LineAngle);
+    data->ClearVariables(VarType::LineLength);
+    calculated.clear();
+
+    dependencies.BeginPass();
+    const QDomElement calculation = documentElement().firstChildElement(TagDraftBlock)
+                                                     .firstChildElement(TagCalculation);
+    QDomElement domElement = calculation.firstChildElement();
+    while (not domElement.isNull())
+    {
+        ParseCalculationTool(domElement, parse, data, [this, &domElement, &parse]()
+        {
+            ParsePoint(domElement, parse);
+        });
+        domElement = domElement.nextSiblingElement();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TestPattern::ParsePoint(const QDomElement &domElement, const Document &parse)
+{
+    const quint32 id = GetParametrUInt(domElement, AttrId, NULL_ID_STR);
+    const QString name = GetParametrString(domElement, AttrName);
+    const QString type = GetParametrString(domElement, AttrType);
+    calculated.append(id);
+
+    if (type == QLatin1String("single"))
+    {
+        const qreal x = GetParametrDouble(domElement, AttrX, "0");
+        VToolBasePoint::Create(id, QStringLiteral("A"), new VPointF(x, 0, name, 0, 0), nullptr, this, data, parse,
+                               Source::FromFile);
+    }
+    else if (type == QLatin1String("endLine"))
+    {
+        QString length = GetParametrString(domElement, AttrLength);
+        QString angle = GetParametrString(domElement, AttrAngle);
+        const quint32 basePointId = GetParametrUInt(domElement, AttrBasePoint, NULL_ID_STR);
+        VToolEndLine::Create(id, name, LineTypeSolidLine, ColorBlack, length, angle, basePointId, 0, 0, true, nullptr,
+                             this, data, parse, Source::FromFile);
+    }
+    else
+    {
+        // Stands for a tool that reads the whole variables table
+        data->UpdateGObject(id, new VPointF(data->DataVariables().size(), 0, name, 0, 0));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void LoadPattern(TestPattern &doc)
+{
+    const QString content = QStringLiteral(
+        "<pattern>"
+            "<draftBlock name=\"A\">"
+                "<calculation>"
+                    "<point id=\"1\" type=\"single\" name=\"A\" x=\"0\"/>"
+                    "<point id=\"2\" type=\"endLine\" name=\"B\" basePoint=\"1\" length=\"#a\" angle=\"0\"/>"
+                    "<point id=\"3\" type=\"endLine\" name=\"C\" basePoint=\"1\" length=\"10\" angle=\"90\"/>"
+                    "<point id=\"4\" type=\"endLine\" name=\"D\" basePoint=\"3\" length=\"5\" angle=\"0\"/>"
+                    "<point id=\"5\" type=\"endLine\" name=\"E\" basePoint=\"2\" length=\"1\" angle=\"0\"/>"
+                    "<point id=\"6\" type=\"allVariables\" name=\"F\"/>"
+                "</calculation>"
+            "</draftBlock>"
+        "</pattern>");
+    QVERIFY(doc.setContent(content));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void SetIncrement(VContainer &data, qreal value)
+{
+    data.ClearVariables(VarType::Increment);
+    AddIncrement(data, "#a", value);
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDependencyGraph::TST_VDependencyGraph(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::init()
+{
+    Calculator::ClearFormulaCache();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::UnchangedToolsAreSkipped() const
+{
+    const Unit unit = Unit::Cm;
+    VDependencyGraph graph;
+
+    VContainer first(nullptr, &unit);
+    AddIncrement(first, "#a", 2);
+    graph.BeginPass();
+    QVERIFY(CalculatePoint(graph, first, baseId, 1, NULL_ID, "10"));
+    QVERIFY(CalculatePoint(graph, first, childId, 1, baseId, "#a*3"));
+    QCOMPARE(graph.Count(), 2);
+
+    VContainer second(nullptr, &unit);
+    AddIncrement(second, "#a", 2);
+    graph.BeginPass();
+    QVERIFY(not CalculatePoint(graph, second, baseId, 1, NULL_ID, "10"));
+    QVERIFY(not CalculatePoint(graph, second, childId, 1, baseId, "#a*3"));
+
+    QCOMPARE(PointX(second, baseId), 10.0);
+    QCOMPARE(PointX(second, childId), 16.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::ReplayedObjectsAreCopies() const
+{
+    const Unit unit = Unit::Cm;
+    VDependencyGraph graph;
+
+    VContainer first(nullptr, &unit);
+    graph.BeginPass();
+    CalculatePoint(graph, first, baseId, 1, NULL_ID, "10");
+
+    VContainer second(nullptr, &unit);
+    graph.BeginPass();
+    QVERIFY(not CalculatePoint(graph, second, baseId, 1, NULL_ID, "10"));
+    QVERIFY(first.GetGObject(baseId) != second.GetGObject(baseId));
+
+    // Changes through one container must not reach the record or the other container
+    second.GeometricObject<VPointF>(baseId)->setX(100);
+    first.GeometricObject<VPointF>(baseId)->setX(200);
+
+    VContainer third(nullptr, &unit);
+    graph.BeginPass();
+    QVERIFY(not CalculatePoint(graph, third, baseId, 1, NULL_ID, "10"));
+    QCOMPARE(PointX(third, baseId), 10.0);
+    QCOMPARE(PointX(second, baseId), 100.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::ChangedToolRecalculatesDownstream() const
+{
+    const Unit unit = Unit::Cm;
+    VDependencyGraph graph;
+
+    VContainer first(nullptr, &unit);
+    AddIncrement(first, "#a", 2);
+    graph.BeginPass();
+    CalculatePoint(graph, first, baseId, 1, NULL_ID, "10");
+    CalculatePoint(graph, first, childId, 1, baseId, "#a*3");
+
+    // The base point moved, the child keeps its own options but must follow
+    VContainer second(nullptr, &unit);
+    AddIncrement(second, "#a", 2);
+    graph.BeginPass();
+    QVERIFY(CalculatePoint(graph, second, baseId, 2, NULL_ID, "20"));
+    QVERIFY(CalculatePoint(graph, second, childId, 1, baseId, "#a*3"));
+
+    QCOMPARE(PointX(second, baseId), 20.0);
+    QCOMPARE(PointX(second, childId), 26.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::ChangedVariableRecalculatesTool() const
+{
+    const Unit unit = Unit::Cm;
+    VDependencyGraph graph;
+
+    VContainer first(nullptr, &unit);
+    AddIncrement(first, "#a", 2);
+    graph.BeginPass();
+    CalculatePoint(graph, first, baseId, 1, NULL_ID, "10");
+    CalculatePoint(graph, first, childId, 1, baseId, "#a*3");
+
+    VContainer second(nullptr, &unit);
+    AddIncrement(second, "#a", 5);
+    graph.BeginPass();
+    QVERIFY(not CalculatePoint(graph, second, baseId, 1, NULL_ID, "10"));
+    QVERIFY(CalculatePoint(graph, second, childId, 1, baseId, "#a*3"));
+
+    QCOMPARE(PointX(second, childId), 25.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::UntrackedReadIsNeverSkipped() const
+{
+    const Unit unit = Unit::Cm;
+    VDependencyGraph graph;
+
+    VContainer first(nullptr, &unit);
+    AddIncrement(first, "#a", 2);
+    graph.BeginPass();
+    CalculatePoint(graph, first, baseId, 1, NULL_ID, "10");
+    QVERIFY(CalculatePoint(graph, first, childId, 1, baseId, "0", true));
+    QCOMPARE(graph.Count(), 1);
+
+    // A new variable changes the result of the tool, though none of its recorded inputs changed
+    VContainer second(nullptr, &unit);
+    AddIncrement(second, "#a", 2);
+    AddIncrement(second, "#b", 3);
+    graph.BeginPass();
+    QVERIFY(not CalculatePoint(graph, second, baseId, 1, NULL_ID, "10"));
+    QVERIFY(CalculatePoint(graph, second, childId, 1, baseId, "0", true));
+    QCOMPARE(PointX(second, childId), PointX(first, childId) + 1);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::LiteParseRecalculatesDependentTools() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    TestPattern doc(&data);
+    LoadPattern(doc);
+
+    SetIncrement(data, 2);
+    doc.LiteParseTree(Document::LiteParse);
+    QCOMPARE(doc.calculated, QVector<quint32>() << 1 << 2 << 3 << 4 << 5 << 6);
+    const qreal bX = PointX(data, 2);
+    const qreal dX = PointX(data, 4);
+    const qreal eFromB = PointX(data, 5) - PointX(data, 2);
+
+    // Nothing changed, only the tool with an untracked read runs again
+    SetIncrement(data, 2);
+    doc.LiteParseTree(Document::LiteParse);
+    QCOMPARE(doc.calculated, QVector<quint32>() << 6);
+    QCOMPARE(PointX(data, 2), bX);
+    QCOMPARE(PointX(data, 4), dX);
+
+    // #a moves B and, through it, E. C and D don't depend on it.
+    SetIncrement(data, 5);
+    doc.LiteParseTree(Document::LiteParse);
+    QCOMPARE(doc.calculated, QVector<quint32>() << 2 << 5 << 6);
+    QVERIFY(PointX(data, 2) > bX);
+    QCOMPARE(PointX(data, 5) - PointX(data, 2), eFromB);
+    QCOMPARE(PointX(data, 4), dX);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDependencyGraph::LiteParseRecalculatesChangedTool() const
+{
+    const Unit unit = Unit::Cm;
+    VContainer data(nullptr, &unit);
+    TestPattern doc(&data);
+    LoadPattern(doc);
+
+    SetIncrement(data, 2);
+    doc.LiteParseTree(Document::LiteParse);
+
+    // Edit C in the file, D follows it
+    QDomElement c = doc.elementById(3);
+    c.setAttribute(AttrLength, QStringLiteral("20"));
+
+    SetIncrement(data, 2);
+    doc.LiteParseTree(Document::LiteParse);
+    QCOMPARE(doc.calculated, QVector<quint32>() << 3 << 4 << 6);
+}
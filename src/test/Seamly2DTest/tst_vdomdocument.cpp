@@ -0,0 +1,160 @@
+/***************************************************************************
+ **  @file   tst_vdomdocument.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vdomdocument.h"
+#include "../ifc/xml/vdomdocument.h"
+
+#include <QtTest>
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+void LoadTestDocument(VDomDocument &doc)
+{
+    const QString content = QStringLiteral(
+        "<pattern>"
+            "<draftBlock name=\"A\">"
+                "<calculation>"
+                    "<point id=\"1\"/>"
+                    "<point id=\"2\"/>"
+                "</calculation>"
+                "<modeling>"
+                    "<point id=\"3\"/>"
+                "</modeling>"
+            "</draftBlock>"
+            "<draftBlock name=\"B\">"
+                "<calculation>"
+                    "<line id=\"4\"/>"
+                "</calculation>"
+            "</draftBlock>"
+        "</pattern>");
+    QVERIFY(doc.setContent(content));
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDomDocument::TST_VDomDocument(QObject *parent)
+    : QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::ElementById() const
+{
+    VDomDocument doc;
+    LoadTestDocument(doc);
+
+    for (quint32 id = 1; id <= 4; ++id)
+    {
+        const QDomElement domElement = doc.elementById(id);
+        QVERIFY2(not domElement.isNull(), qUtf8Printable(QStringLiteral("id = %1").arg(id)));
+        QCOMPARE(VDomDocument::GetParametrUInt(domElement, VDomDocument::AttrId, NULL_ID_STR), id);
+    }
+
+    QVERIFY(doc.elementById(NULL_ID).isNull());
+
+    const VDomIndexStatistics statistics = doc.IdIndexStatistics();
+    QCOMPARE(statistics.elements, 4);
+    QCOMPARE(statistics.hits, static_cast<quint64>(4));
+    QCOMPARE(statistics.rebuilds, static_cast<quint64>(1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::ElementByIdAfterInsert() const
+{
+    VDomDocument doc;
+    LoadTestDocument(doc);
+    doc.RefreshElementIdCache();
+
+    QDomElement calculation = doc.elementById(1).parentNode().toElement();
+    QDomElement point = doc.createElement(QStringLiteral("point"));
+    point.setAttribute(VDomDocument::AttrId, 5);
+    calculation.appendChild(point);
+    doc.RegisterElement(point);
+
+    QCOMPARE(doc.elementById(5), point);
+
+    const VDomIndexStatistics statistics = doc.IdIndexStatistics();
+    QCOMPARE(statistics.elements, 5);
+    QCOMPARE(statistics.misses, static_cast<quint64>(0));
+    QCOMPARE(statistics.rebuilds, static_cast<quint64>(1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::ElementByIdAfterRemove() const
+{
+    VDomDocument doc;
+    LoadTestDocument(doc);
+
+    QDomElement point = doc.elementById(2);
+    QVERIFY(not point.isNull());
+    point.parentNode().removeChild(point);
+    doc.UnregisterElement(point);
+
+    QCOMPARE(doc.IdIndexStatistics().elements, 3);
+    QVERIFY(doc.elementById(1).isElement());
+
+    // Undo puts the same element back
+    QDomElement calculation = doc.elementById(1).parentNode().toElement();
+    calculation.appendChild(point);
+    doc.RegisterElement(point);
+    QCOMPARE(doc.elementById(2), point);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::ElementByIdDetachedSubtree() const
+{
+    VDomDocument doc;
+    LoadTestDocument(doc);
+    doc.RefreshElementIdCache();
+
+    // Remove a whole draft block without telling the index
+    QDomElement line = doc.elementById(4);
+    QDomNode draftBlock = line.parentNode().parentNode();
+    doc.documentElement().removeChild(draftBlock);
+
+    QVERIFY(doc.elementById(4).isNull());
+    QVERIFY(doc.elementById(3).isElement());
+
+    // A miss doesn't rebuild the index
+    const VDomIndexStatistics statistics = doc.IdIndexStatistics();
+    QCOMPARE(statistics.misses, static_cast<quint64>(1));
+    QCOMPARE(statistics.rebuilds, static_cast<quint64>(1));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDomDocument::ElementByIdChecksTag() const
+{
+    VDomDocument doc;
+    LoadTestDocument(doc);
+
+    QVERIFY(doc.elementById(4, QStringLiteral("line")).isElement());
+    QVERIFY(doc.elementById(4, QStringLiteral("point")).isNull());
+    QVERIFY(doc.elementById(3, QStringLiteral("point")).isElement());
+    QVERIFY(doc.elementById(99, QStringLiteral("point")).isNull());
+
+    const VDomIndexStatistics statistics = doc.IdIndexStatistics();
+    QCOMPARE(statistics.hits, static_cast<quint64>(2));
+    QCOMPARE(statistics.misses, static_cast<quint64>(2));
+    QCOMPARE(statistics.rebuilds, static_cast<quint64>(1));
+}
@@ -0,0 +1,273 @@
+/***************************************************************************
+ **  @file   tst_vdxfpaintdevice.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vdxfpaintdevice.h"
+#include "../vdxf/vdxfpaintdevice.h"
+#include "../vdxf/dxfdef.h"
+#include "../vdxf/libdxfrw/drw_interface.h"
+#include "../vdxf/libdxfrw/libdxfrw.h"
+#include "../vlayout/vlayoutpiece.h"
+
+#include <QPainter>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+Q_DECLARE_METATYPE(DRW::Version)
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QString Coord(double x, double y)
+{
+    return QString("(%1;%2)").arg(x, 0, 'f', 3).arg(y, 0, 'f', 3);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief The DxfSummary class reads a DXF file back and keeps one line per block and entity, in file order.
+ */
+class DxfSummary : public DRW_Interface
+{
+public:
+    DxfSummary()
+        : lines(),
+          block()
+    {}
+
+    virtual void addBlock(const DRW_Block &data) Q_DECL_OVERRIDE
+    {
+        block = QString::fromStdString(data.name);
+        lines.append(QString("BLOCK %1").arg(block));
+    }
+
+    virtual void endBlock() Q_DECL_OVERRIDE
+    {
+        lines.append(QString("ENDBLK %1").arg(block));
+        block.clear();
+    }
+
+    virtual void addLine(const DRW_Line &data) Q_DECL_OVERRIDE
+    {
+        Add(data, QString("LINE %1 %2").arg(Coord(data.basePoint.x, data.basePoint.y),
+                                             Coord(data.secPoint.x, data.secPoint.y)));
+    }
+
+    virtual void addLWPolyline(const DRW_LWPolyline &data) Q_DECL_OVERRIDE
+    {
+        QString points;
+        for (const DRW_Vertex2D *vertex : data.vertlist)
+        {
+            points += Coord(vertex->x, vertex->y);
+        }
+        Add(data, QString("POLYLINE %1 %2").arg(data.flags).arg(points));
+    }
+
+    virtual void addPolyline(const DRW_Polyline &data) Q_DECL_OVERRIDE
+    {
+        QString points;
+        for (const DRW_Vertex *vertex : data.vertlist)
+        {
+            points += Coord(vertex->basePoint.x, vertex->basePoint.y);
+        }
+        Add(data, QString("POLYLINE %1 %2").arg(data.flags & 1).arg(points));
+    }
+
+    virtual void addText(const DRW_Text &data) Q_DECL_OVERRIDE
+    {
+        Add(data, QString("TEXT %1 %2 %3").arg(QString::fromStdString(data.text), QString::fromStdString(data.style),
+                                               Coord(data.basePoint.x, data.basePoint.y)));
+    }
+
+    virtual void addInsert(const DRW_Insert &data) Q_DECL_OVERRIDE
+    {
+        Add(data, QString("INSERT %1").arg(QString::fromStdString(data.name)));
+    }
+
+    QStringList lines;
+
+private:
+    QString block;
+
+    void Add(const DRW_Entity &data, const QString &entity)
+    {
+        lines.append(QString("%1 %2 %3").arg(block, QString::fromStdString(data.layer), entity));
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList ReadBack(const QString &fileName)
+{
+    DxfSummary summary;
+    dxfRW reader(fileName.toLocal8Bit().constData());
+    if (not reader.read(&summary, false))
+    {
+        return QStringList();
+    }
+    return summary.lines;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void PrepareDevice(VDxfPaintDevice &device, const QString &fileName, DRW::Version version, bool binary,
+                   bool streaming)
+{
+    device.setFileName(fileName);
+    device.setSize(QSize(800, 600));
+    device.setResolution(96);
+    device.SetVersion(version);
+    device.SetBinaryFormat(binary);
+    device.setInsunits(VarInsunits::Millimeters);
+    device.SetStreaming(streaming);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList PaintFlat(const QString &fileName, DRW::Version version, bool binary, bool streaming)
+{
+    QFont font;
+    font.setPointSize(12);
+
+    VDxfPaintDevice device;
+    PrepareDevice(device, fileName, version, binary, streaming);
+    device.AddFont(font);
+
+    QPainter painter;
+    if (not painter.begin(&device))
+    {
+        return QStringList();
+    }
+    painter.setFont(font);
+    painter.setPen(QPen(Qt::black, 1, Qt::SolidLine));
+    painter.drawLine(QLineF(10, 10, 200, 10));
+    painter.drawPolyline(QPolygonF() << QPointF(10, 50) << QPointF(100, 60) << QPointF(150, 120));
+    painter.drawPolygon(QPolygonF() << QPointF(300, 300) << QPointF(500, 300) << QPointF(400, 450));
+    painter.setPen(QPen(Qt::red, 1, Qt::DashLine));
+    painter.drawLine(QLineF(20, 500, 700, 500));
+    painter.drawText(QPointF(50, 250), QStringLiteral("Piece") + endStringPlaceholder);
+    painter.end();
+
+    return ReadBack(fileName);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> AAMAPieces()
+{
+    QVector<VLayoutPiece> pieces;
+    for (int i = 0; i < 2; ++i)
+    {
+        VLayoutPiece piece;
+        piece.SetName(QString("Piece %1").arg(i + 1));
+        piece.SetCountourPoints(QVector<QPointF>() << QPointF(0, 0) << QPointF(100 + i*20, 0)
+                                                   << QPointF(100 + i*20, 80) << QPointF(0, 80));
+        piece.setSeamAllowancePoints(QVector<QPointF>() << QPointF(-10, -10) << QPointF(110 + i*20, -10)
+                                                        << QPointF(110 + i*20, 90) << QPointF(-10, 90));
+        piece.setNotches(QVector<QLineF>() << QLineF(50, -10, 50, 0));
+        pieces.append(piece);
+    }
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QStringList ExportAAMA(const QString &fileName, DRW::Version version, bool binary, bool streaming)
+{
+    VDxfPaintDevice device;
+    PrepareDevice(device, fileName, version, binary, streaming);
+    if (not device.ExportToAAMA(AAMAPieces()))
+    {
+        return QStringList();
+    }
+    return ReadBack(fileName);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AddVersionRows()
+{
+    QTest::addColumn<DRW::Version>("version");
+    QTest::addColumn<bool>("binary");
+
+    QTest::newRow("R12") << DRW::AC1009 << false;
+    QTest::newRow("2000") << DRW::AC1015 << false;
+    QTest::newRow("2000 binary") << DRW::AC1015 << true;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VDxfPaintDevice::TST_VDxfPaintDevice(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDxfPaintDevice::FlatStreamMatchesInMemory_data() const
+{
+    AddVersionRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDxfPaintDevice::FlatStreamMatchesInMemory() const
+{
+    QFETCH(DRW::Version, version);
+    QFETCH(bool, binary);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QStringList inMemory = PaintFlat(dir.path() + QStringLiteral("/memory.dxf"), version, binary, false);
+    const QStringList streamed = PaintFlat(dir.path() + QStringLiteral("/stream.dxf"), version, binary, true);
+
+    QVERIFY(not inMemory.isEmpty());
+    QVERIFY(inMemory.filter(QStringLiteral("LINE")).size() >= 3);
+    QCOMPARE(inMemory.filter(QStringLiteral("TEXT Piece")).size(), 1);
+    QCOMPARE(streamed, inMemory);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDxfPaintDevice::AAMAStreamMatchesInMemory_data() const
+{
+    AddVersionRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VDxfPaintDevice::AAMAStreamMatchesInMemory() const
+{
+    QFETCH(DRW::Version, version);
+    QFETCH(bool, binary);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    const QStringList inMemory = ExportAAMA(dir.path() + QStringLiteral("/memory.dxf"), version, binary, false);
+    const QStringList streamed = ExportAAMA(dir.path() + QStringLiteral("/stream.dxf"), version, binary, true);
+
+    // Every piece is a block with its outline, seam line and notch, and is inserted into the model space
+    const QString piece1 = version <= DRW::AC1009 ? QStringLiteral("Piece_1") : QStringLiteral("Piece 1");
+    QVERIFY(inMemory.contains(QString("BLOCK %1").arg(piece1)));
+    QVERIFY(inMemory.contains(QString("ENDBLK %1").arg(piece1)));
+    QCOMPARE(inMemory.filter(QString("%1 1 POLYLINE").arg(piece1)).size(), 1);
+    QCOMPARE(inMemory.filter(QString("%1 8 POLYLINE").arg(piece1)).size(), 1);
+    QCOMPARE(inMemory.filter(QString("%1 4 LINE").arg(piece1)).size(), 1);
+    QCOMPARE(inMemory.filter(QStringLiteral("INSERT")).size(), 2);
+    QCOMPARE(streamed, inMemory);
+}
@@ -53,6 +53,45 @@
 #include "../vlayout/vlayoutpiece.h"
 
 #include <QtDebug>
+#include <QtTest>
+
+namespace
+{
+enum class PieceOperation : char
+{
+    Translate,
+    Rotate,
+    Mirror
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPiece MakeCachePiece()
+{
+    VLayoutPiece piece;
+    piece.SetCountourPoints(QVector<QPointF>() << QPointF(0, 0) << QPointF(100, 0) << QPointF(100, 60)
+                                               << QPointF(40, 60) << QPointF(40, 120) << QPointF(0, 120));
+    piece.SetLayoutWidth(5);
+    piece.SetLayoutAllowancePoints();
+    return piece;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void ApplyOperation(VLayoutPiece &piece, PieceOperation operation)
+{
+    switch (operation)
+    {
+        case PieceOperation::Translate:
+            piece.Translate(35, -12);
+            break;
+        case PieceOperation::Rotate:
+            piece.Rotate(QPointF(20, 30), 30);
+            break;
+        case PieceOperation::Mirror:
+            piece.Mirror(QLineF(0, 0, 100, 50));
+            break;
+    }
+}
+}
 
 //---------------------------------------------------------------------------------------------------------------------
 TST_VLayoutDetail::TST_VLayoutDetail(QObject *parent)
@@ -73,6 +112,46 @@ void TST_VLayoutDetail::RemoveDublicates() const
     Case3();
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutDetail::CacheInvalidation_data() const
+{
+    QTest::addColumn<int>("operation");
+
+    QTest::newRow("Translate") << static_cast<int>(PieceOperation::Translate);
+    QTest::newRow("Rotate") << static_cast<int>(PieceOperation::Rotate);
+    QTest::newRow("Mirror") << static_cast<int>(PieceOperation::Mirror);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CacheInvalidation checks that a piece with filled cache gives after transformation the same points, edges and
+ * bounding rects as a piece that was never asked before.
+ */
+void TST_VLayoutDetail::CacheInvalidation() const
+{
+    QFETCH(int, operation);
+
+    VLayoutPiece cached = MakeCachePiece();
+    cached.CacheMappedPoints();
+    const QVector<QPointF> contourBefore = cached.getContourPoints();
+    const QRectF layoutRectBefore = cached.LayoutBoundingRect();
+
+    VLayoutPiece fresh = MakeCachePiece();
+
+    ApplyOperation(cached, static_cast<PieceOperation>(operation));
+    ApplyOperation(fresh, static_cast<PieceOperation>(operation));
+
+    QVERIFY(cached.getContourPoints() != contourBefore);
+    QVERIFY(cached.LayoutBoundingRect() != layoutRectBefore);
+
+    Comparison(cached.getContourPoints(), fresh.getContourPoints());
+    Comparison(cached.getLayoutAllowancePoints(), fresh.getLayoutAllowancePoints());
+    QCOMPARE(cached.pieceBoundingRect(), fresh.pieceBoundingRect());
+    QCOMPARE(cached.LayoutBoundingRect(), fresh.LayoutBoundingRect());
+    QCOMPARE(cached.LayoutEdge(1), fresh.LayoutEdge(1));
+    QCOMPARE(cached.pieceEdge(1), fresh.pieceEdge(1));
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VLayoutDetail::Case1() const
 {
@@ -62,6 +62,8 @@ class TST_VLayoutDetail : public AbstractTest
 
 private slots:
     void RemoveDublicates() const;
+    void CacheInvalidation_data() const;
+    void CacheInvalidation() const;
 
 private:
     void Case1() const;
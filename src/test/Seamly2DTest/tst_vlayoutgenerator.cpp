@@ -0,0 +1,197 @@
+/***************************************************************************
+ **  @file   tst_vlayoutgenerator.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vlayoutgenerator.h"
+#include "../vlayout/vlayoutgenerator.h"
+#include "../vlayout/vlayoutpiece.h"
+
+#include <QMarginsF>
+#include <QThread>
+#include <QThreadPool>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+VLayoutPiece MakePiece(const QVector<QPointF> &points)
+{
+    VLayoutPiece piece;
+    piece.SetCountourPoints(points);
+    return piece;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<VLayoutPiece> TestPieces()
+{
+    QVector<VLayoutPiece> pieces;
+    for (int i = 0; i < 3; ++i)
+    {
+        pieces.append(MakePiece(QVector<QPointF>() << QPointF(0, 0) << QPointF(120 + i*15, 0)
+                                                   << QPointF(120 + i*15, 80) << QPointF(0, 80)));
+        pieces.append(MakePiece(QVector<QPointF>() << QPointF(0, 0) << QPointF(90, 0) << QPointF(90, 40)
+                                                   << QPointF(40, 40) << QPointF(40, 110 + i*10)
+                                                   << QPointF(0, 110 + i*10)));
+        pieces.append(MakePiece(QVector<QPointF>() << QPointF(0, 0) << QPointF(100, 20) << QPointF(60, 90 + i*5)));
+    }
+    return pieces;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QVector<QVector<VLayoutPiece>> Arrange(LayoutEngine engine, int attempts, int threads)
+{
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int oldThreads = pool->maxThreadCount();
+    pool->setMaxThreadCount(threads);
+
+    VLayoutGenerator generator;
+    generator.setPieces(TestPieces());
+    generator.SetLayoutWidth(5);
+    generator.SetPaperWidth(400);
+    generator.SetPaperHeight(1000);
+    generator.SetPrinterFields(false, QMarginsF());
+    generator.SetShift(0);
+    generator.SetRotate(true);
+    generator.SetRotationIncrease(90);
+    generator.SetSaveLength(true);
+    generator.SetEngine(engine);
+    generator.SetAttempts(attempts);
+    generator.Generate();
+
+    pool->setMaxThreadCount(oldThreads);
+
+    return generator.State() == LayoutErrors::NoError ? generator.getAllPieces() : QVector<QVector<VLayoutPiece>>();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int PiecesCount(const QVector<QVector<VLayoutPiece>> &sheets)
+{
+    int count = 0;
+    for (int i = 0; i < sheets.size(); ++i)
+    {
+        count += sheets.at(i).size();
+    }
+    return count;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+qreal UsedLength(const QVector<QVector<VLayoutPiece>> &sheets)
+{
+    qreal length = 0;
+    for (int i = 0; i < sheets.size(); ++i)
+    {
+        QRectF rect;
+        for (int j = 0; j < sheets.at(i).size(); ++j)
+        {
+            rect = rect.united(sheets.at(i).at(j).LayoutBoundingRect());
+        }
+        length += rect.height();
+    }
+    return length;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutGenerator::TST_VLayoutGenerator(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::StableAcrossThreadCounts_data() const
+{
+    QTest::addColumn<int>("engine");
+    QTest::addColumn<int>("attempts");
+
+    QTest::newRow("Edge to edge, one attempt") << static_cast<int>(LayoutEngine::EdgeToEdge) << 1;
+    QTest::newRow("Edge to edge, three attempts") << static_cast<int>(LayoutEngine::EdgeToEdge) << 3;
+    QTest::newRow("No-fit polygon, one attempt") << static_cast<int>(LayoutEngine::NoFitPolygon) << 1;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StableAcrossThreadCounts checks that the layout doesn't depend on how many threads search positions.
+ */
+void TST_VLayoutGenerator::StableAcrossThreadCounts() const
+{
+    QFETCH(int, engine);
+    QFETCH(int, attempts);
+
+    const QVector<QVector<VLayoutPiece>> serial = Arrange(static_cast<LayoutEngine>(engine), attempts, 1);
+    QVERIFY2(not serial.isEmpty(), "Layout failed.");
+
+    for (int threads = 2; threads <= 8; threads *= 2)
+    {
+        const QVector<QVector<VLayoutPiece>> parallel = Arrange(static_cast<LayoutEngine>(engine), attempts,
+                                                                threads);
+        QCOMPARE(parallel.size(), serial.size());
+        for (int i = 0; i < serial.size(); ++i)
+        {
+            QCOMPARE(parallel.at(i).size(), serial.at(i).size());
+            for (int j = 0; j < serial.at(i).size(); ++j)
+            {
+                QCOMPARE(parallel.at(i).at(j).getTransform(), serial.at(i).at(j).getTransform());
+                QCOMPARE(parallel.at(i).at(j).isMirror(), serial.at(i).at(j).isMirror());
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutGenerator::MultiStartNotWorse_data() const
+{
+    QTest::addColumn<int>("attempts");
+
+    QTest::newRow("Two attempts") << 2;
+    QTest::newRow("Five attempts") << 5;
+    QTest::newRow("Twelve attempts") << 12;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief MultiStartNotWorse checks that attempts arrange all pieces and that the kept layout is not worse than the
+ * single greedy pass, which is the same as the first attempt.
+ */
+void TST_VLayoutGenerator::MultiStartNotWorse() const
+{
+    QFETCH(int, attempts);
+
+    const int threads = qMax(2, QThread::idealThreadCount());
+    const QVector<QVector<VLayoutPiece>> single = Arrange(LayoutEngine::EdgeToEdge, 1, threads);
+    const QVector<QVector<VLayoutPiece>> multi = Arrange(LayoutEngine::EdgeToEdge, attempts, threads);
+
+    QVERIFY2(not single.isEmpty(), "Layout failed.");
+    QVERIFY2(not multi.isEmpty(), "Multi-start layout failed.");
+
+    QCOMPARE(PiecesCount(single), TestPieces().size());
+    QCOMPARE(PiecesCount(multi), TestPieces().size());
+
+    QVERIFY(multi.size() <= single.size());
+    if (multi.size() == single.size())
+    {
+        QVERIFY(UsedLength(multi) <= UsedLength(single) + 0.001);
+    }
+}
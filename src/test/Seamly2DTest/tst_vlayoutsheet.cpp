@@ -0,0 +1,120 @@
+/***************************************************************************
+ **  @file   tst_vlayoutsheet.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vlayoutsheet.h"
+#include "../vlayout/vlayoutsheet.h"
+#include "../vlayout/vlayoutpiece.h"
+
+#include <QImage>
+#include <QPainter>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+QImage PaintSheet(const VLayoutSheet &sheet, const QSize &size, const QRectF &target, bool paintPaper)
+{
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter painter(&image);
+    sheet.Paint(&painter, target, paintPaper);
+    painter.end();
+    return image;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+bool HasInk(const QImage &image, const QRect &window)
+{
+    for (int y = window.top(); y <= window.bottom(); ++y)
+    {
+        for (int x = window.left(); x <= window.right(); ++x)
+        {
+            if (qAlpha(image.pixel(x, y)) > 0)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VLayoutSheet::TST_VLayoutSheet(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutSheet::Paper_data() const
+{
+    QTest::addColumn<bool>("paintPaper");
+
+    QTest::newRow("Raster, paper is painted") << true;
+    QTest::newRow("SVG, paper is not painted") << false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutSheet::Paper() const
+{
+    QFETCH(bool, paintPaper);
+
+    const VLayoutSheet sheet(QRectF(0, 0, 100, 50), QVector<VLayoutPiece>(), false);
+    const QImage image = PaintSheet(sheet, QSize(140, 90), QRectF(20, 20, 100, 50), paintPaper);
+
+    // Inside the paper the background of the device stays unless the paper is painted
+    QCOMPARE(image.pixel(70, 45), paintPaper ? qRgba(255, 255, 255, 255) : qRgba(0, 0, 0, 0));
+
+    // Outside the paper it always stays
+    QCOMPARE(qAlpha(image.pixel(10, 10)), 0);
+    QCOMPARE(qAlpha(image.pixel(130, 80)), 0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VLayoutSheet::PiecesMappedToTarget() const
+{
+    VLayoutPiece piece;
+    piece.SetCountourPoints(QVector<QPointF>() << QPointF(120, 60) << QPointF(180, 60) << QPointF(180, 90)
+                                               << QPointF(120, 90));
+
+    // The paper does not start at the origin and is painted at twice its size
+    const VLayoutSheet sheet(QRectF(100, 50, 100, 50), QVector<VLayoutPiece>() << piece, false);
+    QCOMPARE(sheet.PaperRect(), QRectF(100, 50, 100, 50));
+
+    const QImage image = PaintSheet(sheet, QSize(200, 100), QRectF(0, 0, 200, 100), false);
+
+    // Edges of the piece
+    QVERIFY(HasInk(image, QRect(38, 45, 5, 10)));  // x = 120
+    QVERIFY(HasInk(image, QRect(158, 45, 5, 10))); // x = 180
+    QVERIFY(HasInk(image, QRect(95, 18, 10, 5)));  // y = 60
+    QVERIFY(HasInk(image, QRect(95, 78, 10, 5)));  // y = 90
+
+    // Inside and outside the piece nothing is painted
+    QVERIFY(not HasInk(image, QRect(90, 45, 20, 10)));
+    QVERIFY(not HasInk(image, QRect(0, 0, 30, 10)));
+}
@@ -0,0 +1,132 @@
+/***************************************************************************
+ **  @file   tst_vnfpposition.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vnfpposition.h"
+#include "../vlayout/vnfpposition.h"
+
+#include <QtTest>
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VNfpPosition::TST_VNfpPosition(QObject *parent)
+    :AbstractTest(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNfpPosition::ConvexHull_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("points");
+    QTest::addColumn<QVector<QPointF>>("expect");
+
+    QVector<QPointF> expect;
+    expect << QPointF(0, 0);
+    expect << QPointF(10, 0);
+    expect << QPointF(10, 10);
+    expect << QPointF(0, 10);
+
+    QVector<QPointF> points;
+    points << QPointF(10, 10);
+    points << QPointF(0, 0);
+    points << QPointF(0, 10);
+    points << QPointF(10, 0);
+    QTest::newRow("Square") << points << expect;
+
+    points << QPointF(5, 5);
+    points << QPointF(5, 0);
+    points << QPointF(3, 7);
+    QTest::newRow("Square with inner and collinear points") << points << expect;
+
+    points.clear();
+    points << QPointF(0, 0);
+    points << QPointF(10, 0);
+    points << QPointF(10, 10);
+    points << QPointF(5, 2);
+    points << QPointF(0, 10);
+    QTest::newRow("Concave polygon") << points << expect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNfpPosition::ConvexHull() const
+{
+    QFETCH(QVector<QPointF>, points);
+    QFETCH(QVector<QPointF>, expect);
+
+    Comparison(VNfpPosition::ConvexHull(points), expect);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNfpPosition::MinkowskiSum_data() const
+{
+    QTest::addColumn<QVector<QPointF>>("a");
+    QTest::addColumn<QVector<QPointF>>("b");
+    QTest::addColumn<QVector<QPointF>>("expect");
+
+    QVector<QPointF> square;
+    square << QPointF(0, 0);
+    square << QPointF(1, 0);
+    square << QPointF(1, 1);
+    square << QPointF(0, 1);
+
+    QVector<QPointF> expect;
+    expect << QPointF(0, 0);
+    expect << QPointF(2, 0);
+    expect << QPointF(2, 2);
+    expect << QPointF(0, 2);
+    QTest::newRow("Square and square") << square << square << expect;
+
+    QVector<QPointF> reflected;
+    reflected << QPointF(0, 0);
+    reflected << QPointF(-1, 0);
+    reflected << QPointF(-1, -1);
+    reflected << QPointF(0, -1);
+
+    expect.clear();
+    expect << QPointF(-1, -1);
+    expect << QPointF(1, -1);
+    expect << QPointF(1, 1);
+    expect << QPointF(-1, 1);
+    QTest::newRow("Square and reflected square (no-fit polygon)") << square << reflected << expect;
+
+    QVector<QPointF> triangle;
+    triangle << QPointF(0, 0);
+    triangle << QPointF(1, 0);
+    triangle << QPointF(0, 1);
+
+    expect.clear();
+    expect << QPointF(0, 0);
+    expect << QPointF(2, 0);
+    expect << QPointF(2, 1);
+    expect << QPointF(1, 2);
+    expect << QPointF(0, 2);
+    QTest::newRow("Square and triangle") << square << triangle << expect;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VNfpPosition::MinkowskiSum() const
+{
+    QFETCH(QVector<QPointF>, a);
+    QFETCH(QVector<QPointF>, b);
+    QFETCH(QVector<QPointF>, expect);
+
+    Comparison(VNfpPosition::MinkowskiSum(a, b), expect);
+}
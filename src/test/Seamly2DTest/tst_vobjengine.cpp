@@ -0,0 +1,186 @@
+/***************************************************************************
+ **  @file   tst_vobjengine.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vobjengine.h"
+#include "../vobj/vobjengine.h"
+
+#include <QPolygonF>
+#include <QtMath>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+qreal SignedArea(const QPolygonF &polygon)
+{
+    qreal area = 0;
+    for (int i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++)
+    {
+        area += polygon.at(j).x() * polygon.at(i).y() - polygon.at(i).x() * polygon.at(j).y();
+    }
+    return area / 2;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF Regular(int corners, qreal radius, qreal innerRadius = 0)
+{
+    QPolygonF polygon;
+    const int count = qFuzzyIsNull(innerRadius) ? corners : corners * 2;
+    for (int i = 0; i < count; ++i)
+    {
+        const qreal r = (qFuzzyIsNull(innerRadius) || i % 2 == 0) ? radius : innerRadius;
+        const qreal angle = 2 * M_PI * i / count;
+        polygon << QPointF(r * qCos(angle), r * qSin(angle));
+    }
+    return polygon;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QPolygonF Reversed(const QPolygonF &polygon)
+{
+    QPolygonF reversed;
+    for (int i = polygon.size() - 1; i >= 0; --i)
+    {
+        reversed << polygon.at(i);
+    }
+    return reversed;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VObjEngine::TST_VObjEngine(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VObjEngine::Triangulate_data() const
+{
+    QTest::addColumn<QPolygonF>("polygon");
+    QTest::addColumn<bool>("simplified");// Collinear or duplicate points may be dropped without a triangle
+
+    const QPolygonF square = QPolygonF() << QPointF(0, 0) << QPointF(100, 0) << QPointF(100, 100) << QPointF(0, 100);
+    const QPolygonF lShape = QPolygonF() << QPointF(0, 0) << QPointF(100, 0) << QPointF(100, 30) << QPointF(30, 30)
+                                         << QPointF(30, 100) << QPointF(0, 100);
+    // Tips at different heights, aligned tips become collinear while clipping and are dropped without a face
+    const QPolygonF comb = QPolygonF() << QPointF(0, 0) << QPointF(90, 0) << QPointF(90, 100) << QPointF(70, 95)
+                                       << QPointF(70, 20) << QPointF(55, 25) << QPointF(55, 100) << QPointF(35, 90)
+                                       << QPointF(35, 15) << QPointF(20, 22) << QPointF(20, 100) << QPointF(0, 95);
+    const QPolygonF spiral = QPolygonF() << QPointF(0, 0) << QPointF(100, 0) << QPointF(100, 100) << QPointF(20, 100)
+                                         << QPointF(20, 40) << QPointF(70, 40) << QPointF(70, 70) << QPointF(50, 70)
+                                         << QPointF(50, 60) << QPointF(60, 60) << QPointF(60, 50) << QPointF(30, 50)
+                                         << QPointF(30, 90) << QPointF(90, 90) << QPointF(90, 10) << QPointF(0, 10);
+
+    QTest::newRow("Triangle") << (QPolygonF() << QPointF(0, 0) << QPointF(10, 0) << QPointF(0, 10)) << false;
+    QTest::newRow("Square, counterclockwise") << square << false;
+    QTest::newRow("Square, clockwise") << Reversed(square) << false;
+    QTest::newRow("Regular hexagon") << Regular(6, 50) << false;
+    QTest::newRow("Regular 64-gon") << Regular(64, 500) << false;
+    QTest::newRow("L shape") << lShape << false;
+    QTest::newRow("L shape, clockwise") << Reversed(lShape) << false;
+    QTest::newRow("Star") << Regular(5, 100, 40) << false;
+    QTest::newRow("Comb") << comb << false;
+    QTest::newRow("Comb, clockwise") << Reversed(comb) << false;
+    QTest::newRow("Spiral") << spiral << false;
+    QTest::newRow("Spiral, clockwise") << Reversed(spiral) << false;
+
+    QTest::newRow("Square with points on the edges")
+            << (QPolygonF() << QPointF(0, 0) << QPointF(50, 0) << QPointF(100, 0) << QPointF(100, 50)
+                            << QPointF(100, 100) << QPointF(50, 100) << QPointF(0, 100) << QPointF(0, 50))
+            << true;
+    QTest::newRow("L shape with collinear points")
+            << (QPolygonF() << QPointF(0, 0) << QPointF(60, 0) << QPointF(100, 0) << QPointF(100, 30)
+                            << QPointF(60, 30) << QPointF(30, 30) << QPointF(30, 100) << QPointF(0, 100)
+                            << QPointF(0, 40))
+            << true;
+    QTest::newRow("Square with a repeated point")
+            << (QPolygonF() << QPointF(0, 0) << QPointF(100, 0) << QPointF(100, 0) << QPointF(100, 100)
+                            << QPointF(0, 100))
+            << true;
+    QTest::newRow("Closed L shape") << (QPolygonF(lShape) << lShape.first()) << true;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VObjEngine::Triangulate() const
+{
+    QFETCH(QPolygonF, polygon);
+    QFETCH(bool, simplified);
+
+    const QVector<int> triangles = VObjEngine::Triangulate(polygon);
+    QCOMPARE(triangles.size() % 3, 0);
+
+    const int count = triangles.size() / 3;
+    const int expected = polygon.size() - 2;
+    if (simplified)
+    {
+        QVERIFY2(count > 0 && count <= expected,
+                 qUtf8Printable(QString("Got %1 triangles, expected at most %2.").arg(count).arg(expected)));
+    }
+    else
+    {
+        QCOMPARE(count, expected);
+    }
+
+    const qreal polygonArea = SignedArea(polygon);
+    qreal sum = 0;
+    for (int i = 0; i < triangles.size(); i += 3)
+    {
+        for (int n = i; n < i + 3; ++n)
+        {
+            QVERIFY(triangles.at(n) >= 0 && triangles.at(n) < polygon.size());
+        }
+
+        const qreal area = SignedArea(QPolygonF() << polygon.at(triangles.at(i)) << polygon.at(triangles.at(i + 1))
+                                                  << polygon.at(triangles.at(i + 2)));
+        // Every face is wound like the outline and covers some area
+        QVERIFY2(area * polygonArea > 0, qUtf8Printable(QString("Triangle %1 is flipped or empty.").arg(i / 3)));
+        sum += area;
+    }
+
+    QVERIFY2(qAbs(sum - polygonArea) <= qAbs(polygonArea) * 1e-9,
+             qUtf8Printable(QString("Triangles cover %1, polygon %2.").arg(sum).arg(polygonArea)));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VObjEngine::TriangulateDegenerate_data() const
+{
+    QTest::addColumn<QPolygonF>("polygon");
+
+    QTest::newRow("Empty") << QPolygonF();
+    QTest::newRow("Two points") << (QPolygonF() << QPointF(0, 0) << QPointF(10, 10));
+    QTest::newRow("Points on a line") << (QPolygonF() << QPointF(0, 0) << QPointF(10, 10) << QPointF(20, 20)
+                                                      << QPointF(5, 5));
+    QTest::newRow("One point repeated") << (QPolygonF() << QPointF(3, 4) << QPointF(3, 4) << QPointF(3, 4));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VObjEngine::TriangulateDegenerate() const
+{
+    QFETCH(QPolygonF, polygon);
+
+    QVERIFY(VObjEngine::Triangulate(polygon).isEmpty());
+}
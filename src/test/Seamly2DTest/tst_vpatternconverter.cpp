@@ -0,0 +1,186 @@
+/***************************************************************************
+ **  @file   tst_vpatternconverter.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vpatternconverter.h"
+#include "../ifc/xml/vpatternconverter.h"
+#include "../ifc/exception/vexception.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief CopyOldPattern copy the 0.2.2 test pattern into dir, the converter leaves a reserve file next to it.
+ */
+QString CopyOldPattern(const QTemporaryDir &dir)
+{
+    const QString source = QFINDTESTDATA("tst_seamly2d/issue_256.val");
+    const QString copy = dir.path() + QLatin1String("/issue_256.val");
+    if (source.isEmpty() or not QFile::copy(source, copy))
+    {
+        return QString();
+    }
+    return copy;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QByteArray ReadAll(const QString &fileName)
+{
+    QFile file(fileName);
+    if (not file.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+    return file.readAll();
+}
+} // anonymous namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VPatternConverter::TST_VPatternConverter(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief ConvertKeepsSourceFile all conversion steps run in memory, the opened file must not be touched.
+ */
+void TST_VPatternConverter::ConvertKeepsSourceFile()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = CopyOldPattern(dir);
+    QVERIFY2(not fileName.isEmpty(), "Can't copy the test pattern.");
+    const QByteArray before = ReadAll(fileName);
+
+    try
+    {
+        VPatternConverter converter(fileName);
+        const QString converted = converter.Convert();
+
+        QVERIFY(converted != fileName);
+        QCOMPARE(ReadAll(fileName), before);
+        QVERIFY(QFileInfo(dir.path() + QLatin1String("/issue_256_v022.val")).exists());
+    }
+    catch (VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPatternConverter::ConvertedFileIsCurrentVersion()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = CopyOldPattern(dir);
+    QVERIFY2(not fileName.isEmpty(), "Can't copy the test pattern.");
+
+    try
+    {
+        VPatternConverter converter(fileName);
+        const QString converted = converter.Convert();
+
+        // Only the result is validated during the conversion, it must match the current schema.
+        VDomDocument::ValidateXML(VPatternConverter::CurrentSchema, converted);
+
+        const VPatternConverter result(converted);
+        const int maxVer = VPatternConverter::PatternMaxVer;
+        QCOMPARE(result.GetCurrentFormatVarsion(), maxVer);
+    }
+    catch (VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+/**
+ * @brief StrictValidationSameResult validating every intermediate step must not change the converted file.
+ */
+void TST_VPatternConverter::StrictValidationSameResult()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = CopyOldPattern(dir);
+    QVERIFY2(not fileName.isEmpty(), "Can't copy the test pattern.");
+
+    const bool strict = VAbstractConverter::IsStrictValidation();
+    try
+    {
+        VAbstractConverter::SetStrictValidation(false);
+        VPatternConverter lax(fileName);
+        const QByteArray laxResult = ReadAll(lax.Convert());
+
+        VAbstractConverter::SetStrictValidation(true);
+        VPatternConverter checked(fileName);
+        const QByteArray checkedResult = ReadAll(checked.Convert());
+
+        VAbstractConverter::SetStrictValidation(strict);
+
+        QVERIFY(not laxResult.isEmpty());
+        QCOMPARE(checkedResult, laxResult);
+    }
+    catch (VException &e)
+    {
+        VAbstractConverter::SetStrictValidation(strict);
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VPatternConverter::CurrentVersionNotConverted()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString fileName = CopyOldPattern(dir);
+    QVERIFY2(not fileName.isEmpty(), "Can't copy the test pattern.");
+
+    try
+    {
+        VPatternConverter converter(fileName);
+        const QByteArray converted = ReadAll(converter.Convert());
+
+        const QString current = dir.path() + QLatin1String("/current.val");
+        QFile file(current);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        QCOMPARE(file.write(converted), converted.size());
+        file.close();
+
+        VPatternConverter upToDate(current);
+        QCOMPARE(upToDate.Convert(), current);
+        QCOMPARE(ReadAll(current), converted);
+    }
+    catch (VException &e)
+    {
+        QFAIL(qUtf8Printable(e.ErrorMessage()));
+    }
+}
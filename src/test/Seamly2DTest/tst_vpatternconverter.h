@@ -0,0 +1,42 @@
+/***************************************************************************
+ **  @file   tst_vpatternconverter.h
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#ifndef TST_VPATTERNCONVERTER_H
+#define TST_VPATTERNCONVERTER_H
+
+#include <QObject>
+
+class TST_VPatternConverter : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TST_VPatternConverter(QObject *parent = nullptr);
+
+private slots:
+    void ConvertKeepsSourceFile();
+    void ConvertedFileIsCurrentVersion();
+    void StrictValidationSameResult();
+    void CurrentVersionNotConverted();
+};
+
+#endif // TST_VPATTERNCONVERTER_H
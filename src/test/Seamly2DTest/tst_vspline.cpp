@@ -376,6 +376,72 @@ void TST_VSpline::TestParametrT()
     QVERIFY(qAbs(halfLength - resLength) < UnitConvertor(0.5, Unit::Mm, Unit::Px));
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestLengthTableReset()
+{
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4Moved(881.33729132409951, 1515.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+
+    VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+    const qreal length = spl.GetLength(); // Build the table
+
+    VSpline copy(spl);
+    copy.SetP4(p4Moved);
+    QCOMPARE(spl.GetLength(), length);
+
+    const VSpline expected(p1, static_cast<QPointF>(copy.GetP2()), static_cast<QPointF>(copy.GetP3()), p4Moved);
+    QCOMPARE(copy.GetLength(), expected.GetLength());
+    Comparison(copy.getPoints(), expected.getPoints());
+
+    const qreal third = copy.GetLength()/3.0;
+    QVERIFY(qAbs(copy.LengthT(copy.GetParmT(third)) - third) < UnitConvertor(0.5, Unit::Mm, Unit::Px));
+    QCOMPARE(copy.GetParmT(0), 0.0);
+    QCOMPARE(copy.GetParmT(copy.GetLength()), 1.0);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestLengthQuadrature()
+{
+    // Straight line, exact length is known
+    const VSpline line(VPointF(0, 0), QPointF(100, 0), QPointF(200, 0), VPointF(300, 0));
+    QVERIFY(qAbs(line.GetLength() - 300) < 1e-6);
+    QVERIFY(qAbs(line.LengthT(0.5) - 150) < 1e-6);
+
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+    const VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+
+    // Quadrature agrees with the drawing polyline within its flattening error
+    QVERIFY(qAbs(spl.GetLength() - VAbstractCurve::PathLength(spl.getPoints())) < ToPixel(0.1, Unit::Mm));
+    QVERIFY(qAbs(spl.LengthT(1) - spl.GetLength()) < 1e-6);
+
+    const qreal length = spl.GetLength()*0.37;
+    QVERIFY(qAbs(spl.LengthT(spl.GetParmT(length)) - length) < ToPixel(0.001, Unit::Mm));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VSpline::TestIntersectLine()
+{
+    VPointF p1(1168.8582803149607, 39.999874015748034, "p1", 5.0000125984251973, 9.9999874015748045);
+    VPointF p4(681.33729132409951, 1815.7969526662778, "p4", 5.0000125984251973, 9.9999874015748045);
+    const VSpline spl(p1, p4, 229.381, 41.6325, 0.96294100000000005, 1.00054, 1);
+
+    const QVector<QLineF> lines{QLineF(0, 900, 2000, 900), QLineF(900, 0, 900, 2000), QLineF(0, 0, 2000, 2000),
+                                QLineF(0, 0, 10, 10)};
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const QVector<QPointF> polyline = VAbstractCurve::CurveIntersectLine(spl.getPoints(), lines.at(i));
+        const QVector<QPointF> exact = spl.IntersectLine(lines.at(i));
+        QCOMPARE(exact.size(), polyline.size());
+        for (int j = 0; j < exact.size(); ++j)
+        {
+            QVERIFY(QLineF(exact.at(j), polyline.at(j)).length() < VGObject::accuracyPointOnLine);
+            QVERIFY(spl.isPointOnCurve(exact.at(j)));
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VSpline::TestLengthByPoint_data()
 {
@@ -72,6 +72,9 @@ private slots:
     void GetSegmentPoints_RotateTool();
     void CompareThreeWays();
     void TestParametrT();
+    void TestLengthTableReset();
+    void TestLengthQuadrature();
+    void TestIntersectLine();
     void TestLengthByPoint_data();
     void TestLengthByPoint();
     void TestFlip_data();
@@ -0,0 +1,200 @@
+/***************************************************************************
+ **  @file   tst_vtextmanager.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vtextmanager.h"
+#include "../vlayout/vtextmanager.h"
+
+#include <QFontMetrics>
+#include <QtMath>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+Q_DECLARE_METATYPE(QList<TextLine>)
+
+namespace
+{
+//---------------------------------------------------------------------------------------------------------------------
+TextLine Line(const QString &text, int fontSize = 0, bool bold = false, bool italic = false)
+{
+    TextLine tl;
+    tl.m_text = text;
+    tl.m_iFontSize = fontSize;
+    tl.bold = bold;
+    tl.italic = italic;
+    return tl;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+int LineWidth(QFont font, const TextLine &tl, int iFS)
+{
+    font.setPixelSize(iFS + tl.m_iFontSize);
+    font.setBold(tl.bold);
+    font.setItalic(tl.italic);
+    return QFontMetrics(font).horizontalAdvance(tl.m_text);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// The linear walk FitFontSize used before the search.
+int LinearWalk(const QFont &font, const QList<TextLine> &lines, qreal fW, qreal fH)
+{
+    int iFS = 0;
+    if (lines.size() > 0)
+    {
+        iFS = 3*qFloor(fH/lines.size())/4;
+    }
+
+    if (iFS < MIN_FONT_SIZE)
+    {
+        iFS = MIN_FONT_SIZE;
+    }
+
+    int iMaxLen = 0;
+    TextLine maxLine;
+    for (int i = 0; i < lines.size(); ++i)
+    {
+        const int iTW = LineWidth(font, lines.at(i), iFS);
+        if (iTW > iMaxLen)
+        {
+            iMaxLen = iTW;
+            maxLine = lines.at(i);
+        }
+    }
+
+    if (iMaxLen > fW)
+    {
+        int lineLength = 0;
+        do
+        {
+            --iFS;
+            lineLength = LineWidth(font, maxLine, iFS);
+        }
+        while (lineLength > fW && iFS > MIN_FONT_SIZE);
+    }
+    return iFS;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+QList<TextLine> Label()
+{
+    return QList<TextLine>() << Line("Front", 2, true)
+                             << Line("Cut 2 of fabric, on fold")
+                             << Line("Size 40", 0, false, true)
+                             << Line("Seamly2D");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void AddRows()
+{
+    QTest::addColumn<QList<TextLine>>("lines");
+    QTest::addColumn<qreal>("width");
+    QTest::addColumn<qreal>("height");
+
+    QTest::newRow("Fits at the start size") << (QList<TextLine>() << Line("A")) << 500.0 << 40.0;
+    QTest::newRow("Label in a wide box") << Label() << 800.0 << 120.0;
+    QTest::newRow("Label in a narrow box") << Label() << 120.0 << 300.0;
+    QTest::newRow("Label in a tall box") << Label() << 60.0 << 1000.0;
+    QTest::newRow("Too wide at the minimum size") << Label() << 5.0 << 300.0;
+    QTest::newRow("Start size is the minimum, too wide") << Label() << 5.0 << 10.0;
+    QTest::newRow("Start size is the minimum, fits") << Label() << 800.0 << 10.0;
+    QTest::newRow("No lines") << QList<TextLine>() << 100.0 << 100.0;
+}
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VTextManager::TST_VTextManager(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextManager::SearchAsLinearWalk_data() const
+{
+    AddRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextManager::SearchAsLinearWalk() const
+{
+    QFETCH(QList<TextLine>, lines);
+    QFETCH(qreal, width);
+    QFETCH(qreal, height);
+
+    const QFont font;
+    QCOMPARE(VTextManager::SearchFontSize(font, lines, width, height), LinearWalk(font, lines, width, height));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextManager::CachedAsSearched_data() const
+{
+    AddRows();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextManager::CachedAsSearched() const
+{
+    QFETCH(QList<TextLine>, lines);
+    QFETCH(qreal, width);
+    QFETCH(qreal, height);
+
+    const QFont font;
+    const int searched = VTextManager::SearchFontSize(font, lines, width, height);
+
+    // The first call fills the cache, the second one reads it
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height), searched);
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height), searched);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTextManager::CacheFollowsText() const
+{
+    QFont font;
+    QList<TextLine> lines = QList<TextLine>() << Line("Front");
+    const qreal width = 200;
+    const qreal height = 100;
+
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height),
+             VTextManager::SearchFontSize(font, lines, width, height));
+
+    // Every input of the search is part of the key, a cached size must not be reused after a change
+    lines.first().m_text = "Front, cut 2 of fabric on fold";
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height),
+             VTextManager::SearchFontSize(font, lines, width, height));
+
+    lines.first().bold = true;
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height),
+             VTextManager::SearchFontSize(font, lines, width, height));
+
+    lines.first().m_iFontSize = 6;
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height),
+             VTextManager::SearchFontSize(font, lines, width, height));
+
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width / 2, height),
+             VTextManager::SearchFontSize(font, lines, width / 2, height));
+
+    font.setFamily("Courier");
+    QCOMPARE(VTextManager::FittedFontSize(font, lines, width, height),
+             VTextManager::SearchFontSize(font, lines, width, height));
+}
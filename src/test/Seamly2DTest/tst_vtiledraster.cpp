@@ -0,0 +1,87 @@
+/***************************************************************************
+ **  @file   tst_vtiledraster.cpp
+ **  @date   Oct 17, 2026
+ **
+ **  @copyright
+ **  Copyright (C) 2017 - 2026 Seamly, LLC
+ **  https://github.com/fashionfreedom/seamly2d
+ **
+ **  @brief
+ **  Seamly2D is free software: you can redistribute it and/or modify
+ **  it under the terms of the GNU General Public License as published by
+ **  the Free Software Foundation, either version 3 of the License, or
+ **  (at your option) any later version.
+ **
+ **  Seamly2D is distributed in the hope that it will be useful,
+ **  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ **  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ **  GNU General Public License for more details.
+ **
+ **  You should have received a copy of the GNU General Public License
+ **  along with Seamly2D. If not, see <http://www.gnu.org/licenses/>.
+ **************************************************************************/
+
+#include "tst_vtiledraster.h"
+#include "../vlayout/vtiledraster.h"
+
+#include <QGraphicsScene>
+#include <QImageReader>
+#include <QTemporaryDir>
+#include <QtTest>
+
+#ifdef Q_CC_MSVC
+    #include <ciso646>
+#endif /* Q_CC_MSVC */
+
+//---------------------------------------------------------------------------------------------------------------------
+TST_VTiledRaster::TST_VTiledRaster(QObject *parent)
+    :QObject(parent)
+{
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTiledRaster::StripsMatchWholeImage_data() const
+{
+    QTest::addColumn<QByteArray>("format");
+
+    QTest::newRow("PPM") << QByteArray("PPM");
+    QTest::newRow("BMP") << QByteArray("BMP");
+    QTest::newRow("TIF") << QByteArray("TIF");
+    QTest::newRow("PNG") << QByteArray("PNG");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTiledRaster::StripsMatchWholeImage() const
+{
+    QFETCH(QByteArray, format);
+
+    if (not QImageReader::supportedImageFormats().contains(format.toLower()))
+    {
+        QSKIP("Qt can't read this image format.");
+    }
+
+    QGraphicsScene scene(0, 0, 123, 77);
+    scene.addRect(10, 10, 60, 40, QPen(Qt::black, 2), QBrush(Qt::red));
+    scene.addEllipse(50, 20, 60, 50, QPen(Qt::blue, 1.5));
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // Default strip height covers the whole scene
+    const QString wholeName = dir.path() + QLatin1String("/whole.") + QString(format).toLower();
+    VTiledRaster whole(&scene, Qt::white, QFont());
+    QVERIFY2(whole.Write(wholeName, format), qUtf8Printable(whole.ErrorString()));
+
+    const QString stripsName = dir.path() + QLatin1String("/strips.") + QString(format).toLower();
+    VTiledRaster strips(&scene, Qt::white, QFont());
+    strips.SetStripHeight(7);
+    QVERIFY2(strips.Write(stripsName, format), qUtf8Printable(strips.ErrorString()));
+
+    const QImage wholeImage = QImage(wholeName).convertToFormat(QImage::Format_ARGB32);
+    const QImage stripsImage = QImage(stripsName).convertToFormat(QImage::Format_ARGB32);
+
+    QCOMPARE(wholeImage.size(), QSize(123, 77));
+    QCOMPARE(stripsImage.size(), QSize(123, 77));
+    QCOMPARE(stripsImage, wholeImage);
+    QCOMPARE(QColor(wholeImage.pixel(30, 30)), QColor(Qt::red));
+}
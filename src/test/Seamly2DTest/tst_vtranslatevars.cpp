@@ -148,6 +148,30 @@ void TST_VTranslateVars::TestFormulaToUser()
     QCOMPARE(result, output);
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTranslateVars::TestTokensRoundTrip_data()
+{
+    QTest::addColumn<QString>("formula");
+
+    QTest::newRow("Measurement") << "height*2";
+    QTest::newRow("Variables") << "Line_A_B+AngleLine_A_B";
+    QTest::newRow("Current length") << "CurrentLength/2";
+    QTest::newRow("Functions") << "sin(1)+max(2;3)";
+    QTest::newRow("Postfix operator") << "5cm+height";
+    QTest::newRow("Unknown name") << "a_b+height";
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+void TST_VTranslateVars::TestTokensRoundTrip()
+{
+    QFETCH(QString, formula);
+
+    QLocale::setDefault(QLocale::c());
+
+    const QString user = m_trMs->FormulaToUser(formula, false);
+    QCOMPARE(m_trMs->FormulaFromUser(user, false), formula);
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 void TST_VTranslateVars::cleanupTestCase()
 {
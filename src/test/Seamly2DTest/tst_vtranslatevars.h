@@ -69,6 +69,8 @@ private slots:
     void TestFormulaFromUser();
     void TestFormulaToUser_data();
     void TestFormulaToUser();
+    void TestTokensRoundTrip_data();
+    void TestTokensRoundTrip();
     void cleanupTestCase();
 private:
     Q_DISABLE_COPY(TST_VTranslateVars)